@@ -0,0 +1,75 @@
+// Header guard - prevents this file from being included more than once
+#pragma once
+
+// cstddef for std::size_t
+#include <cstddef>
+// fstream to read /proc/self/statm
+#include <fstream>
+// iostream for std::cout
+#include <iostream>
+// streambuf for the do-nothing output buffer
+#include <streambuf>
+// unistd for sysconf (page size) on Linux
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+// malloc for malloc_trim (glibc only)
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+// A stream buffer that throws away everything written to it.
+// overflow() is called for every character that doesn't fit in the (empty)
+// buffer; returning the character (not EOF) reports "success".
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int ch) override { return ch; }
+    std::streamsize xsputn(const char*, std::streamsize count) override { return count; }
+};
+
+// Silences std::cout while it is alive (RAII), then restores it.
+//
+// NameTag and FancyNameTag log every constructor, copy, move and destructor
+// to std::cout. Benchmarks create millions of tags, so we swap in a NullBuffer
+// inside the timed loop — otherwise the terminal, not the code, is measured.
+// Create one at the top of a benchmark function so the results table
+// (printed after the function returns) still reaches the console.
+class QuietCout {
+public:
+    QuietCout() : old_(std::cout.rdbuf(&null_)) {}
+    ~QuietCout() { std::cout.rdbuf(old_); }
+
+    QuietCout(const QuietCout&) = delete;
+    QuietCout& operator=(const QuietCout&) = delete;
+
+private:
+    NullBuffer null_;
+    std::streambuf* old_;
+};
+
+// Returns the process's current resident set size in bytes (Linux only; 0 elsewhere).
+// Measuring before and after building a data set gives the memory it keeps
+// resident, which is the peak for that benchmark — but only if the data set
+// can't reuse memory that is already resident. Call releaseFreeHeapMemory()
+// before the "before" reading.
+inline std::size_t currentRssBytes() {
+#if defined(__linux__)
+    std::ifstream statm("/proc/self/statm");
+    std::size_t totalPages = 0;
+    std::size_t residentPages = 0;
+    if (statm >> totalPages >> residentPages) {
+        return residentPages * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    }
+#endif
+    return 0;
+}
+
+// Hands the heap's free pages back to the OS (glibc only; a no-op elsewhere).
+// Memory freed by earlier benchmarks or iterations stays resident inside
+// malloc, and new allocations reuse it without raising the RSS, so an RSS
+// delta taken without this reads close to zero.
+inline void releaseFreeHeapMemory() {
+#if defined(__GLIBC__)
+    malloc_trim(0);
+#endif
+}
@@ -0,0 +1,133 @@
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "ArenaBio.h"
+#include "Bio.h"
+
+// Bio (three std::strings) vs ArenaBio (one block for all three):
+//
+//   Create      build one from three string_views, then destroy it
+//   Copy        copy-construct one from an existing one, then destroy it
+//   CopyVector  copy a std::vector of 100k of them
+//
+// Argument 0: short strings that fit std::string's small buffer
+//             ("Scott", "Professor", "Math")
+// Argument 1: longer strings that don't
+//             ("Scott Hermanson the Third", "Distinguished Professor",
+//              "School of Computing Science")
+//
+// heap_blocks counts the heap blocks one Bio owns, which is the number of
+// operator new calls it takes to build or copy one. It is read off the
+// objects rather than by replacing the global operator new: a replacement
+// would apply to every benchmark in this binary. arena_bio_test.cpp checks
+// these numbers against real allocation counts.
+//
+// Run: ./run_benchmarks --benchmark_filter=ArenaBio_
+
+namespace {
+
+struct Strings {
+    std::string_view name;
+    std::string_view title;
+    std::string_view department;
+};
+
+Strings stringsFor(const benchmark::State& state) {
+    if (state.range(0) == 0) {
+        return {"Scott", "Professor", "Math"};
+    }
+    return {"Scott Hermanson the Third", "Distinguished Professor", "School of Computing Science"};
+}
+
+Bio makeBio(const Strings& s) {
+    return Bio{std::string(s.name), std::string(s.title), std::string(s.department), 2010};
+}
+
+// A std::string owns a heap block unless its characters sit in the small
+// buffer inside the string object itself
+std::size_t heapBlocks(const std::string& s) {
+    const char* chars = s.data();
+    const char* self = reinterpret_cast<const char*>(&s);
+    return chars >= self && chars < self + sizeof(s) ? 0 : 1;
+}
+
+std::size_t heapBlocks(const Bio& bio) {
+    return heapBlocks(bio.name) + heapBlocks(bio.title) + heapBlocks(bio.department);
+}
+
+// ArenaBio keeps all three strings in one block (none when they are all empty)
+std::size_t heapBlocks(const ArenaBio& bio) {
+    return bio.heapBytes() == 0 ? 0 : 1;
+}
+
+void reportHeapBlocks(benchmark::State& state, std::size_t blocks) {
+    state.counters["heap_blocks"] = static_cast<double>(blocks);
+    state.SetLabel(state.range(0) == 0 ? "short strings" : "long strings");
+}
+
+constexpr std::size_t kVectorSize = 100000;
+
+} // namespace
+
+static void BM_ArenaBio_Create_Bio(benchmark::State& state) {
+    const Strings s = stringsFor(state);
+    for (auto _ : state) {
+        Bio bio{std::string(s.name), std::string(s.title), std::string(s.department), 2010};
+        benchmark::DoNotOptimize(&bio);
+    }
+    reportHeapBlocks(state, heapBlocks(makeBio(s)));
+}
+BENCHMARK(BM_ArenaBio_Create_Bio)->Arg(0)->Arg(1);
+
+static void BM_ArenaBio_Create_Arena(benchmark::State& state) {
+    const Strings s = stringsFor(state);
+    for (auto _ : state) {
+        ArenaBio bio(s.name, s.title, s.department, 2010);
+        benchmark::DoNotOptimize(&bio);
+    }
+    reportHeapBlocks(state, heapBlocks(ArenaBio(s.name, s.title, s.department, 2010)));
+}
+BENCHMARK(BM_ArenaBio_Create_Arena)->Arg(0)->Arg(1);
+
+static void BM_ArenaBio_Copy_Bio(benchmark::State& state) {
+    const Bio original = makeBio(stringsFor(state));
+    for (auto _ : state) {
+        Bio copy(original);
+        benchmark::DoNotOptimize(&copy);
+    }
+    reportHeapBlocks(state, heapBlocks(Bio(original)));
+}
+BENCHMARK(BM_ArenaBio_Copy_Bio)->Arg(0)->Arg(1);
+
+static void BM_ArenaBio_Copy_Arena(benchmark::State& state) {
+    const ArenaBio original(makeBio(stringsFor(state)));
+    for (auto _ : state) {
+        ArenaBio copy(original);
+        benchmark::DoNotOptimize(&copy);
+    }
+    reportHeapBlocks(state, heapBlocks(ArenaBio(original)));
+}
+BENCHMARK(BM_ArenaBio_Copy_Arena)->Arg(0)->Arg(1);
+
+// heap_blocks is per element; the vector's own buffer is one more block per copy
+static void BM_ArenaBio_CopyVector_Bio(benchmark::State& state) {
+    const std::vector<Bio> originals(kVectorSize, makeBio(stringsFor(state)));
+    for (auto _ : state) {
+        std::vector<Bio> copies(originals);
+        benchmark::DoNotOptimize(copies.data());
+    }
+    reportHeapBlocks(state, heapBlocks(originals.front()));
+}
+BENCHMARK(BM_ArenaBio_CopyVector_Bio)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+static void BM_ArenaBio_CopyVector_Arena(benchmark::State& state) {
+    const std::vector<ArenaBio> originals(kVectorSize, ArenaBio(makeBio(stringsFor(state))));
+    for (auto _ : state) {
+        std::vector<ArenaBio> copies(originals);
+        benchmark::DoNotOptimize(copies.data());
+    }
+    reportHeapBlocks(state, heapBlocks(originals.front()));
+}
+BENCHMARK(BM_ArenaBio_CopyVector_Arena)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,101 @@
+#include <benchmark/benchmark.h>
+#include <string>
+#include <utility>
+#include <vector>
+#include "BenchUtil.h"
+#include "FancyNameTag.h"
+#include "FancyNameTagBatch.h"
+
+// Building 100k FancyNameTags from columns of ids, companies and Bios:
+//
+//   BM_Batch_OneAtATime  the FancyNameTag constructor in a loop (Pool Bios,
+//                        vector reserved), i.e. the best a caller can do today
+//   BM_Batch_Copy        makeFancyNameTags copying each Bio
+//   BM_Batch_Move        makeFancyNameTags moving each Bio (the columns are
+//                        rebuilt untimed every iteration)
+//
+// The argument is the length of the Bio's name: 8 fits in std::string's small
+// buffer, 64 doesn't, so copying it costs a heap allocation and moving it doesn't.
+// Only construction is timed; destroying the tags happens with the timer paused.
+// Build with -DNAMETAG_TRACE=NONE so the console trace doesn't dominate.
+//
+// Run: ./run_benchmarks --benchmark_filter=Batch_
+
+namespace {
+
+constexpr int kRows = 100000;
+
+struct Columns {
+    std::vector<int> ids;
+    std::vector<std::string> companies;
+    std::vector<Bio> bios;
+};
+
+Columns makeColumns(benchmark::State& state) {
+    const std::string name(static_cast<std::size_t>(state.range(0)), 'x');
+    Columns columns;
+    columns.ids.reserve(kRows);
+    columns.companies.reserve(kRows);
+    columns.bios.reserve(kRows);
+    for (int id = 1; id <= kRows; ++id) {
+        columns.ids.push_back(id);
+        columns.companies.push_back(id <= kRows / 2 ? "Weber State University" : "Utah Tech");
+        columns.bios.push_back(Bio{name, "Professor", "Computer Science", 2010});
+    }
+    return columns;
+}
+
+} // namespace
+
+static void BM_Batch_OneAtATime(benchmark::State& state) {
+    QuietCout quiet;
+    const Columns columns = makeColumns(state);
+    for (auto _ : state) {
+        std::vector<FancyNameTag> tags;
+        tags.reserve(kRows);
+        for (std::size_t row = 0; row < columns.ids.size(); ++row) {
+            tags.emplace_back(columns.ids[row], columns.companies[row], columns.bios[row], BioAlloc::Pool);
+        }
+        benchmark::DoNotOptimize(tags.data());
+
+        state.PauseTiming();
+        tags = {};
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * kRows);
+}
+BENCHMARK(BM_Batch_OneAtATime)->Arg(8)->Arg(64)->Unit(benchmark::kMillisecond);
+
+static void BM_Batch_Copy(benchmark::State& state) {
+    QuietCout quiet;
+    const Columns columns = makeColumns(state);
+    for (auto _ : state) {
+        FancyNameTagBatch batch = makeFancyNameTags(columns.ids, columns.companies, columns.bios);
+        benchmark::DoNotOptimize(batch.tags.data());
+
+        state.PauseTiming();
+        batch = {};
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * kRows);
+}
+BENCHMARK(BM_Batch_Copy)->Arg(8)->Arg(64)->Unit(benchmark::kMillisecond);
+
+static void BM_Batch_Move(benchmark::State& state) {
+    QuietCout quiet;
+    Columns columns;
+    for (auto _ : state) {
+        state.PauseTiming();
+        columns = makeColumns(state);
+        state.ResumeTiming();
+
+        FancyNameTagBatch batch = makeFancyNameTags(columns.ids, columns.companies, std::move(columns.bios));
+        benchmark::DoNotOptimize(batch.tags.data());
+
+        state.PauseTiming();
+        batch = {};
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * kRows);
+}
+BENCHMARK(BM_Batch_Move)->Arg(8)->Arg(64)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,67 @@
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "BenchUtil.h"
+#include "BioPool.h"
+#include "FancyNameTag.h"
+
+// Compares FancyNameTag construct / copy / destroy throughput for each BioAlloc
+// strategy. The benchmark argument is the strategy: 0 = Heap, 1 = Pool.
+//
+// Run: ./run_benchmarks --benchmark_filter=BioAlloc
+
+namespace {
+
+const Bio kBio{"Scott", "Professor", "Computer Science", 2010};
+
+BioAlloc allocArg(const benchmark::State& state) {
+    return state.range(0) == 0 ? BioAlloc::Heap : BioAlloc::Pool;
+}
+
+void setAllocLabel(benchmark::State& state) {
+    state.SetLabel(state.range(0) == 0 ? "new/delete" : "pool");
+}
+
+} // namespace
+
+// One tag constructed and destroyed per iteration
+static void BM_BioAlloc_ConstructDestroy(benchmark::State& state) {
+    QuietCout quiet;
+    const BioAlloc alloc = allocArg(state);
+    for (auto _ : state) {
+        FancyNameTag tag(1, "WSU", kBio, alloc);
+        benchmark::DoNotOptimize(&tag);
+    }
+    setAllocLabel(state);
+}
+BENCHMARK(BM_BioAlloc_ConstructDestroy)->Arg(0)->Arg(1);
+
+// One deep copy (and its destruction) per iteration
+static void BM_BioAlloc_CopyDestroy(benchmark::State& state) {
+    QuietCout quiet;
+    const FancyNameTag original(1, "WSU", kBio, allocArg(state));
+    for (auto _ : state) {
+        FancyNameTag copied(original);
+        benchmark::DoNotOptimize(&copied);
+    }
+    setAllocLabel(state);
+}
+BENCHMARK(BM_BioAlloc_CopyDestroy)->Arg(0)->Arg(1);
+
+// Churn: build a batch of 1024 live tags, then destroy them all.
+// This is the badge-printing pattern — many live Bios, freed in bulk.
+static void BM_BioAlloc_BatchChurn(benchmark::State& state) {
+    QuietCout quiet;
+    const BioAlloc alloc = allocArg(state);
+    constexpr int kBatch = 1024;
+    std::vector<FancyNameTag> tags;
+    tags.reserve(kBatch);
+    for (auto _ : state) {
+        for (int i = 1; i <= kBatch; ++i) {
+            tags.emplace_back(i, "WSU", kBio, alloc);
+        }
+        tags.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * kBatch);
+    setAllocLabel(state);
+}
+BENCHMARK(BM_BioAlloc_BatchChurn)->Arg(0)->Arg(1);
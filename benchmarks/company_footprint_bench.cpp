@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+#include "BenchUtil.h"
+#include "CompanyTable.h"
+#include "NameTag.h"
+
+// Memory-footprint report for 1M tags: interned companies (NameTag today)
+// versus a private std::string per tag (NameTag before interning).
+//
+// Counters:
+//   sizeof_tag      sizeof one tag object
+//   bytes_per_tag   resident memory per tag while 1M tags are alive
+//   table_bytes     memory held by the shared CompanyTable
+//
+// Each runs once — this is a report, not a timing loop.
+//
+// Run: ./run_benchmarks --benchmark_filter=CompanyFootprint
+
+namespace {
+
+constexpr std::size_t kTags = 1000000;
+
+// A few dozen company names, all longer than the small-string buffer
+const std::vector<std::string> kCompanies = [] {
+    std::vector<std::string> companies;
+    for (int i = 0; i < 40; ++i) {
+        companies.push_back("Weber State University Campus " + std::to_string(i));
+    }
+    return companies;
+}();
+
+// The layout NameTag had before interning: every tag owns a company copy
+struct StringCompanyTag {
+    int id;
+    std::string name;
+    std::string company;
+};
+
+void report(benchmark::State& state, std::size_t sizeofTag, std::size_t rssBefore) {
+    const std::size_t rssAfter = currentRssBytes();
+    const double used = rssAfter > rssBefore ? static_cast<double>(rssAfter - rssBefore) : 0.0;
+    state.counters["sizeof_tag"] = static_cast<double>(sizeofTag);
+    state.counters["bytes_per_tag"] = used / static_cast<double>(kTags);
+    state.counters["table_bytes"] = static_cast<double>(CompanyTable::memoryUsage());
+}
+
+} // namespace
+
+static void BM_CompanyFootprint_PrivateString(benchmark::State& state) {
+    for (auto _ : state) {
+        const std::size_t rssBefore = currentRssBytes();
+        std::vector<StringCompanyTag> tags;
+        tags.reserve(kTags);
+        for (std::size_t i = 0; i < kTags; ++i) {
+            tags.push_back({static_cast<int>(i) + 1, "Waldo", kCompanies[i % kCompanies.size()]});
+        }
+        report(state, sizeof(StringCompanyTag), rssBefore);
+    }
+}
+BENCHMARK(BM_CompanyFootprint_PrivateString)->Iterations(1)->Unit(benchmark::kMillisecond);
+
+static void BM_CompanyFootprint_Interned(benchmark::State& state) {
+    QuietCout quiet;
+    for (auto _ : state) {
+        const std::size_t rssBefore = currentRssBytes();
+        std::vector<NameTag> tags;
+        tags.reserve(kTags);
+        for (std::size_t i = 0; i < kTags; ++i) {
+            tags.emplace_back(static_cast<int>(i) + 1, "Waldo", kCompanies[i % kCompanies.size()]);
+        }
+        report(state, sizeof(NameTag), rssBefore);
+    }
+}
+BENCHMARK(BM_CompanyFootprint_Interned)->Iterations(1)->Unit(benchmark::kMillisecond);
+
+// Comparing companies: string compare versus integer compare
+static void BM_CompanyFootprint_CompareStrings(benchmark::State& state) {
+    const std::string a = kCompanies[3];
+    const std::string b = kCompanies[3];
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a == b);
+    }
+}
+BENCHMARK(BM_CompanyFootprint_CompareStrings);
+
+static void BM_CompanyFootprint_CompareIds(benchmark::State& state) {
+    const CompanyId a = CompanyTable::intern(kCompanies[3]);
+    const CompanyId b = CompanyTable::intern(kCompanies[3]);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a == b);
+    }
+}
+BENCHMARK(BM_CompanyFootprint_CompareIds);
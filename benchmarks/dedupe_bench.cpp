@@ -0,0 +1,146 @@
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+#include "BenchUtil.h"
+#include "FancyNameTag.h"
+#include "HashUtil.h"
+#include "NameTag.h"
+
+// "Which of these tags are distinct?" — every tag goes into an
+// std::unordered_set; half of them are already there.
+//   RehashStrings  what we had to write before NameTag had == and std::hash:
+//                  a hasher and a comparator that go through the getters, so
+//                  every probe hashes the name and company strings again
+//   CachedHash     std::unordered_set<NameTag>: std::hash returns the hash the
+//                  tag cached when it was built, and == checks that hash and
+//                  the CompanyId before it compares any characters
+// The set is reserved up front and cleared outside the timed region, so both
+// variants pay the same node allocations and only hashing/comparing differs.
+//
+// NameTag: 10M tags, 5M distinct. FancyNameTag (three Bio strings per
+// probe): 1M tags, 500k distinct. The tags are built once and shared.
+//
+// Run: ./run_benchmarks --benchmark_filter=Dedupe_
+
+namespace {
+
+constexpr std::size_t kNameTags = 10000000;
+constexpr std::size_t kFancyTags = 1000000;
+
+// A few dozen companies, like production data
+std::string companyName(std::size_t key) {
+    return "Company Number " + std::to_string(key % 40) + " Incorporated";
+}
+
+// Tag i and tag i + count / 2 have the same key, so exactly half are duplicates.
+// The names are too long for the small-string buffer, like most real names.
+const std::vector<NameTag>& sharedNameTags() {
+    static const std::vector<NameTag> tags = [] {
+        QuietCout quiet;
+        std::vector<NameTag> built;
+        built.reserve(kNameTags);
+        for (std::size_t i = 0; i < kNameTags; ++i) {
+            const std::size_t key = i % (kNameTags / 2);
+            built.emplace_back(static_cast<int>(key % 1000) + 1, "Person " + std::to_string(key) + " Lastname",
+                               companyName(key));
+        }
+        return built;
+    }();
+    return tags;
+}
+
+const std::vector<FancyNameTag>& sharedFancyTags() {
+    static const std::vector<FancyNameTag> tags = [] {
+        QuietCout quiet;
+        std::vector<FancyNameTag> built;
+        built.reserve(kFancyTags);
+        for (std::size_t i = 0; i < kFancyTags; ++i) {
+            const std::size_t key = i % (kFancyTags / 2);
+            built.emplace_back(static_cast<int>(key % 1000) + 1, companyName(key),
+                               Bio{"Person " + std::to_string(key) + " Lastname", "Senior Engineer",
+                                   "Research and Development", 2000 + static_cast<int>(key % 25)});
+        }
+        return built;
+    }();
+    return tags;
+}
+
+struct RehashNameTag {
+    std::size_t operator()(const NameTag& tag) const {
+        std::uint64_t seed = hashCombine(0, static_cast<std::uint64_t>(tag.getId()));
+        seed = hashCombine(seed, std::string_view(tag.getName()));
+        return static_cast<std::size_t>(hashCombine(seed, std::string_view(tag.getCompany())));
+    }
+};
+
+struct SameNameTag {
+    bool operator()(const NameTag& a, const NameTag& b) const {
+        return a.getId() == b.getId() && a.getName() == b.getName() && a.getCompany() == b.getCompany();
+    }
+};
+
+struct RehashFancyNameTag {
+    std::size_t operator()(const FancyNameTag& tag) const {
+        std::uint64_t seed = hashCombine(0, static_cast<std::uint64_t>(tag.getId()));
+        seed = hashCombine(seed, std::string_view(tag.getCompany()));
+        const Bio& bio = tag.getBio();
+        seed = hashCombine(seed, std::string_view(bio.name));
+        seed = hashCombine(seed, std::string_view(bio.title));
+        seed = hashCombine(seed, std::string_view(bio.department));
+        return static_cast<std::size_t>(hashCombine(seed, static_cast<std::uint64_t>(bio.year)));
+    }
+};
+
+struct SameFancyNameTag {
+    bool operator()(const FancyNameTag& a, const FancyNameTag& b) const {
+        const Bio& x = a.getBio();
+        const Bio& y = b.getBio();
+        return a.getId() == b.getId() && a.getCompany() == b.getCompany() && x.name == y.name &&
+               x.title == y.title && x.department == y.department && x.year == y.year;
+    }
+};
+
+template <typename Set, typename Tag>
+void dedupe(benchmark::State& state, const std::vector<Tag>& tags) {
+    QuietCout quiet;
+    Set unique;
+    for (auto _ : state) {
+        unique.reserve(tags.size() / 2);
+        for (const Tag& tag : tags) {
+            unique.insert(tag);
+        }
+        benchmark::DoNotOptimize(unique.size());
+        state.PauseTiming();
+        state.counters["distinct"] = static_cast<double>(unique.size());
+        unique.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(tags.size()));
+}
+
+} // namespace
+
+static void BM_Dedupe_NameTag_RehashStrings(benchmark::State& state) {
+    dedupe<std::unordered_set<NameTag, RehashNameTag, SameNameTag>>(state, sharedNameTags());
+}
+BENCHMARK(BM_Dedupe_NameTag_RehashStrings)->Iterations(3)->Unit(benchmark::kMillisecond);
+
+static void BM_Dedupe_NameTag_CachedHash(benchmark::State& state) {
+    dedupe<std::unordered_set<NameTag>>(state, sharedNameTags());
+}
+BENCHMARK(BM_Dedupe_NameTag_CachedHash)->Iterations(3)->Unit(benchmark::kMillisecond);
+
+static void BM_Dedupe_FancyNameTag_RehashStrings(benchmark::State& state) {
+    dedupe<std::unordered_set<FancyNameTag, RehashFancyNameTag, SameFancyNameTag>>(state, sharedFancyTags());
+}
+BENCHMARK(BM_Dedupe_FancyNameTag_RehashStrings)->Iterations(3)->Unit(benchmark::kMillisecond);
+
+static void BM_Dedupe_FancyNameTag_CachedHash(benchmark::State& state) {
+    dedupe<std::unordered_set<FancyNameTag>>(state, sharedFancyTags());
+}
+BENCHMARK(BM_Dedupe_FancyNameTag_CachedHash)->Iterations(3)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,114 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "BenchUtil.h"
+#include "CompactFancyNameTag.h"
+#include "FancyNameTag.h"
+#include "InlineFancyNameTag.h"
+
+// Scans a std::vector of tags, reading every Bio (what print() and reports do).
+// FancyNameTag follows bio_ to a separate heap block per tag; InlineFancyNameTag
+// finds the Bio inside the tag. The vector is shuffled after building, which
+// scatters the heap Bios relative to scan order — like a long-running service
+// where tags are created, moved and sorted over time.
+// CompactFancyNameTag (12 bytes instead of 24) checks a 4-byte handle (24-bit
+// slab index + 8-bit generation), then reads the Bio from a slot in the global
+// BioSlab.
+// The tag_bytes counter is sizeof(Tag).
+//
+// TagScan reads only the id and company of every tag (no Bio), so its cost is
+// streaming the vector itself: the smaller the tag, the fewer cache lines.
+//
+// Argument: number of tags
+//
+// Run: ./run_benchmarks --benchmark_filter='BioScan|TagScan'
+
+namespace {
+
+const Bio kBio{"Scott", "Professor", "Computer Science", 2010};
+
+template <typename Tag>
+std::vector<Tag> makeShuffledTags(std::size_t count) {
+    std::vector<Tag> tags;
+    tags.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        tags.emplace_back(static_cast<int>(i) + 1, "Weber State University", kBio);
+    }
+    // Shuffle by swapping positions. Assignment is deleted, so build a new
+    // vector by moving from a shuffled list of indices.
+    std::vector<std::size_t> order(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        order[i] = i;
+    }
+    std::shuffle(order.begin(), order.end(), std::mt19937(42));
+    std::vector<Tag> shuffled;
+    shuffled.reserve(count);
+    for (std::size_t index : order) {
+        shuffled.push_back(std::move(tags[index]));
+    }
+    return shuffled;
+}
+
+template <typename Tag>
+void scanBios(benchmark::State& state) {
+    QuietCout quiet;
+    const auto tags = makeShuffledTags<Tag>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        long long total = 0;
+        for (const Tag& tag : tags) {
+            const Bio& bio = tag.getBio();
+            total += bio.year + static_cast<long long>(bio.name.size());
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["tag_bytes"] = static_cast<double>(sizeof(Tag));
+}
+
+template <typename Tag>
+void scanTags(benchmark::State& state) {
+    QuietCout quiet;
+    const auto tags = makeShuffledTags<Tag>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        long long total = 0;
+        for (const Tag& tag : tags) {
+            total += tag.getId() + static_cast<long long>(tag.getCompanyId().value());
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["tag_bytes"] = static_cast<double>(sizeof(Tag));
+}
+
+} // namespace
+
+static void BM_BioScan_HeapBio(benchmark::State& state) {
+    scanBios<FancyNameTag>(state);
+}
+BENCHMARK(BM_BioScan_HeapBio)->Arg(10000)->Arg(1000000);
+
+static void BM_BioScan_InlineBio(benchmark::State& state) {
+    scanBios<InlineFancyNameTag>(state);
+}
+BENCHMARK(BM_BioScan_InlineBio)->Arg(10000)->Arg(1000000);
+
+static void BM_BioScan_SlabBio(benchmark::State& state) {
+    scanBios<CompactFancyNameTag>(state);
+}
+BENCHMARK(BM_BioScan_SlabBio)->Arg(10000)->Arg(1000000);
+
+static void BM_TagScan_HeapBio(benchmark::State& state) {
+    scanTags<FancyNameTag>(state);
+}
+BENCHMARK(BM_TagScan_HeapBio)->Arg(1000000);
+
+static void BM_TagScan_InlineBio(benchmark::State& state) {
+    scanTags<InlineFancyNameTag>(state);
+}
+BENCHMARK(BM_TagScan_InlineBio)->Arg(1000000);
+
+static void BM_TagScan_SlabBio(benchmark::State& state) {
+    scanTags<CompactFancyNameTag>(state);
+}
+BENCHMARK(BM_TagScan_SlabBio)->Arg(1000000);
@@ -0,0 +1,182 @@
+#include <benchmark/benchmark.h>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "AddrUtil.h"
+#include "BenchUtil.h"
+#include "FancyNameTag.h"
+#include "NameTag.h"
+
+// The basic lifecycle operations: construct, copy, move, std::vector growth,
+// print() and shortAddr().
+//
+// The argument is the length of the name strings. Short names (up to 15
+// characters with libstdc++/MSVC, 22 with libc++) fit in std::string's small
+// buffer (SSO, no heap allocation); longer ones need a heap allocation for
+// every copy. Compare /8 against /64 to see that cost.
+//
+// Every tag logs its lifecycle (see Trace.h), so these numbers include the
+// trace lines; configure with -DNAMETAG_TRACE=NONE to time the operations alone.
+//
+// Run: ./run_benchmarks --benchmark_filter=Lifecycle_
+
+namespace {
+
+std::string nameOfLength(benchmark::State& state) {
+    return std::string(static_cast<std::size_t>(state.range(0)), 'x');
+}
+
+Bio bioWithNameLength(benchmark::State& state) {
+    return Bio{nameOfLength(state), "Professor", "Computer Science", 2010};
+}
+
+// Same as FancyNameTag, but its move constructor may throw. std::vector can't
+// move such elements when it grows (a throw halfway would lose elements), so
+// it COPIES them instead — this shows what "noexcept" buys.
+struct ThrowingMoveTag {
+    FancyNameTag tag;
+
+    ThrowingMoveTag(int id, const std::string& company, const Bio& bio) : tag(id, company, bio) {}
+    ThrowingMoveTag(const ThrowingMoveTag&) = default;
+    ThrowingMoveTag(ThrowingMoveTag&& other) noexcept(false) : tag(std::move(other.tag)) {}
+};
+
+static_assert(std::is_nothrow_move_constructible_v<FancyNameTag>);
+static_assert(!std::is_nothrow_move_constructible_v<ThrowingMoveTag>);
+
+void stringLengths(benchmark::internal::Benchmark* bench) {
+    bench->Arg(8)->Arg(15)->Arg(16)->Arg(64);
+}
+
+} // namespace
+
+// ==================== NameTag ====================
+
+static void BM_Lifecycle_NameTag_Construct(benchmark::State& state) {
+    QuietCout quiet;
+    const std::string name = nameOfLength(state);
+    for (auto _ : state) {
+        NameTag tag(1, name, "Weber State University");
+        benchmark::DoNotOptimize(&tag);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Lifecycle_NameTag_Construct)->Apply(stringLengths);
+
+static void BM_Lifecycle_NameTag_Copy(benchmark::State& state) {
+    QuietCout quiet;
+    const NameTag original(1, nameOfLength(state), "Weber State University");
+    for (auto _ : state) {
+        NameTag copy(original);
+        benchmark::DoNotOptimize(&copy);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Lifecycle_NameTag_Copy)->Apply(stringLengths);
+
+// Moves the tag back and forth between two objects so every iteration
+// moves a full tag (not an already moved-from one)
+static void BM_Lifecycle_NameTag_Move(benchmark::State& state) {
+    QuietCout quiet;
+    NameTag tag(1, nameOfLength(state), "Weber State University");
+    for (auto _ : state) {
+        NameTag moved(std::move(tag));
+        benchmark::DoNotOptimize(&moved);
+        tag = std::move(moved);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Lifecycle_NameTag_Move)->Apply(stringLengths);
+
+// ==================== FancyNameTag ====================
+
+static void BM_Lifecycle_FancyNameTag_Construct(benchmark::State& state) {
+    QuietCout quiet;
+    const Bio bio = bioWithNameLength(state);
+    for (auto _ : state) {
+        FancyNameTag tag(1, "Weber State University", bio);
+        benchmark::DoNotOptimize(&tag);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Lifecycle_FancyNameTag_Construct)->Apply(stringLengths);
+
+static void BM_Lifecycle_FancyNameTag_Copy(benchmark::State& state) {
+    QuietCout quiet;
+    const FancyNameTag original(1, "Weber State University", bioWithNameLength(state));
+    for (auto _ : state) {
+        FancyNameTag copy(original);
+        benchmark::DoNotOptimize(&copy);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Lifecycle_FancyNameTag_Copy)->Apply(stringLengths);
+
+// Same back-and-forth as NameTag_Move: a move construction plus a move
+// assignment per iteration
+static void BM_Lifecycle_FancyNameTag_Move(benchmark::State& state) {
+    QuietCout quiet;
+    FancyNameTag tag(1, "Weber State University", bioWithNameLength(state));
+    for (auto _ : state) {
+        FancyNameTag moved(std::move(tag));
+        benchmark::DoNotOptimize(&moved);
+        tag = std::move(moved);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Lifecycle_FancyNameTag_Move)->Apply(stringLengths);
+
+// ==================== std::vector growth ====================
+// Push 1000 tags without reserve(): the vector reallocates ~10 times and
+// relocates every existing element each time.
+
+template <typename Tag>
+static void BM_Lifecycle_VectorGrowth(benchmark::State& state) {
+    QuietCout quiet;
+    const Bio bio = bioWithNameLength(state);
+    for (auto _ : state) {
+        std::vector<Tag> tags;
+        for (int id = 1; id <= 1000; ++id) {
+            tags.emplace_back(id, "Weber State University", bio);
+        }
+        benchmark::DoNotOptimize(tags.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 1000);
+}
+BENCHMARK(BM_Lifecycle_VectorGrowth<FancyNameTag>)->Arg(8)->Arg(64)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Lifecycle_VectorGrowth<ThrowingMoveTag>)->Arg(8)->Arg(64)->Unit(benchmark::kMicrosecond);
+
+// ==================== print() and shortAddr() ====================
+
+static void BM_Lifecycle_NameTag_Print(benchmark::State& state) {
+    QuietCout quiet;
+    const NameTag tag(1, nameOfLength(state), "Weber State University");
+    for (auto _ : state) {
+        tag.print("tag", "unchanged");
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Lifecycle_NameTag_Print)->Apply(stringLengths);
+
+static void BM_Lifecycle_FancyNameTag_Print(benchmark::State& state) {
+    QuietCout quiet;
+    const FancyNameTag tag(1, "Weber State University", bioWithNameLength(state));
+    for (auto _ : state) {
+        tag.print("tag", "unchanged");
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Lifecycle_FancyNameTag_Print)->Apply(stringLengths);
+
+static void BM_Lifecycle_ShortAddr(benchmark::State& state) {
+    int value = 0;
+    const void* ptr = &value;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ptr);
+        ShortAddr addr = shortAddr(ptr);
+        benchmark::DoNotOptimize(addr);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Lifecycle_ShortAddr);
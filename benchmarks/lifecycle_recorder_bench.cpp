@@ -0,0 +1,109 @@
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <utility>
+#include "BenchUtil.h"
+#include "FancyNameTag.h"
+#include "LifecycleRecorder.h"
+
+// What recording a lifecycle event costs the thread that records it.
+//
+//   BM_Recorder_Record/0  recording off: the check every tag pays all the time
+//   BM_Recorder_Record/1  recording on: timestamp + one slot in this thread's ring
+//   BM_Recorder_Record/2  recording on, LifecycleTimestamps::Off: the slot alone
+//   BM_Recorder_CopyMove  a real FancyNameTag copy + move + 2 destructions,
+//                          with the same three settings
+//
+// The ring only holds LifecycleRecorder::kRingCapacity events, so the "on"
+// benchmark records half a ring at a time and (with the timer paused) lets
+// the drainer catch up — otherwise it would mostly measure dropped events.
+// Build with -DNAMETAG_TRACE=NONE so the console trace doesn't hide the difference.
+//
+// Run: ./run_benchmarks --benchmark_filter=Recorder
+
+namespace {
+
+constexpr int kBatch = static_cast<int>(LifecycleRecorder::kRingCapacity / 2);
+
+std::string benchPath() {
+    return (std::filesystem::temp_directory_path() / "lifecycle_recorder_bench.bin").string();
+}
+
+// Starts recording as state.range(0) asks: 0 = off, 1 = on, 2 = on without timestamps
+bool startRecording(const benchmark::State& state) {
+    if (state.range(0) == 0) {
+        return false;
+    }
+    LifecycleRecorder::start(benchPath(),
+                             state.range(0) == 1 ? LifecycleTimestamps::On : LifecycleTimestamps::Off);
+    return true;
+}
+
+const char* recordingLabel(const benchmark::State& state) {
+    switch (state.range(0)) {
+        case 0: return "recording off";
+        case 1: return "recording on";
+        default: return "recording on, no timestamps";
+    }
+}
+
+// Waits (untimed) until the drainer has written everything recorded so far
+void waitForDrainer(benchmark::State& state, std::uint64_t recorded) {
+    state.PauseTiming();
+    while (LifecycleRecorder::writtenEvents() + LifecycleRecorder::droppedEvents() < recorded) {
+        std::this_thread::yield();
+    }
+    state.ResumeTiming();
+}
+
+} // namespace
+
+static void BM_Recorder_Record(benchmark::State& state) {
+    const bool on = startRecording(state);
+    int object = 0;
+    std::uint64_t recorded = 0;
+    for (auto _ : state) {
+        if (on) {
+            waitForDrainer(state, recorded);
+        }
+        for (int i = 0; i < kBatch; ++i) {
+            recordLifecycle(LifecycleKind::Copy, LifecycleTag::FancyNameTag, &object, i, &object, &object, &object);
+        }
+        recorded += kBatch;
+    }
+    if (on) {
+        LifecycleRecorder::stop();
+        state.counters["dropped"] = static_cast<double>(LifecycleRecorder::droppedEvents());
+    }
+    state.SetItemsProcessed(state.iterations() * kBatch);
+    state.SetLabel(recordingLabel(state));
+}
+BENCHMARK(BM_Recorder_Record)->Arg(0)->Arg(1)->Arg(2);
+
+static void BM_Recorder_CopyMove(benchmark::State& state) {
+    QuietCout quiet;
+    const bool on = startRecording(state);
+    FancyNameTag original(1, "Weber State University", Bio{"Scott", "Professor", "Computer Science", 2010});
+    // 4 events per copy + move round: copy, move, and both destructions
+    constexpr int kRounds = kBatch / 4;
+    std::uint64_t recorded = on ? 1 : 0; // the original's construction
+    for (auto _ : state) {
+        if (on) {
+            waitForDrainer(state, recorded);
+        }
+        for (int i = 0; i < kRounds; ++i) {
+            FancyNameTag copy(original);
+            FancyNameTag moved(std::move(copy));
+            benchmark::DoNotOptimize(&moved);
+        }
+        recorded += 4 * kRounds;
+    }
+    if (on) {
+        LifecycleRecorder::stop();
+        state.counters["dropped"] = static_cast<double>(LifecycleRecorder::droppedEvents());
+    }
+    state.SetItemsProcessed(state.iterations() * kRounds);
+    state.SetLabel(recordingLabel(state));
+}
+BENCHMARK(BM_Recorder_CopyMove)->Arg(0)->Arg(1)->Arg(2);
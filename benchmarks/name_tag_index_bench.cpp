@@ -0,0 +1,145 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "BenchUtil.h"
+#include "NameTag.h"
+#include "NameTagIndex.h"
+
+// Lookup throughput of NameTagIndex over 100k tags as the number of threads
+// grows (the /threads:N suffix). items_per_second is the total over all
+// threads, so flat-or-rising numbers mean readers don't get in each other's way.
+//   LinearScan    std::vector<NameTag> + std::find_if by id (the old way), 1 thread
+//   ById          visitById on random ids
+//   ByName        countByName on random (name, company) pairs, string_view keys
+//   ReadMostly    ByName, but every 100th operation is a setName()
+// Lookups don't allocate; ReadMostly's setName does (it copies the tag).
+//
+// Run: ./run_benchmarks --benchmark_filter=NameTagIndex_
+
+namespace {
+
+constexpr int kTags = 100000;
+
+const std::vector<std::string> kCompanies = [] {
+    std::vector<std::string> companies;
+    for (int i = 0; i < 40; ++i) {
+        companies.push_back("Company Number " + std::to_string(i) + " Incorporated");
+    }
+    return companies;
+}();
+
+std::string personName(int id) {
+    return "Person " + std::to_string(id);
+}
+
+NameTagIndex& sharedIndex() {
+    static NameTagIndex* index = [] {
+        QuietCout quiet;
+        auto* built = new NameTagIndex;
+        for (int id = 1; id <= kTags; ++id) {
+            built->insert(NameTag(id, personName(id), kCompanies[id % kCompanies.size()]));
+        }
+        return built;
+    }();
+    return *index;
+}
+
+// Cheap per-thread pseudo-random ids (xorshift), so threads don't all hit
+// the same shard in lockstep
+class IdStream {
+public:
+    explicit IdStream(int seed) : state_(0x9E3779B9u * static_cast<std::uint32_t>(seed + 1)) {}
+    int next() {
+        state_ ^= state_ << 13;
+        state_ ^= state_ >> 17;
+        state_ ^= state_ << 5;
+        return static_cast<int>(state_ % kTags) + 1;
+    }
+
+private:
+    std::uint32_t state_;
+};
+
+// Prebuilt (name, company) keys, so the timed loop only does the lookup
+struct NameKeys {
+    std::vector<std::string> names;
+    std::vector<const std::string*> companies;
+};
+
+const NameKeys& nameKeys() {
+    static const NameKeys keys = [] {
+        NameKeys built;
+        for (int id = 1; id <= kTags; ++id) {
+            built.names.push_back(personName(id));
+            built.companies.push_back(&kCompanies[id % kCompanies.size()]);
+        }
+        return built;
+    }();
+    return keys;
+}
+
+} // namespace
+
+static void BM_NameTagIndex_LinearScan(benchmark::State& state) {
+    static const std::vector<NameTag> tags = [] {
+        QuietCout quiet;
+        std::vector<NameTag> built;
+        for (int id = 1; id <= kTags; ++id) {
+            built.emplace_back(id, personName(id), kCompanies[id % kCompanies.size()]);
+        }
+        return built;
+    }();
+    IdStream ids(0);
+    for (auto _ : state) {
+        const int id = ids.next();
+        auto found = std::find_if(tags.begin(), tags.end(), [id](const NameTag& tag) { return tag.getId() == id; });
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_NameTagIndex_LinearScan);
+
+static void BM_NameTagIndex_ById(benchmark::State& state) {
+    const NameTagIndex& index = sharedIndex();
+    IdStream ids(state.thread_index());
+    for (auto _ : state) {
+        std::size_t length = 0;
+        index.visitById(ids.next(), [&length](const NameTag& tag) { length = tag.getName().size(); });
+        benchmark::DoNotOptimize(length);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_NameTagIndex_ById)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_NameTagIndex_ByName(benchmark::State& state) {
+    const NameTagIndex& index = sharedIndex();
+    const NameKeys& keys = nameKeys();
+    IdStream ids(state.thread_index());
+    for (auto _ : state) {
+        const int row = ids.next() - 1;
+        benchmark::DoNotOptimize(index.countByName(keys.names[row], *keys.companies[row]));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_NameTagIndex_ByName)->ThreadRange(1, 8)->UseRealTime();
+
+static void BM_NameTagIndex_ReadMostly(benchmark::State& state) {
+    NameTagIndex& index = sharedIndex();
+    const NameKeys& keys = nameKeys();
+    IdStream ids(state.thread_index());
+    std::uint64_t op = 0;
+    for (auto _ : state) {
+        const int row = ids.next() - 1;
+        if (++op % 100 == 0) {
+            // Rename to the name it already has: the keys are rewritten under
+            // the same locks, and the index stays the same for other threads
+            index.setName(row + 1, keys.names[row]);
+        } else {
+            benchmark::DoNotOptimize(index.countByName(keys.names[row], *keys.companies[row]));
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_NameTagIndex_ReadMostly)->ThreadRange(1, 8)->UseRealTime();
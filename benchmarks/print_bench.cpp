@@ -0,0 +1,106 @@
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+#include "BenchUtil.h"
+#include "FancyNameTag.h"
+#include "NameTag.h"
+
+// Dumping 1M tags: print() (std::cout with manipulators and temporary strings)
+// versus appendTo() into one reused std::string that is written out in one call.
+// Output goes to a NullBuffer, so only formatting cost is measured.
+//
+// Run: ./run_benchmarks --benchmark_filter=Dump
+
+namespace {
+
+constexpr std::size_t kTags = 1000000;
+
+// Call these after creating a QuietCout: building (and later destroying)
+// the tags logs every constructor and destructor
+std::vector<NameTag> makeNameTags() {
+    std::vector<NameTag> tags;
+    tags.reserve(kTags);
+    for (std::size_t i = 0; i < kTags; ++i) {
+        tags.emplace_back(static_cast<int>(i % 100000) + 1, "Waldo", "Weber State University");
+    }
+    return tags;
+}
+
+std::vector<FancyNameTag> makeFancyTags() {
+    std::vector<FancyNameTag> tags;
+    tags.reserve(kTags);
+    for (std::size_t i = 0; i < kTags; ++i) {
+        tags.emplace_back(static_cast<int>(i % 100000) + 1, "Weber State University",
+                          Bio{"Scott", "Professor", "Computer Science", 2010});
+    }
+    return tags;
+}
+
+// Writes the buffer once it holds about 64 KiB, like a buffered log writer
+constexpr std::size_t kFlushBytes = 64 * 1024;
+
+} // namespace
+
+static void BM_Dump_NameTag_Print(benchmark::State& state) {
+    QuietCout quiet;
+    const auto tags = makeNameTags();
+    for (auto _ : state) {
+        for (const NameTag& tag : tags) {
+            tag.print("tag");
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(tags.size()));
+}
+BENCHMARK(BM_Dump_NameTag_Print)->Unit(benchmark::kMillisecond);
+
+static void BM_Dump_NameTag_AppendTo(benchmark::State& state) {
+    QuietCout quiet;
+    const auto tags = makeNameTags();
+    std::string buffer;
+    buffer.reserve(kFlushBytes + 256);
+    for (auto _ : state) {
+        for (const NameTag& tag : tags) {
+            tag.appendTo(buffer, "tag");
+            if (buffer.size() >= kFlushBytes) {
+                std::cout.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+                buffer.clear();
+            }
+        }
+        std::cout.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(tags.size()));
+}
+BENCHMARK(BM_Dump_NameTag_AppendTo)->Unit(benchmark::kMillisecond);
+
+static void BM_Dump_FancyNameTag_Print(benchmark::State& state) {
+    QuietCout quiet;
+    const auto tags = makeFancyTags();
+    for (auto _ : state) {
+        for (const FancyNameTag& tag : tags) {
+            tag.print("tag");
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(tags.size()));
+}
+BENCHMARK(BM_Dump_FancyNameTag_Print)->Unit(benchmark::kMillisecond);
+
+static void BM_Dump_FancyNameTag_AppendTo(benchmark::State& state) {
+    QuietCout quiet;
+    const auto tags = makeFancyTags();
+    std::string buffer;
+    buffer.reserve(kFlushBytes + 256);
+    for (auto _ : state) {
+        for (const FancyNameTag& tag : tags) {
+            tag.appendTo(buffer, "tag");
+            if (buffer.size() >= kFlushBytes) {
+                std::cout.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+                buffer.clear();
+            }
+        }
+        std::cout.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(tags.size()));
+}
+BENCHMARK(BM_Dump_FancyNameTag_AppendTo)->Unit(benchmark::kMillisecond);
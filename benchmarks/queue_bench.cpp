@@ -0,0 +1,207 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+#include "BenchUtil.h"
+#include "FancyNameTag.h"
+#include "FancyNameTagQueue.h"
+
+// Handing FancyNameTags from one thread to another.
+//   LockedDeque  std::deque behind a mutex + condition variables, copying the
+//                tag in and out (two deep Bio copies per handoff) — what we did
+//   Mpmc         FancyNameTagQueue push()/pop(): two noexcept moves, no copies
+//   MpmcBatch    FancyNameTagQueue pushBatch()/popBatch() in batches of 64
+// Arguments: 0 = QueueWait::Spin, 1 = QueueWait::Block. Every queue holds 1024.
+//
+// Throughput: one producer thread pushes 100k prebuilt tags, the benchmark
+// thread pops them all; items_per_second is tags handed over per second.
+// PingPong: one tag bounces benchmark thread -> echo thread -> benchmark
+// thread; the time per iteration is one round trip (two handoffs).
+// Build with -DNAMETAG_TRACE=NONE.
+//
+// Run: ./run_benchmarks --benchmark_filter=Queue_
+
+namespace {
+
+constexpr int kTags = 100000;
+constexpr std::size_t kCapacity = 1024;
+constexpr std::size_t kBatch = 64;
+
+FancyNameTag makeTag(int id) {
+    return FancyNameTag(id, "Weber State University",
+                        Bio{"Person number " + std::to_string(id), "Professor", "Computer Science", 2010});
+}
+
+std::vector<FancyNameTag> makeTags() {
+    std::vector<FancyNameTag> tags;
+    tags.reserve(kTags);
+    for (int id = 1; id <= kTags; ++id) {
+        tags.push_back(makeTag(id));
+    }
+    return tags;
+}
+
+QueueWait waitMode(const benchmark::State& state) {
+    return state.range(0) == 0 ? QueueWait::Spin : QueueWait::Block;
+}
+
+// The old way: a bounded deque guarded by one mutex, copying tags through
+class LockedDeque {
+public:
+    void push(const FancyNameTag& tag) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        notFull_.wait(lock, [this] { return tags_.size() < kCapacity; });
+        tags_.push_back(tag);
+        notEmpty_.notify_one();
+    }
+
+    std::optional<FancyNameTag> pop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        notEmpty_.wait(lock, [this] { return !tags_.empty() || closed_; });
+        if (tags_.empty()) {
+            return std::nullopt;
+        }
+        std::optional<FancyNameTag> tag(tags_.front());
+        tags_.pop_front();
+        notFull_.notify_one();
+        return tag;
+    }
+
+    void close() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        notEmpty_.notify_all();
+    }
+
+private:
+    std::mutex mutex_;
+    std::condition_variable notEmpty_;
+    std::condition_variable notFull_;
+    std::deque<FancyNameTag> tags_;
+    bool closed_ = false;
+};
+
+} // namespace
+
+// ==================== Throughput ====================
+
+static void BM_Queue_Throughput_LockedDeque(benchmark::State& state) {
+    QuietCout quiet;
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<FancyNameTag> tags = makeTags();
+        LockedDeque queue;
+        state.ResumeTiming();
+
+        std::thread producer([&] {
+            for (const FancyNameTag& tag : tags) {
+                queue.push(tag);
+            }
+        });
+        int received = 0;
+        while (received < kTags) {
+            benchmark::DoNotOptimize(queue.pop());
+            ++received;
+        }
+        producer.join();
+    }
+    state.SetItemsProcessed(state.iterations() * kTags);
+}
+BENCHMARK(BM_Queue_Throughput_LockedDeque)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_Queue_Throughput_Mpmc(benchmark::State& state) {
+    QuietCout quiet;
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<FancyNameTag> tags = makeTags();
+        FancyNameTagQueue queue(kCapacity, waitMode(state));
+        state.ResumeTiming();
+
+        std::thread producer([&] {
+            for (FancyNameTag& tag : tags) {
+                queue.push(std::move(tag));
+            }
+        });
+        int received = 0;
+        while (received < kTags) {
+            benchmark::DoNotOptimize(queue.pop());
+            ++received;
+        }
+        producer.join();
+    }
+    state.SetItemsProcessed(state.iterations() * kTags);
+}
+BENCHMARK(BM_Queue_Throughput_Mpmc)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_Queue_Throughput_MpmcBatch(benchmark::State& state) {
+    QuietCout quiet;
+    std::vector<FancyNameTag> out;
+    out.reserve(kBatch);
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<FancyNameTag> tags = makeTags();
+        FancyNameTagQueue queue(kCapacity, waitMode(state));
+        state.ResumeTiming();
+
+        std::thread producer([&] {
+            const std::span<FancyNameTag> all(tags);
+            for (std::size_t begin = 0; begin < all.size(); begin += kBatch) {
+                queue.pushBatch(all.subspan(begin, std::min(kBatch, all.size() - begin)));
+            }
+        });
+        std::size_t received = 0;
+        while (received < static_cast<std::size_t>(kTags)) {
+            out.clear();
+            received += queue.popBatch(out, kBatch);
+        }
+        producer.join();
+    }
+    state.SetItemsProcessed(state.iterations() * kTags);
+}
+BENCHMARK(BM_Queue_Throughput_MpmcBatch)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// ==================== Latency ====================
+
+static void BM_Queue_PingPong_LockedDeque(benchmark::State& state) {
+    QuietCout quiet;
+    LockedDeque there;
+    LockedDeque back;
+    std::thread echo([&] {
+        while (std::optional<FancyNameTag> tag = there.pop()) {
+            back.push(*tag);
+        }
+    });
+    FancyNameTag ball = makeTag(1);
+    for (auto _ : state) {
+        there.push(ball);
+        ball = *back.pop();
+    }
+    there.close();
+    echo.join();
+}
+BENCHMARK(BM_Queue_PingPong_LockedDeque)->UseRealTime();
+
+static void BM_Queue_PingPong_Mpmc(benchmark::State& state) {
+    QuietCout quiet;
+    FancyNameTagQueue there(kCapacity, waitMode(state));
+    FancyNameTagQueue back(kCapacity, waitMode(state));
+    std::thread echo([&] {
+        while (std::optional<FancyNameTag> tag = there.pop()) {
+            back.push(std::move(*tag));
+        }
+    });
+    FancyNameTag ball = makeTag(1);
+    for (auto _ : state) {
+        there.push(std::move(ball));
+        ball = std::move(*back.pop());
+    }
+    there.close();
+    echo.join();
+}
+BENCHMARK(BM_Queue_PingPong_Mpmc)->Arg(0)->Arg(1)->UseRealTime();
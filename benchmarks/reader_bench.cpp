@@ -0,0 +1,50 @@
+#include <benchmark/benchmark.h>
+#include <sstream>
+#include <string>
+#include "BenchUtil.h"
+#include "FancyNameTagReader.h"
+
+// Streaming 200k CSV rows through FancyNameTagReader.
+// The argument is the number of worker threads; the input is an in-memory
+// string, so this measures parsing, validation and construction only.
+// Each chunk is dropped as soon as it is returned, like a consumer that
+// stores the tags elsewhere. Build with -DNAMETAG_TRACE=NONE.
+//
+// Run: ./run_benchmarks --benchmark_filter=Reader_
+
+namespace {
+
+constexpr int kRows = 200000;
+
+const std::string& csvText() {
+    static const std::string text = [] {
+        std::string rows;
+        for (int id = 1; id <= kRows; ++id) {
+            rows += std::to_string(id) + ",Weber State University,Person " + std::to_string(id) +
+                    ",Professor,Computer Science," + std::to_string(1990 + id % 30) + "\n";
+        }
+        return rows;
+    }();
+    return text;
+}
+
+} // namespace
+
+static void BM_Reader_Csv(benchmark::State& state) {
+    QuietCout quiet;
+    IngestOptions options;
+    options.workers = static_cast<std::size_t>(state.range(0));
+    for (auto _ : state) {
+        std::istringstream in(csvText());
+        FancyNameTagReader reader(in, options);
+        FancyNameTagChunk chunk;
+        std::size_t tags = 0;
+        while (reader.next(chunk)) {
+            tags += chunk.tags.size();
+        }
+        benchmark::DoNotOptimize(tags);
+    }
+    state.SetItemsProcessed(state.iterations() * kRows);
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(csvText().size()));
+}
+BENCHMARK(BM_Reader_Csv)->Arg(1)->Arg(2)->Arg(4)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,120 @@
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+#include "BenchUtil.h"
+#include "NameTag.h"
+#include "NameTagRegistry.h"
+
+// Filter and count queries over N tags: std::vector<NameTag> (array of structs)
+// versus NameTagRegistry (structure of arrays).
+// Argument: number of tags
+//
+// Run: ./run_benchmarks --benchmark_filter=Registry
+
+namespace {
+
+// A few dozen companies, like production data
+const std::vector<std::string> kCompanies = [] {
+    std::vector<std::string> companies;
+    for (int i = 0; i < 40; ++i) {
+        companies.push_back("Company Number " + std::to_string(i) + " Incorporated");
+    }
+    return companies;
+}();
+
+std::vector<NameTag> makeTags(std::size_t count) {
+    QuietCout quiet;
+    std::vector<NameTag> tags;
+    tags.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        tags.emplace_back(static_cast<int>(i) + 1, "Person " + std::to_string(i),
+                          kCompanies[i % kCompanies.size()]);
+    }
+    return tags;
+}
+
+NameTagRegistry makeRegistry(const std::vector<NameTag>& tags) {
+    NameTagRegistry registry;
+    registry.reserve(tags.size());
+    for (const NameTag& tag : tags) {
+        registry.add(tag);
+    }
+    return registry;
+}
+
+} // namespace
+
+static void BM_Registry_CountCompany_Vector(benchmark::State& state) {
+    const auto tags = makeTags(static_cast<std::size_t>(state.range(0)));
+    const std::string& company = kCompanies[7];
+    for (auto _ : state) {
+        std::size_t count = 0;
+        for (const NameTag& tag : tags) {
+            count += static_cast<std::size_t>(tag.getCompany() == company);
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Registry_CountCompany_Vector)->Arg(100000)->Arg(1000000);
+
+static void BM_Registry_CountCompany_Registry(benchmark::State& state) {
+    const auto registry = makeRegistry(makeTags(static_cast<std::size_t>(state.range(0))));
+    const std::string& company = kCompanies[7];
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(registry.countCompany(company));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Registry_CountCompany_Registry)->Arg(100000)->Arg(1000000);
+
+static void BM_Registry_FilterIdRange_Vector(benchmark::State& state) {
+    const auto tags = makeTags(static_cast<std::size_t>(state.range(0)));
+    const int maxId = static_cast<int>(state.range(0) / 10);
+    for (auto _ : state) {
+        std::vector<std::size_t> rows;
+        for (std::size_t row = 0; row < tags.size(); ++row) {
+            if (tags[row].getId() >= 1 && tags[row].getId() <= maxId) {
+                rows.push_back(row);
+            }
+        }
+        benchmark::DoNotOptimize(rows.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Registry_FilterIdRange_Vector)->Arg(100000)->Arg(1000000);
+
+static void BM_Registry_FilterIdRange_Registry(benchmark::State& state) {
+    const auto registry = makeRegistry(makeTags(static_cast<std::size_t>(state.range(0))));
+    const int maxId = static_cast<int>(state.range(0) / 10);
+    for (auto _ : state) {
+        auto rows = registry.rowsWithIdInRange(1, maxId);
+        benchmark::DoNotOptimize(rows.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Registry_FilterIdRange_Registry)->Arg(100000)->Arg(1000000);
+
+static void BM_Registry_CountIdRange_Vector(benchmark::State& state) {
+    const auto tags = makeTags(static_cast<std::size_t>(state.range(0)));
+    const int maxId = static_cast<int>(state.range(0) / 2);
+    for (auto _ : state) {
+        std::size_t count = 0;
+        for (const NameTag& tag : tags) {
+            count += static_cast<std::size_t>(tag.getId() >= 1 && tag.getId() <= maxId);
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Registry_CountIdRange_Vector)->Arg(100000)->Arg(1000000);
+
+static void BM_Registry_CountIdRange_Registry(benchmark::State& state) {
+    const auto registry = makeRegistry(makeTags(static_cast<std::size_t>(state.range(0))));
+    const int maxId = static_cast<int>(state.range(0) / 2);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(registry.countIdInRange(1, maxId));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Registry_CountIdRange_Registry)->Arg(100000)->Arg(1000000);
@@ -0,0 +1,121 @@
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "BenchUtil.h"
+#include "FancyNameTag.h"
+#include "RosterFile.h"
+
+// Startup cost of loading 500k FancyNameTags:
+//
+//   BM_Roster_FromText      read a CSV file, parse every line, construct every tag
+//   BM_Roster_MapAndScan    open the roster file and read every view (ids and
+//                           string sizes), allocating nothing
+//   BM_Roster_MapAndPromote open the roster file and build an owning
+//                           FancyNameTag from every view
+//
+// Both files are written once, before the first benchmark runs, and stay in
+// the OS page cache — so this measures parsing/constructing, not the disk.
+// Build with -DNAMETAG_TRACE=NONE so the console trace doesn't dominate.
+//
+// Run: ./run_benchmarks --benchmark_filter=Roster_
+
+namespace {
+
+constexpr int kTags = 500000;
+
+const char* const kCompanies[] = {"Weber State University", "Utah Tech", "Southern Utah University"};
+const char* const kTitles[] = {"Professor", "Lecturer", "Teaching Assistant"};
+const char* const kDepartments[] = {"Computer Science", "Mathematics", "Physics", "Chemistry"};
+
+std::filesystem::path benchDir() {
+    return std::filesystem::temp_directory_path();
+}
+
+// Writes roster_bench.csv and roster_bench.bin with the same tags (once)
+void writeFiles() {
+    static const bool written = [] {
+        std::ofstream csv(benchDir() / "roster_bench.csv");
+        RosterWriter writer;
+        for (int id = 1; id <= kTags; ++id) {
+            const std::string name = "Person " + std::to_string(id);
+            const char* company = kCompanies[id % 3];
+            const char* title = kTitles[id % 3];
+            const char* department = kDepartments[id % 4];
+            const int year = 1990 + id % 30;
+            csv << id << ',' << company << ',' << name << ',' << title << ',' << department << ',' << year << '\n';
+            writer.add(FancyNameTagView{id, company, name, title, department, year});
+        }
+        writer.write((benchDir() / "roster_bench.bin").string());
+        return true;
+    }();
+    (void)written;
+}
+
+} // namespace
+
+static void BM_Roster_FromText(benchmark::State& state) {
+    QuietCout quiet;
+    writeFiles();
+    const std::string path = (benchDir() / "roster_bench.csv").string();
+    for (auto _ : state) {
+        std::ifstream in(path);
+        std::vector<FancyNameTag> tags;
+        tags.reserve(kTags);
+        std::string line;
+        std::string company;
+        Bio bio;
+        std::string year;
+        std::string id;
+        while (std::getline(in, line)) {
+            std::istringstream fields(line);
+            std::getline(fields, id, ',');
+            std::getline(fields, company, ',');
+            std::getline(fields, bio.name, ',');
+            std::getline(fields, bio.title, ',');
+            std::getline(fields, bio.department, ',');
+            std::getline(fields, year);
+            bio.year = std::stoi(year);
+            tags.emplace_back(std::stoi(id), company, bio);
+        }
+        benchmark::DoNotOptimize(tags.data());
+    }
+    state.SetItemsProcessed(state.iterations() * kTags);
+}
+BENCHMARK(BM_Roster_FromText)->Unit(benchmark::kMillisecond);
+
+static void BM_Roster_MapAndScan(benchmark::State& state) {
+    writeFiles();
+    const std::string path = (benchDir() / "roster_bench.bin").string();
+    for (auto _ : state) {
+        const RosterFile roster(path);
+        std::size_t checksum = 0;
+        for (std::size_t i = 0; i < roster.fancyCount(); ++i) {
+            const FancyNameTagView view = roster.fancyNameTag(i);
+            checksum += static_cast<std::size_t>(view.id) + view.name.size() + view.company.size();
+        }
+        benchmark::DoNotOptimize(checksum);
+    }
+    state.SetItemsProcessed(state.iterations() * kTags);
+}
+BENCHMARK(BM_Roster_MapAndScan)->Unit(benchmark::kMillisecond);
+
+static void BM_Roster_MapAndPromote(benchmark::State& state) {
+    QuietCout quiet;
+    writeFiles();
+    const std::string path = (benchDir() / "roster_bench.bin").string();
+    for (auto _ : state) {
+        const RosterFile roster(path);
+        std::vector<FancyNameTag> tags;
+        tags.reserve(roster.fancyCount());
+        for (std::size_t i = 0; i < roster.fancyCount(); ++i) {
+            const FancyNameTagView view = roster.fancyNameTag(i);
+            tags.emplace_back(view.id, view.company, view.toBio());
+        }
+        benchmark::DoNotOptimize(tags.data());
+    }
+    state.SetItemsProcessed(state.iterations() * kTags);
+}
+BENCHMARK(BM_Roster_MapAndPromote)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,81 @@
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <vector>
+#include "BenchUtil.h"
+#include "FancyNameTag.h"
+
+// Fan-out: one original tag copied N times (read-only snapshots).
+// Compares deep copies (BioAlloc::Heap) against copy-on-write (BioAlloc::Shared).
+// Arguments: {strategy (0 = Heap, 1 = Shared), number of copies}
+//
+// rss_MiB is the peak resident memory the copies add: the largest RSS growth
+// seen over all iterations while the copies exist. The heap's free pages are
+// handed back before each measurement and the vector's own buffer is made
+// resident up front, so the number is the Bios (and, for Shared, their
+// headers) alone. Linux only, and exact only with glibc (see BenchUtil.h).
+//
+// Run: ./run_benchmarks --benchmark_filter=SharedBio
+
+namespace {
+
+// Long enough to overflow the small-string buffer, like real titles
+const Bio kBio{"Scott Hadzik-Example", "Associate Professor of Computing",
+               "School of Computing, Weber State University", 2010};
+
+BioAlloc allocArg(const benchmark::State& state) {
+    return state.range(0) == 0 ? BioAlloc::Heap : BioAlloc::Shared;
+}
+
+} // namespace
+
+static void BM_SharedBio_FanOutCopy(benchmark::State& state) {
+    QuietCout quiet;
+    const FancyNameTag original(1, "Weber State University", kBio, allocArg(state));
+    const auto copies = static_cast<std::size_t>(state.range(1));
+    std::vector<FancyNameTag> snapshots;
+    snapshots.reserve(copies);
+
+    // Touch the vector's buffer once, so its pages aren't counted below
+    for (std::size_t i = 0; i < copies; ++i) {
+        snapshots.emplace_back(original);
+    }
+    snapshots.clear();
+
+    std::size_t peakRssBytes = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        releaseFreeHeapMemory();
+        const std::size_t rssBefore = currentRssBytes();
+        state.ResumeTiming();
+        for (std::size_t i = 0; i < copies; ++i) {
+            snapshots.emplace_back(original);
+        }
+        state.PauseTiming();
+        const std::size_t rssAfter = currentRssBytes();
+        if (rssAfter > rssBefore && rssAfter - rssBefore > peakRssBytes) {
+            peakRssBytes = rssAfter - rssBefore;
+        }
+        snapshots.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(copies));
+    state.counters["rss_MiB"] = static_cast<double>(peakRssBytes) / (1024.0 * 1024.0);
+    state.SetLabel(state.range(0) == 0 ? "deep copy" : "copy-on-write");
+}
+BENCHMARK(BM_SharedBio_FanOutCopy)
+    ->Args({0, 100000})
+    ->Args({1, 100000})
+    ->Unit(benchmark::kMillisecond);
+
+// Cost of the first write to a shared copy (the clone) versus a deep-copied tag
+static void BM_SharedBio_CopyThenMutate(benchmark::State& state) {
+    QuietCout quiet;
+    const FancyNameTag original(1, "Weber State University", kBio, allocArg(state));
+    for (auto _ : state) {
+        FancyNameTag copied(original);
+        copied.setBioTitle("Dean");
+        benchmark::DoNotOptimize(&copied);
+    }
+    state.SetLabel(state.range(0) == 0 ? "deep copy" : "copy-on-write");
+}
+BENCHMARK(BM_SharedBio_CopyThenMutate)->Args({0, 0})->Args({1, 0});
@@ -0,0 +1,80 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <thread>
+#include <vector>
+#include "BenchUtil.h"
+#include "FancyNameTag.h"
+#include "RosterSnapshot.h"
+#include "WorkStealingPool.h"
+
+// Snapshotting 500k FancyNameTags (heap Bios, as most rosters are built).
+//   VectorCopy  copy-construct the std::vector: one new Bio per tag, one core
+//   Parallel    parallelSnapshot() on a WorkStealingPool; the argument is the
+//               number of workers, so the rows are the 1..N core scaling curve
+//               (the last row is one worker per hardware thread)
+// Only the copy is timed; destroying the snapshot happens with the timer paused.
+// Real time is reported, since the copying happens on the pool's threads.
+// Build with -DNAMETAG_TRACE=NONE.
+//
+// Run: ./run_benchmarks --benchmark_filter=Snapshot_
+
+namespace {
+
+constexpr int kTags = 500000;
+
+const std::vector<FancyNameTag>& roster() {
+    static const std::vector<FancyNameTag> tags = [] {
+        QuietCout quiet;
+        std::vector<FancyNameTag> built;
+        built.reserve(kTags);
+        for (int id = 1; id <= kTags; ++id) {
+            built.emplace_back(id, "Weber State University",
+                               Bio{"Person " + std::to_string(id), "Professor", "Computer Science", 2010},
+                               BioAlloc::Heap);
+        }
+        return built;
+    }();
+    return tags;
+}
+
+void coreCounts(benchmark::internal::Benchmark* bench) {
+    const int hardware = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    for (int workers : {1, 2, 4, 8}) {
+        if (workers < hardware) {
+            bench->Arg(workers);
+        }
+    }
+    bench->Arg(hardware);
+}
+
+} // namespace
+
+static void BM_Snapshot_VectorCopy(benchmark::State& state) {
+    const std::vector<FancyNameTag>& tags = roster();
+    QuietCout quiet;
+    for (auto _ : state) {
+        std::vector<FancyNameTag> copy(tags);
+        benchmark::DoNotOptimize(copy.data());
+        state.PauseTiming();
+        copy = {};
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * kTags);
+}
+BENCHMARK(BM_Snapshot_VectorCopy)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_Snapshot_Parallel(benchmark::State& state) {
+    const std::vector<FancyNameTag>& tags = roster();
+    QuietCout quiet;
+    WorkStealingPool pool(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        FancyNameTagSnapshot snapshot = parallelSnapshot(tags, pool);
+        benchmark::DoNotOptimize(snapshot.begin());
+        state.PauseTiming();
+        snapshot = {};
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * kTags);
+    state.counters["steals"] = static_cast<double>(pool.steals()) / static_cast<double>(state.iterations());
+}
+BENCHMARK(BM_Snapshot_Parallel)->Apply(coreCounts)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,168 @@
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "BenchUtil.h"
+#include "FancyNameTag.h"
+#include "TagBuffer.h"
+
+// Handing 100k FancyNameTags to another process, both ends:
+//
+//   Text_Write       the hand-written text format: one '|'-separated line
+//                    per tag appended to a std::string
+//   Text_Read        split each line into std::strings, build a Bio from them
+//                    and a FancyNameTag from that (every string copied twice)
+//   Flat_Write       serialize() every tag into one std::vector<char>
+//   Flat_Read        TagBufferReader: a view of every tag, touching its
+//                    string sizes (nothing allocated, nothing copied)
+//   Flat_Materialize the same, then toFancyNameTag() on every view (each
+//                    string copied once, the Bio moved into the tag)
+//
+// bytes_per_second is the size of the buffer written or read.
+//
+// Run: ./run_benchmarks --benchmark_filter=TagBuffer_
+
+namespace {
+
+constexpr int kTags = 100000;
+
+const std::vector<FancyNameTag>& sharedTags() {
+    static const std::vector<FancyNameTag> tags = [] {
+        QuietCout quiet;
+        const char* const companies[] = {"Weber State University", "Utah Tech", "Southern Utah University"};
+        const char* const titles[] = {"Professor", "Lecturer", "Teaching Assistant"};
+        const char* const departments[] = {"Computer Science", "Mathematics", "Physics", "Chemistry"};
+        std::vector<FancyNameTag> built;
+        built.reserve(kTags);
+        for (int id = 1; id <= kTags; ++id) {
+            built.emplace_back(id, companies[id % 3],
+                               Bio{"Person Number " + std::to_string(id), titles[id % 3], departments[id % 4],
+                                   1990 + id % 30});
+        }
+        return built;
+    }();
+    return tags;
+}
+
+void writeText(const std::vector<FancyNameTag>& tags, std::string& out) {
+    out.clear();
+    for (const FancyNameTag& tag : tags) {
+        const Bio& bio = tag.getBio();
+        out += std::to_string(tag.getId());
+        out += '|';
+        out += tag.getCompany();
+        out += '|';
+        out += bio.name;
+        out += '|';
+        out += bio.title;
+        out += '|';
+        out += bio.department;
+        out += '|';
+        out += std::to_string(bio.year);
+        out += '\n';
+    }
+}
+
+// The first copy: every field into its own std::string. The second: the Bio
+// constructor (const Bio&) copies them again.
+std::vector<FancyNameTag> readText(const std::string& text) {
+    std::vector<FancyNameTag> tags;
+    tags.reserve(kTags);
+    std::size_t lineStart = 0;
+    std::string fields[6];
+    while (lineStart < text.size()) {
+        const std::size_t lineEnd = text.find('\n', lineStart);
+        std::size_t start = lineStart;
+        for (std::string& field : fields) {
+            std::size_t end = text.find_first_of("|\n", start);
+            field = text.substr(start, end - start);
+            start = end + 1;
+        }
+        const Bio bio{fields[2], fields[3], fields[4], std::stoi(fields[5])};
+        tags.emplace_back(std::stoi(fields[0]), fields[1], bio);
+        lineStart = lineEnd + 1;
+    }
+    return tags;
+}
+
+const std::vector<char>& sharedBuffer() {
+    static const std::vector<char> buffer = [] {
+        std::vector<char> built;
+        for (const FancyNameTag& tag : sharedTags()) {
+            serialize(tag, built);
+        }
+        return built;
+    }();
+    return buffer;
+}
+
+} // namespace
+
+static void BM_TagBuffer_Text_Write(benchmark::State& state) {
+    const std::vector<FancyNameTag>& tags = sharedTags();
+    std::string text;
+    for (auto _ : state) {
+        writeText(tags, text);
+        benchmark::DoNotOptimize(text.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text.size()));
+}
+BENCHMARK(BM_TagBuffer_Text_Write)->Unit(benchmark::kMillisecond);
+
+static void BM_TagBuffer_Text_Read(benchmark::State& state) {
+    QuietCout quiet;
+    std::string text;
+    writeText(sharedTags(), text);
+    for (auto _ : state) {
+        std::vector<FancyNameTag> tags = readText(text);
+        benchmark::DoNotOptimize(tags.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(text.size()));
+}
+BENCHMARK(BM_TagBuffer_Text_Read)->Unit(benchmark::kMillisecond);
+
+static void BM_TagBuffer_Flat_Write(benchmark::State& state) {
+    const std::vector<FancyNameTag>& tags = sharedTags();
+    std::vector<char> buffer;
+    for (auto _ : state) {
+        buffer.clear();
+        for (const FancyNameTag& tag : tags) {
+            serialize(tag, buffer);
+        }
+        benchmark::DoNotOptimize(buffer.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(buffer.size()));
+}
+BENCHMARK(BM_TagBuffer_Flat_Write)->Unit(benchmark::kMillisecond);
+
+static void BM_TagBuffer_Flat_Read(benchmark::State& state) {
+    const std::vector<char>& buffer = sharedBuffer();
+    for (auto _ : state) {
+        TagBufferReader reader(buffer);
+        std::size_t characters = 0;
+        while (!reader.atEnd()) {
+            const FancyNameTagView view = reader.readFancyNameTag();
+            characters += view.company.size() + view.name.size() + view.title.size() + view.department.size();
+        }
+        benchmark::DoNotOptimize(characters);
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(buffer.size()));
+}
+BENCHMARK(BM_TagBuffer_Flat_Read)->Unit(benchmark::kMillisecond);
+
+static void BM_TagBuffer_Flat_Materialize(benchmark::State& state) {
+    QuietCout quiet;
+    const std::vector<char>& buffer = sharedBuffer();
+    for (auto _ : state) {
+        std::vector<FancyNameTag> tags;
+        tags.reserve(kTags);
+        TagBufferReader reader(buffer);
+        while (!reader.atEnd()) {
+            tags.push_back(reader.readFancyNameTag().toFancyNameTag());
+        }
+        benchmark::DoNotOptimize(tags.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(buffer.size()));
+}
+BENCHMARK(BM_TagBuffer_Flat_Materialize)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,85 @@
+#include <benchmark/benchmark.h>
+#include <string>
+#include "AddrUtil.h"
+#include "BenchUtil.h"
+#include "Bio.h"
+#include "FancyNameTag.h"
+#include "Trace.h"
+
+// What one lifecycle log line costs under each tracing policy.
+//
+// BM_TraceLine_* build the same "Constructor (STACK ...)" line a FancyNameTag
+// logs, sent to Tracer<None>, Tracer<Buffered> or Tracer<Verbose> directly, so
+// all three policies are compared in one run. BM_Trace_FancyNameTag_Lifecycle
+// creates and destroys a real tag, which uses whatever policy this binary was
+// built with (shown in the label) — rebuild with -DNAMETAG_TRACE=NONE,
+// BUFFERED or VERBOSE to compare.
+//
+// Output goes to a NullBuffer, so only the formatting and stream cost is measured.
+//
+// Run: ./run_benchmarks --benchmark_filter=Trace
+
+namespace {
+
+const char* levelName(TraceLevel level) {
+    switch (level) {
+        case TraceLevel::None: return "NONE";
+        case TraceLevel::Buffered: return "BUFFERED";
+        case TraceLevel::Verbose: return "VERBOSE";
+    }
+    return "?";
+}
+
+} // namespace
+
+template <TraceLevel Level>
+static void BM_TraceLine(benchmark::State& state) {
+    QuietCout quiet;
+    const Bio bio{"Scott", "Professor", "Computer Science", 2010};
+    int id = 1;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(id);
+        if constexpr (Tracer<Level>::enabled) {
+            BasicTraceLine<Tracer<Level>>() << "Constructor (STACK " << shortAddr(&id)
+                                            << "): id=" << id
+                                            << ", company=\"Weber State University\", bio={" << bio
+                                            << "} (HEAP " << shortAddr(&bio) << ")\n";
+        }
+    }
+    Tracer<Level>::flush();
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TraceLine<TraceLevel::None>);
+BENCHMARK(BM_TraceLine<TraceLevel::Buffered>);
+BENCHMARK(BM_TraceLine<TraceLevel::Verbose>);
+
+// The old way: every piece streamed through std::cout one by one
+static void BM_TraceLine_StreamedCout(benchmark::State& state) {
+    QuietCout quiet;
+    const Bio bio{"Scott", "Professor", "Computer Science", 2010};
+    int id = 1;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(id);
+        std::cout << "Constructor (STACK " << shortAddr(&id)
+                  << "): id=" << id
+                  << ", company=\"Weber State University\", bio={";
+        bio.print();
+        std::cout << "} (HEAP " << shortAddr(&bio) << ")\n";
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TraceLine_StreamedCout);
+
+// Constructor + destructor of a real tag (two log lines when tracing is on)
+static void BM_Trace_FancyNameTag_Lifecycle(benchmark::State& state) {
+    QuietCout quiet;
+    const Bio bio{"Scott", "Professor", "Computer Science", 2010};
+    for (auto _ : state) {
+        FancyNameTag tag(1, "Weber State University", bio);
+        benchmark::DoNotOptimize(&tag);
+    }
+    traceFlush();
+    state.SetItemsProcessed(state.iterations());
+    state.SetLabel(std::string("NAMETAG_TRACE=") + levelName(kTraceLevel));
+}
+BENCHMARK(BM_Trace_FancyNameTag_Lifecycle);
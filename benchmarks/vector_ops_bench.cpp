@@ -0,0 +1,146 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include "BenchUtil.h"
+#include "FancyNameTag.h"
+#include "InstanceCounters.h"
+
+// std::vector operations on 1M FancyNameTags: growth without reserve(),
+// std::sort and std::erase_if. All three relocate tags, which is only cheap
+// because FancyNameTag's move constructor AND move assignment are noexcept.
+//
+// Counters (per iteration, counting only the timed operation):
+//   deep_copies  FancyNameTag copies + Bio copies — should be 0 everywhere
+//   moves        FancyNameTag move constructions + move assignments
+// (both stay 0 unless configured with -DNAMETAG_COUNTERS=ON, which is off by default)
+//
+// Run: ./run_benchmarks --benchmark_filter=VectorOps
+
+namespace {
+
+constexpr int kTags = 1000000;
+
+const Bio kBio{"Scott", "Professor", "Computer Science", 2010};
+
+// Ids 1..kTags in scrambled order (7919 shares no factor with kTags, so
+// i * 7919 % kTags visits every value once)
+int scrambledId(int i) {
+    return static_cast<int>(static_cast<long long>(i) * 7919 % kTags) + 1;
+}
+
+std::vector<FancyNameTag> makeTags() {
+    std::vector<FancyNameTag> tags;
+    tags.reserve(kTags);
+    for (int i = 0; i < kTags; ++i) {
+        tags.emplace_back(scrambledId(i), "Weber State University", kBio);
+    }
+    return tags;
+}
+
+// Adds up copies and moves over the timed sections only
+class CopyMoveTally {
+public:
+    // Call right before the operation being measured
+    void start() {
+        tags_ = InstanceCounter<FancyNameTag>::snapshot();
+        bios_ = InstanceCounter<Bio>::snapshot();
+    }
+
+    // Call right after it. constructorBioCopies is how many Bio copies the
+    // operation made by constructing brand-new tags (not by relocating them).
+    void stop(std::uint64_t constructorBioCopies = 0) {
+        const InstanceCounts tags = InstanceCounter<FancyNameTag>::snapshot() - tags_;
+        const InstanceCounts bios = InstanceCounter<Bio>::snapshot() - bios_;
+        deepCopies_ += tags.copies + (bios.copies - std::min(bios.copies, constructorBioCopies));
+        moves_ += tags.moves;
+    }
+
+    void report(benchmark::State& state) const {
+        const double iterations = static_cast<double>(state.iterations());
+        state.counters["deep_copies"] = static_cast<double>(deepCopies_) / iterations;
+        state.counters["moves"] = static_cast<double>(moves_) / iterations;
+    }
+
+private:
+    InstanceCounts tags_;
+    InstanceCounts bios_;
+    std::uint64_t deepCopies_ = 0;
+    std::uint64_t moves_ = 0;
+};
+
+} // namespace
+
+// emplace_back 1M tags into an empty vector: ~20 reallocations, each one
+// relocating every tag so far
+static void BM_VectorOps_Growth(benchmark::State& state) {
+    QuietCout quiet;
+    CopyMoveTally tally;
+    for (auto _ : state) {
+        tally.start();
+        std::vector<FancyNameTag> tags;
+        for (int i = 0; i < kTags; ++i) {
+            tags.emplace_back(scrambledId(i), "Weber State University", kBio);
+        }
+        benchmark::DoNotOptimize(tags.data());
+        // Each new tag copies kBio into its own Bio — that's construction,
+        // not growth
+        tally.stop(kCountersEnabled ? kTags : 0);
+
+        state.PauseTiming();
+        tags = {};
+        state.ResumeTiming();
+    }
+    tally.report(state);
+    state.SetItemsProcessed(state.iterations() * kTags);
+}
+BENCHMARK(BM_VectorOps_Growth)->Iterations(3)->Unit(benchmark::kMillisecond);
+
+// Sort 1M scrambled tags by id (swaps and move assignment)
+static void BM_VectorOps_Sort(benchmark::State& state) {
+    QuietCout quiet;
+    CopyMoveTally tally;
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<FancyNameTag> tags = makeTags();
+        tally.start();
+        state.ResumeTiming();
+
+        std::sort(tags.begin(), tags.end(), [](const FancyNameTag& a, const FancyNameTag& b) {
+            return a.getId() < b.getId();
+        });
+        benchmark::DoNotOptimize(tags.data());
+
+        state.PauseTiming();
+        tally.stop();
+        tags = {};
+        state.ResumeTiming();
+    }
+    tally.report(state);
+    state.SetItemsProcessed(state.iterations() * kTags);
+}
+BENCHMARK(BM_VectorOps_Sort)->Iterations(3)->Unit(benchmark::kMillisecond);
+
+// Remove every 10th tag: the survivors are moved down over the gaps
+// (move assignment), and the removed tags are destroyed
+static void BM_VectorOps_EraseIf(benchmark::State& state) {
+    QuietCout quiet;
+    CopyMoveTally tally;
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<FancyNameTag> tags = makeTags();
+        tally.start();
+        state.ResumeTiming();
+
+        const auto removed = std::erase_if(tags, [](const FancyNameTag& tag) { return tag.getId() % 10 == 0; });
+        benchmark::DoNotOptimize(removed);
+
+        state.PauseTiming();
+        tally.stop();
+        tags = {};
+        state.ResumeTiming();
+    }
+    tally.report(state);
+    state.SetItemsProcessed(state.iterations() * kTags);
+}
+BENCHMARK(BM_VectorOps_EraseIf)->Iterations(3)->Unit(benchmark::kMillisecond);
@@ -1,10 +1,97 @@
 // Header guard - prevents this file from being included more than once
 #pragma once
 
-// sstream for std::ostringstream (building strings from non-string types)
-#include <sstream>
+// cstddef for std::size_t
+#include <cstddef>
+// cstdint for std::uintptr_t (a pointer's bits as an integer)
+#include <cstdint>
+// ostream so a ShortAddr can be written with <<
+#include <ostream>
 // string for std::string
 #include <string>
+// string_view to look at the characters without copying them
+#include <string_view>
+
+// The short hex form of a pointer (last 5 hex characters), stored right here
+// in a tiny fixed-size array — no heap allocation, no string stream, no locale.
+//
+// You can stream it (std::cout << shortAddr(this)), view it as a
+// std::string_view, or turn it into a std::string with str().
+struct ShortAddr {
+    static constexpr std::size_t kMaxChars = 5;
+
+    char chars[kMaxChars] = {};
+    std::size_t size = 0;
+
+    constexpr std::string_view view() const { return std::string_view(chars, size); }
+    constexpr operator std::string_view() const { return view(); }
+    std::string str() const { return std::string(chars, size); }
+
+    friend std::ostream& operator<<(std::ostream& os, const ShortAddr& addr) {
+        return os << addr.view();
+    }
+};
+
+// Builds the ShortAddr for a pointer value given as an integer.
+// constexpr, so it can run at compile time (pointer casts can't, so the
+// pointer overloads below just convert and call this).
+//
+// It produces exactly what the old version did: print the pointer with
+// "std::ostream << ptr", then keep the last 5 characters. What the stream
+// prints depends on the standard library, so we copy each one:
+//   - MSVC:       all hex digits, zero-padded to pointer width, uppercase
+//                 (0x00007FFD3A2B1C80 -> "00007FFD3A2B1C80" -> "B1C80")
+//   - libstdc++,
+//     libc++:     "0x" + lowercase hex without leading zeros
+//                 (-> "0x7ffd3a2b1c80" -> "b1c80")
+// and a null pointer prints as "0" (libstdc++), "0x0" (libc++ on Apple) or
+// "(nil)" (libc++ on glibc).
+constexpr ShortAddr shortAddrFromBits(std::uintptr_t bits) {
+    // Longest possible full text: "0x" plus 16 hex digits
+    char full[2 + 2 * sizeof(std::uintptr_t)] = {};
+    std::size_t length = 0;
+
+#if defined(_MSVC_STL_VERSION) || defined(_CPPLIB_VER)
+    constexpr char digits[] = "0123456789ABCDEF";
+    for (std::size_t i = 0; i < 2 * sizeof(std::uintptr_t); ++i) {
+        const std::size_t shift = 4 * (2 * sizeof(std::uintptr_t) - 1 - i);
+        full[length++] = digits[(bits >> shift) & 0xF];
+    }
+#else
+    constexpr char digits[] = "0123456789abcdef";
+    if (bits == 0) {
+#if defined(_LIBCPP_VERSION) && defined(__GLIBC__)
+        constexpr std::string_view null = "(nil)";
+#elif defined(_LIBCPP_VERSION)
+        constexpr std::string_view null = "0x0";
+#else
+        constexpr std::string_view null = "0";
+#endif
+        for (char c : null) {
+            full[length++] = c;
+        }
+    } else {
+        full[length++] = '0';
+        full[length++] = 'x';
+        // Count the hex digits so we can write them most-significant first
+        std::size_t digitCount = 0;
+        for (std::uintptr_t rest = bits; rest != 0; rest >>= 4) {
+            ++digitCount;
+        }
+        for (std::size_t i = digitCount; i > 0; --i) {
+            full[length++] = digits[(bits >> (4 * (i - 1))) & 0xF];
+        }
+    }
+#endif
+
+    // Take the last 5 characters (or the whole text if shorter)
+    ShortAddr result;
+    const std::size_t start = length > ShortAddr::kMaxChars ? length - ShortAddr::kMaxChars : 0;
+    for (std::size_t i = start; i < length; ++i) {
+        result.chars[result.size++] = full[i];
+    }
+    return result;
+}
 
 // Converts any pointer to a short hex string (last 5 hex characters).
 // This makes console output easier to read by trimming the leading zeros
@@ -14,15 +101,22 @@
 //
 // Works on any OS and pointer size — we just take the last 5 characters
 // of the full hex address, which is enough to tell addresses apart.
-inline std::string shortAddr(const void* ptr) {
-    // Convert the pointer to a hex string using a string stream
-    std::ostringstream oss;
-    oss << ptr;
-    std::string full = oss.str();
-    // Take the last 5 characters (or the whole string if shorter)
-    const std::size_t len = 5;
-    if (full.size() <= len) {
-        return full;
+inline ShortAddr shortAddr(const void* ptr) {
+    return shortAddrFromBits(reinterpret_cast<std::uintptr_t>(ptr));
+}
+
+// Appends the short address to an existing buffer (no temporary string)
+inline void appendShortAddr(std::string& out, const void* ptr) {
+    out.append(shortAddr(ptr).view());
+}
+
+// Writes the short address into a raw character buffer with room for at
+// least ShortAddr::kMaxChars characters. Returns one past the last character
+// written (no terminating '\0' is added).
+inline char* appendShortAddr(char* out, const void* ptr) {
+    const ShortAddr addr = shortAddr(ptr);
+    for (std::size_t i = 0; i < addr.size; ++i) {
+        *out++ = addr.chars[i];
     }
-    return full.substr(full.size() - len);
+    return out;
 }
@@ -0,0 +1,97 @@
+// Header guard - prevents this file from being included more than once
+#pragma once
+
+// Include the Bio struct, what an ArenaBio converts to and from
+#include "Bio.h"
+// Include Counted so ArenaBio copies, moves and heap bytes are counted
+#include "InstanceCounters.h"
+
+// compare for std::strong_ordering
+#include <compare>
+// cstddef for std::size_t
+#include <cstddef>
+// cstdint for the 32-bit offsets
+#include <cstdint>
+// memory for std::unique_ptr, which owns the one block
+#include <memory>
+// string for appendTo()
+#include <string>
+// string_view for the accessors
+#include <string_view>
+
+// The same data as Bio, with all three strings in ONE heap block.
+//
+// A Bio is three std::strings. Each keeps up to 15 characters in its own
+// small buffer, but anything longer ("Computer Science", most full names)
+// gets its own heap allocation — so one Bio can mean three allocations, and
+// copying it three more.
+//
+// ArenaBio works like a tiny monotonic arena: it measures the three strings,
+// allocates one block that fits all of them, and copies them in back to back.
+// It only remembers where title and department start; nothing is ever freed
+// or resized on its own, the block goes away as a whole.
+//
+//   block:  [Scott Hadzik][Professor][Computer Science]
+//            ^0            ^titleStart_ ^departmentStart_  ^size_
+//
+// So building or copying an ArenaBio is one allocation and one memcpy,
+// whatever the lengths, and the object itself is 24 bytes instead of 104.
+// The price: the strings are read-only (string_view accessors) — to change
+// one, build a new ArenaBio (or convert to a Bio with toBio()).
+//
+// A moved-from ArenaBio holds no block and reads as three empty strings.
+class ArenaBio {
+public:
+    // Copies the three strings into one new block.
+    // Throws std::length_error if they add up to 4 GB or more.
+    ArenaBio(std::string_view name, std::string_view title, std::string_view department, int year);
+
+    // Converts from a Bio (copies its strings into one block)
+    explicit ArenaBio(const Bio& bio);
+
+    // Copy: one allocation and one memcpy for all three strings
+    ArenaBio(const ArenaBio& other);
+    ArenaBio& operator=(const ArenaBio& other);
+
+    // Move: steals the block. The offsets are reset too, so the source reads
+    // as empty strings instead of pointing past a missing block.
+    ArenaBio(ArenaBio&& other) noexcept;
+    ArenaBio& operator=(ArenaBio&& other) noexcept;
+
+    ~ArenaBio() = default;
+
+    // Views into the block (valid until this ArenaBio is changed or destroyed)
+    std::string_view name() const { return std::string_view(chars_.get(), titleStart_); }
+    std::string_view title() const {
+        return std::string_view(chars_.get() + titleStart_, departmentStart_ - titleStart_);
+    }
+    std::string_view department() const {
+        return std::string_view(chars_.get() + departmentStart_, size_ - departmentStart_);
+    }
+    int year() const { return year_; }
+
+    // Converts back to a Bio (three new std::strings)
+    Bio toBio() const;
+
+    // Same output as Bio::print() and Bio::appendTo()
+    void print() const;
+    void appendTo(std::string& out) const;
+
+    // Bytes in the block (the total length of the three strings)
+    std::size_t heapBytes() const { return size_; }
+
+    // Compares contents, like Bio: name, then title, department and year
+    bool operator==(const ArenaBio& other) const;
+    std::strong_ordering operator<=>(const ArenaBio& other) const;
+
+private:
+    // Allocates the block and copies the strings into it
+    void assign(std::string_view name, std::string_view title, std::string_view department);
+
+    std::unique_ptr<char[]> chars_;     // the block (nullptr when all strings are empty, or after a move)
+    std::uint32_t titleStart_ = 0;      // name is [0, titleStart_)
+    std::uint32_t departmentStart_ = 0; // title is [titleStart_, departmentStart_)
+    std::uint32_t size_ = 0;            // department is [departmentStart_, size_)
+    int year_ = 0;
+    NAMETAG_NO_UNIQUE_ADDRESS Counted<ArenaBio> counted_; // lifecycle counters (no space)
+};
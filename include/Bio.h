@@ -1,6 +1,15 @@
 // Header guard - prevents this file from being included more than once
 #pragma once
 
+// Include Counted so Bio copies and moves are counted
+#include "InstanceCounters.h"
+
+// compare for std::strong_ordering
+#include <compare>
+// cstddef for std::size_t
+#include <cstddef>
+// functional for std::hash
+#include <functional>
 // iostream for std::cout in print()
 #include <iostream>
 // string for std::string members
@@ -30,8 +39,34 @@ struct Bio {
     std::string department; // department they belong to
     int year;               // year they joined
 
+    // Counts Bio creations, copies and moves (see InstanceCounters.h).
+    // It is empty and takes no space, and since it comes last, Bio{name,
+    // title, department, year} still works. The "{}" (a default member
+    // initializer) tells the compiler that leaving it out of that list is
+    // intended, so -Wextra doesn't warn about a missing initializer.
+    NAMETAG_NO_UNIQUE_ADDRESS Counted<Bio> counted{};
+
     // A struct can have member functions just like a class.
     // const means this function does not modify any members.
     // Prints all Bio fields to the console, separated by commas.
     void print() const;
+
+    // Appends exactly what print() writes to out, without touching std::cout.
+    void appendTo(std::string& out) const;
+
+    // "= default" asks the compiler to compare member by member, in the order
+    // they are declared: name, then title, department and year. Two Bios are
+    // equal when their CONTENTS are equal — where they live doesn't matter.
+    // (counted always compares equal, see InstanceCounters.h.)
+    bool operator==(const Bio& other) const = default;
+    std::strong_ordering operator<=>(const Bio& other) const = default;
+};
+
+// Lets a Bio be a key in std::unordered_set / std::unordered_map.
+// Hashes the same fields == compares, so equal Bios always hash the same.
+// Bio's fields are public and can change at any time, so nothing is cached:
+// every call hashes all three strings.
+template <>
+struct std::hash<Bio> {
+    std::size_t operator()(const Bio& bio) const noexcept;
 };
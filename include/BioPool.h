@@ -0,0 +1,98 @@
+// Header guard - prevents this file from being included more than once
+#pragma once
+
+// Include the Bio struct since the pool hands out Bio-sized slots
+#include "Bio.h"
+
+// cstddef for std::size_t
+#include <cstddef>
+
+// How a FancyNameTag allocates the Bio it owns.
+//
+// Heap is the original behavior: every constructor and copy calls "new Bio"
+// and the destructor calls "delete". That is simple, but when millions of tags
+// are created and destroyed, most of the time goes into malloc/free.
+//
+// Pool reuses Bio-sized slots from a thread-local free list (see BioPool below),
+// so a destroyed tag's slot is handed straight to the next tag on that thread
+// without going back to the global heap.
+//
+// Shared is copy-on-write: copying a tag shares the SAME immutable Bio and
+// bumps an atomic reference count instead of deep copying. The Bio is only
+// cloned when a mutator runs on a tag that shares it. The count is atomic, so
+// tags sharing a Bio can be copied and destroyed on different threads.
+enum class BioAlloc {
+    Heap,  // new / delete (default)
+    Pool,  // thread-local BioPool
+    Shared // reference-counted, copy-on-write
+};
+
+// Returns the process-wide strategy used when a constructor isn't told one.
+BioAlloc defaultBioAlloc();
+
+// Changes the process-wide strategy. Only affects tags created afterward —
+// every tag remembers the strategy that allocated its Bio so it can free it.
+void setDefaultBioAlloc(BioAlloc alloc);
+
+// A thread-local, size-class pool for small fixed-size objects like Bio.
+//
+// Requests are rounded up to a multiple of kGranularity bytes, and each size
+// class keeps its own free list. Slots are carved out of large chunks, so one
+// chunk allocation serves many objects. Freed slots go onto the free list of
+// the thread that frees them (not back to the heap), and chunks live until the
+// program exits.
+//
+// Requests larger than kMaxSize fall through to the global heap. A 0-byte
+// request gets a slot from the smallest class.
+class BioPool {
+public:
+    // Every slot is aligned (and sized) to a multiple of this many bytes
+    static constexpr std::size_t kGranularity = alignof(std::max_align_t);
+    // Largest request served from a size class
+    static constexpr std::size_t kMaxSize = 256;
+    // Number of slots carved out of each chunk when a free list runs dry
+    static constexpr std::size_t kSlotsPerChunk = 256;
+
+    // Returns uninitialized memory for an object of the given size.
+    // Use placement new to construct the object in it.
+    static void* allocate(std::size_t bytes);
+
+    // Gives the memory back to this thread's free list.
+    // bytes must be the same value that was passed to allocate().
+    static void deallocate(void* slot, std::size_t bytes) noexcept;
+
+    // Makes sure this thread has at least count free slots for objects of the
+    // given size, using ONE chunk allocation for whatever is missing.
+    static void reserve(std::size_t count, std::size_t bytes = sizeof(Bio));
+
+    // Number of free slots this thread currently holds for the given size.
+    static std::size_t freeSlots(std::size_t bytes = sizeof(Bio));
+};
+
+// Allocates a copy of bio using the given strategy.
+Bio* createBio(BioAlloc alloc, const Bio& bio);
+
+// Same, but moves bio's strings into the new Bio instead of copying them.
+Bio* createBio(BioAlloc alloc, Bio&& bio);
+
+// Copies a Bio owned by another tag with the same strategy.
+// Heap and Pool make a deep copy; Shared returns the same pointer with its
+// reference count incremented.
+Bio* copyBio(BioAlloc alloc, Bio* bio);
+
+// Destroys a Bio made by createBio() or copyBio() with the SAME strategy.
+// For Shared, this only drops one reference; the last one frees the Bio.
+// Passing nullptr is safe and does nothing (just like delete).
+void destroyBio(BioAlloc alloc, Bio* bio) noexcept;
+
+// Call before modifying a Bio. If it is Shared and someone else still holds a
+// reference, this clones it, drops our reference to the original and returns
+// the clone. Otherwise it returns bio unchanged.
+Bio* makeBioUnique(BioAlloc alloc, Bio* bio);
+
+// Bytes one createBio() with this strategy takes from the heap or the pool
+// (a pool slot counts in full, and Shared includes its reference count header).
+std::size_t bioAllocationBytes(BioAlloc alloc);
+
+// Number of tags referring to this Bio (always 1 for Heap and Pool).
+std::size_t bioUseCount(BioAlloc alloc, const Bio* bio);
@@ -0,0 +1,129 @@
+// Header guard - prevents this file from being included more than once
+#pragma once
+
+// Include the Bio struct since the slab stores Bios
+#include "Bio.h"
+
+// atomic for the chunk directory and slot generations
+#include <atomic>
+// cstddef for std::size_t
+#include <cstddef>
+// cstdint for the handle's index and generation bits
+#include <cstdint>
+// new for std::launder
+#include <new>
+
+// Names one Bio in the BioSlab: which slot, and which of that slot's lives.
+//
+// 4 bytes, half a Bio*: a 24-bit slot index (up to ~16M live Bios) and an
+// 8-bit generation. The generation buys something a pointer can't: every time
+// a slot is freed its generation goes up, so an old handle to a reused slot
+// no longer matches and is caught instead of silently reading someone else's
+// Bio.
+//
+// The catch of 8 bits: a slot's generation comes back around after 128 Bios
+// have lived in it (each life uses one odd value), so a handle that is stale
+// by exactly a multiple of 128 lives matches again. Stale handles are a bug
+// the check catches almost always, not a guarantee.
+struct BioHandle {
+    // index of a handle that refers to nothing (a moved-from tag holds one)
+    static constexpr std::uint32_t kNoIndex = 0xFFFFFFu;
+
+    std::uint32_t index : 24 = kNoIndex;
+    std::uint32_t generation : 8 = 0;
+
+    bool empty() const { return index == kNoIndex; }
+};
+static_assert(sizeof(BioHandle) == 4, "BioHandle should pack into one 32-bit word");
+
+// One process-wide slab of Bio slots, addressed by BioHandle.
+//
+// Slots are carved out of fixed-size chunks that are never freed or moved, so
+// a Bio stays at the same address for as long as it is alive and getBio() can
+// keep returning a plain reference. Freed slot indices go onto a shared free
+// list (behind a mutex) and are reused by the next create().
+//
+// A slot's generation is odd while it holds a Bio and even while it is free.
+// create() and destroy() each bump it by one, so a handle (which remembers the
+// odd value it was given) only matches while that same Bio is alive.
+//
+// get() takes no lock: the chunk directory only ever grows, and a live handle's
+// slot can't be reused until its owner destroys it. It is defined here in the
+// header because it runs on every getBio(): as an out-of-line call it was about
+// twice the cost of following a Bio* when scanning a million tags.
+class BioSlab {
+public:
+    // Slots per chunk (each chunk is one allocation)
+    static constexpr std::size_t kSlotsPerChunk = 1024;
+    // Most chunks the slab can grow to (kSlotsPerChunk * kMaxChunks slots in all).
+    // Every index fits in BioHandle's 24 bits, and the chunk that would hold
+    // BioHandle::kNoIndex is never created.
+    static constexpr std::size_t kMaxChunks = (std::size_t{1} << 24) / kSlotsPerChunk - 1;
+
+    // Copies (or moves) bio into a free slot and returns its handle.
+    // Throws std::length_error if every slot is in use.
+    static BioHandle create(const Bio& bio);
+    static BioHandle create(Bio&& bio);
+
+    // The Bio a handle refers to. Throws std::logic_error if the handle is
+    // empty or stale (its Bio was destroyed, and the slot perhaps reused).
+    static Bio& get(BioHandle handle) {
+        Bio* bio = find(handle);
+        if (!bio) {
+            throwBadHandle(handle);
+        }
+        return *bio;
+    }
+
+    // Destroys the Bio and frees its slot. Empty or stale handles are ignored.
+    static void destroy(BioHandle handle) noexcept;
+
+    // Returns true while the handle's Bio is alive
+    static bool isLive(BioHandle handle) { return find(handle) != nullptr; }
+
+    // Number of Bios alive in the slab right now
+    static std::size_t liveCount();
+
+private:
+    // One slot: the generation that says whether it holds a Bio (odd = yes),
+    // then room for one. The generation goes first so checking it pulls in
+    // the same cache line as the start of the Bio, which the caller reads next.
+    // Line-aligned, so a slot is always exactly two cache lines (a 104-byte
+    // heap Bio straddles three half the time).
+    struct alignas(64) Slot {
+        std::atomic<std::uint8_t> generation{0}; // wraps like BioHandle's 8 bits
+        alignas(Bio) unsigned char storage[sizeof(Bio)];
+    };
+
+    // The handle's Bio, or nullptr if the handle is empty or stale
+    static Bio* find(BioHandle handle) {
+        const std::size_t chunk = handle.index / kSlotsPerChunk;
+        if (chunk >= kMaxChunks) {
+            return nullptr; // includes BioHandle::kNoIndex
+        }
+        // acquire: pairs with the release store that published the chunk
+        Slot* slots = chunks_[chunk].load(std::memory_order_acquire);
+        if (!slots) {
+            return nullptr;
+        }
+        Slot& slot = slots[handle.index % kSlotsPerChunk];
+        if (slot.generation.load(std::memory_order_relaxed) != handle.generation) {
+            return nullptr;
+        }
+        return std::launder(reinterpret_cast<Bio*>(slot.storage));
+    }
+
+    // The slot for an index that has been handed out (caller holds the free-list lock)
+    static Slot& slotAt(std::uint32_t index);
+    // Takes a free slot index, growing by one chunk when needed (caller holds the lock)
+    static std::uint32_t claimSlot();
+    // Shared by both create() overloads
+    template <typename BioArg>
+    static BioHandle createIn(BioArg&& bio);
+
+    [[noreturn]] static void throwBadHandle(BioHandle handle);
+
+    // Chunk c holds slots [c * kSlotsPerChunk, (c + 1) * kSlotsPerChunk).
+    // Entries go from nullptr to a chunk exactly once and are never freed.
+    static std::atomic<Slot*> chunks_[kMaxChunks];
+};
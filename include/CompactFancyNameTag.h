@@ -0,0 +1,83 @@
+// Header guard - prevents this file from being included more than once
+#pragma once
+
+// Include BioSlab since the Bio lives in the slab and we keep its handle
+#include "BioSlab.h"
+// Include CompanyId — the company name is interned, not stored per tag
+#include "CompanyTable.h"
+
+// iostream for std::cout in print()
+#include <iostream>
+// stdexcept for std::invalid_argument
+#include <stdexcept>
+// string for std::string parameters
+#include <string>
+// string_view for the company and appendTo() arguments
+#include <string_view>
+
+// Same public API as FancyNameTag, but the Bio is named by a 32-bit BioHandle
+// (24-bit slab index + 8-bit generation) instead of a Bio*.
+//
+// FancyNameTag is id + CompanyId + Bio* + allocation strategy (+ the instance
+// counter's empty member): 24 bytes with padding. Here the Bio always lives in
+// the process-wide BioSlab, so there is no strategy to remember and the tag is
+// just id + CompanyId + BioHandle: 12 bytes, five tags per cache line.
+//
+// The generation is what a pointer can't give you: destroying a tag bumps its
+// slot's generation, so a stale copy of the handle (a use after free) makes
+// getBio() throw std::logic_error instead of reading whoever got the slot next.
+//
+// getBio() still returns a reference — slab slots never move.
+// After a move the source's handle is empty (index BioHandle::kNoIndex), just
+// as FancyNameTag's bio_ is nullptr: hasBio() returns false and print() shows
+// "(moved)".
+class CompactFancyNameTag {
+public:
+    // Constructor: validates, then copies bio into the slab
+    CompactFancyNameTag(int id, std::string_view company, const Bio& bio);
+
+    // Destructor: frees the slab slot (and makes every copy of the handle stale)
+    ~CompactFancyNameTag();
+
+    // Copy constructor: deep copies the Bio into a new slab slot
+    CompactFancyNameTag(const CompactFancyNameTag& other);
+
+    // Move constructor: takes the handle; the source is left empty
+    CompactFancyNameTag(CompactFancyNameTag&& other) noexcept;
+
+    // Copy assignment: copies the Bio first, then frees ours (strong guarantee)
+    CompactFancyNameTag& operator=(const CompactFancyNameTag& other);
+
+    // Move assignment: frees our Bio and takes the source's handle
+    CompactFancyNameTag& operator=(CompactFancyNameTag&& other) noexcept;
+
+    // Prints all data in the same columns as FancyNameTag::print, with the Bio's
+    // location shown as SLAB <address>
+    void print(const std::string& label, const std::string& state = "") const;
+
+    // Appends exactly what print() writes to out (see FancyNameTag::appendTo)
+    void appendTo(std::string& out, std::string_view label, std::string_view state = "") const;
+
+    // Same getters and setters as FancyNameTag.
+    // getBio() throws std::logic_error on a moved-from tag.
+    int getId() const;
+    const std::string& getCompany() const;
+    CompanyId getCompanyId() const;
+    const Bio& getBio() const;
+
+    void setId(int id);
+    void setCompany(std::string_view company);
+    void setBio(const Bio& bio);
+    void setBioTitle(const std::string& title);
+
+    // Returns true unless this object was moved from
+    bool hasBio() const;
+
+    // The slab handle (copy it to check later whether this Bio still exists)
+    BioHandle getBioHandle() const;
+
+private:
+    int id_;             // numeric identifier
+    CompanyId company_;  // interned company name
+    BioHandle bio_;      // slab slot + generation (empty after a move)
+};
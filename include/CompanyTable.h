@@ -0,0 +1,69 @@
+// Header guard - prevents this file from being included more than once
+#pragma once
+
+// cstddef for std::size_t
+#include <cstddef>
+// cstdint for std::uint32_t
+#include <cstdint>
+// optional for lookups that may not find anything
+#include <optional>
+// string for std::string
+#include <string>
+// string_view so lookups never need to build a std::string
+#include <string_view>
+
+// A compact handle for an interned company name.
+//
+// Almost every tag carries one of a few dozen company names. Instead of each
+// tag owning its own std::string copy (32 bytes, plus a heap allocation when
+// the name is longer than the small-string buffer, e.g. "Weber State University"),
+// the name is stored ONCE in the CompanyTable and tags store this 4-byte id.
+//
+// Two ids are equal exactly when their names are equal, so comparing companies
+// is an integer compare. Copying or moving an id is just copying an integer.
+//
+// A default-constructed CompanyId refers to the empty string.
+class CompanyId {
+public:
+    CompanyId() = default;
+
+    // The raw index into the table
+    std::uint32_t value() const { return value_; }
+
+    // The interned name. The reference stays valid for the whole program.
+    const std::string& str() const;
+
+    bool empty() const { return value_ == 0; }
+
+    bool operator==(const CompanyId& other) const = default;
+
+private:
+    friend class CompanyTable;
+    explicit CompanyId(std::uint32_t value) : value_(value) {}
+
+    std::uint32_t value_ = 0;
+};
+
+// The process-wide intern table behind CompanyId.
+//
+// Names are never removed, so every interned string keeps a fixed address for
+// the life of the program. Looking up a name by id never locks; interning takes
+// a shared (reader) lock when the name already exists and an exclusive lock
+// only the first time a new name is seen. Safe to use from any thread.
+class CompanyTable {
+public:
+    // Returns the id for company, adding it to the table the first time
+    static CompanyId intern(std::string_view company);
+
+    // Returns the id for company only if it has already been interned
+    static std::optional<CompanyId> find(std::string_view company);
+
+    // Returns the interned name for an id
+    static const std::string& name(CompanyId id);
+
+    // Number of distinct names interned so far (including the empty name)
+    static std::size_t size();
+
+    // Bytes used by the table: the strings, their heap buffers and the index
+    static std::size_t memoryUsage();
+};
@@ -3,23 +3,42 @@
 
 // Include the Bio struct since we store a pointer to one
 #include "Bio.h"
-
+// Include BioAlloc so each tag can choose how its Bio is allocated
+#include "BioPool.h"
+// Include CompanyId — the company name is interned, not stored per tag
+#include "CompanyTable.h"
+// Include Counted so FancyNameTag copies, moves and Bio bytes are counted
+#include "InstanceCounters.h"
+
+// compare for std::strong_ordering
+#include <compare>
+// cstddef for std::size_t
+#include <cstddef>
+// cstdint for the 32-bit cached hash
+#include <cstdint>
+// functional for std::hash
+#include <functional>
 // iostream for std::cout in print()
 #include <iostream>
 // stdexcept for std::invalid_argument
 #include <stdexcept>
 // string for std::string members and parameters
 #include <string>
+// string_view for appendTo() arguments
+#include <string_view>
 
 // Same idea as NameTag, but with a heap-allocated Bio.
-// Because it owns a raw pointer, we must implement at minimum:
+// Because it owns a raw pointer, we must implement all five (the "rule of five"):
 //   - Destructor: to free the heap memory
 //   - Copy constructor: to perform a deep copy (avoid shallow copy danger)
 //   - Move constructor: to efficiently transfer ownership
+//   - Copy assignment: deep copy into an EXISTING tag (freeing its old Bio)
+//   - Move assignment: take over another tag's Bio (freeing our old one)
 //
-// We delete the copy and move assignment operators to keep this example simple.
-// In modern C++, you'd use std::unique_ptr<Bio> instead of Bio* and get all
-// this behavior automatically — we'll cover that in the next Code Together.
+// The assignments are what let std::sort, vector::erase and vector::insert
+// shuffle tags around. In modern C++, you'd use std::unique_ptr<Bio> instead of
+// Bio* and get all this behavior automatically — we'll cover that in the next
+// Code Together.
 //
 // Like NameTag, this is a class because we enforce invariants:
 //   - id_ must be positive
@@ -33,13 +52,45 @@ class FancyNameTag {
 public:
     // Constructor: creates a new Bio on the heap from the given bio
 
-    FancyNameTag(int id, const std::string& company, const Bio& bio);
+    // The optional alloc argument picks how the Bio is allocated for THIS tag
+    // (see BioAlloc in BioPool.h). A default argument is evaluated at every
+    // call, so leaving it out uses whatever the process-wide default is now.
+
+    // company is only looked up in the CompanyTable, so a string_view is
+    // enough (no std::string is built for a string literal).
+
+    FancyNameTag(int id, std::string_view company, const Bio& bio,
+                 BioAlloc alloc = defaultBioAlloc());
+
+    // Same, for a Bio the caller no longer needs — a temporary such as
+    // FancyNameTag(1, "WSU", {"Scott", "Professor", ...}) picks this one.
+    // The new Bio is move-constructed from it, so its strings are stolen
+    // rather than copied.
+
+    FancyNameTag(int id, std::string_view company, Bio&& bio,
+                 BioAlloc alloc = defaultBioAlloc());
+
+    // A "passkey": only makeFancyNameTags() (see FancyNameTagBatch.h) can
+    // create one, so only it can call the constructor below. The key is
+    // public, so std::vector::emplace_back can still pass it along.
+    class BatchKey {
+        BatchKey() = default;
+        friend class FancyNameTagBatchBuilder;
+    };
+
+    // Batch constructor: takes ownership of a Bio that the batch already
+    // validated and allocated with alloc. It skips validation, so it must
+    // never be reachable from outside the batch code. Only logging can
+    // throw (std::bad_alloc); the Bio then still belongs to the caller.
+
+    FancyNameTag(BatchKey, int id, CompanyId company, Bio* bio, BioAlloc alloc);
 
 	// Destructor: frees the heap-allocated Bio
 
     ~FancyNameTag();
 
     // Copy constructor: performs a deep copy of the Bio
+    // (the copy uses the same allocation strategy as the original)
 
     FancyNameTag(const FancyNameTag& other);
 
@@ -63,18 +114,29 @@ public:
 
     FancyNameTag(FancyNameTag&& other) noexcept;
 
-    // Delete copy and move assignment operators — we're keeping this example simple.
-    // If you need to reassign a FancyNameTag, create a new one instead.
-    // (In real code, you'd use std::unique_ptr<Bio> which handles this automatically.)
+    // Copy assignment: this tag already exists and owns a Bio, so we build the
+    // copy of other's Bio FIRST and only then free ours. If the copy throws,
+    // this tag is left exactly as it was (the "strong guarantee").
+    // The tag takes other's allocation strategy along with its Bio.
 
-    FancyNameTag& operator=(const FancyNameTag& other) = delete;
-    FancyNameTag& operator=(FancyNameTag&& other) = delete;
+    FancyNameTag& operator=(const FancyNameTag& other);
+
+    // Move assignment: frees our Bio and steals other's pointer. Nothing here
+    // can throw, so it is noexcept — which lets std::sort and vector::erase
+    // move tags instead of copying them.
+
+    FancyNameTag& operator=(FancyNameTag&& other) noexcept;
 
     // Prints all FancyNameTag data with a right-justified label and optional state on the right
     // Example: print("fOriginal", "unchanged") produces:
     //     fOriginal  STACK xxxxx  id=1  company="WSU"  bio={...} HEAP xxxxx  (unchanged)
     void print(const std::string& label, const std::string& state = "") const;
 
+    // Appends exactly what print(label, state) writes to out, without touching
+    // std::cout. Reuse the same string (call clear() between tags) and
+    // formatting allocates nothing once the string has grown large enough.
+    void appendTo(std::string& out, std::string_view label, std::string_view state = "") const;
+
     // Returns the id by value (int is small/cheap to copy, no reference needed).
     // No need for "const int" here - the caller gets their own copy,
     // so they can't modify our private id_ no matter what.
@@ -88,10 +150,24 @@ public:
 
     const std::string& getCompany() const;
 
+    // Returns the interned company handle. Comparing two handles is an integer
+    // compare, and equal handles always mean equal company names.
+
+    CompanyId getCompanyId() const;
+
     // Returns the Bio by const reference to avoid copying the entire struct.
 
     const Bio& getBio() const;
 
+    // Returns the strategy that allocated this tag's Bio.
+
+    BioAlloc getBioAlloc() const;
+
+    // Returns how many tags refer to this tag's Bio.
+    // Always 1 unless the tag uses BioAlloc::Shared (0 after a move).
+
+    std::size_t getBioUseCount() const;
+
     // Sets the id after validating it is positive.
     // This is how we allow modification while still enforcing our invariants.
 
@@ -99,10 +175,66 @@ public:
     // Sets the company name after validating it is not empty.
     // This is how we allow modification while still enforcing our invariants.
 
-    void setCompany(const std::string& company);
+    void setCompany(std::string_view company);
+
+    // Replaces the Bio after validating it (same rules as the constructor).
+    // The && version moves the caller's Bio in instead of copying it.
+
+    void setBio(const Bio& bio);
+    void setBio(Bio&& bio);
+
+    // Changes the Bio's title after validating it is not empty.
+    // With BioAlloc::Shared, the Bio is cloned first if other tags share it
+    // (copy-on-write), so those tags never see the change.
+    // The && version steals the caller's string buffer.
+
+    void setBioTitle(const std::string& title);
+    void setBioTitle(std::string&& title);
+
+    // Two tags are equal when their id, company and Bio CONTENTS are equal —
+    // two tags with separate copies of the same Bio are equal, just like a
+    // copy is equal to its original. A moved-from tag (no Bio) only equals
+    // another moved-from tag with the same id and company.
+    bool operator==(const FancyNameTag& other) const;
+    // Orders by id, then company name, then Bio (see Bio's <=>); a tag
+    // without a Bio comes before one with a Bio
+    std::strong_ordering operator<=>(const FancyNameTag& other) const;
+
+    // Hash of id, company and Bio contents. Hashing a Bio means hashing three
+    // strings, so it is done once, when the tag or its Bio changes (every
+    // constructor, assignment and setter), and cached here.
+    std::uint32_t hash() const;
 
 private:
+    // Shared by both constructors: BioArg is const Bio& or Bio
+    template <typename BioArg>
+    void construct(std::string_view company, BioArg&& bio);
+
+    // Shared by both setBio()s
+    template <typename BioArg>
+    void replaceBio(BioArg&& bio);
+
+    // Shared by both setBioTitle()s
+    template <typename TitleArg>
+    void replaceBioTitle(TitleArg&& title);
+
+    // Logs and records the "Constructor" lifecycle event (all constructors)
+    void logConstruction() const;
+
+    // Recomputes hash_ from id_, company_ and *bio_ (after any change)
+    void rehash() noexcept;
+
     int id_;            // numeric identifier (stack-allocated)
-    std::string company_; // company name (stack-allocated)
+    CompanyId company_; // interned company name (a 4-byte handle into CompanyTable)
     Bio* bio_;          // pointer to a Bio on the heap (requires manual management)
+    BioAlloc alloc_;    // how bio_ was allocated, so the destructor frees it the same way
+    std::uint32_t hash_; // cached hash() (fits in what was padding: still 24 bytes)
+    NAMETAG_NO_UNIQUE_ADDRESS Counted<FancyNameTag> counted_; // lifecycle counters (no space)
+};
+
+// Lets a FancyNameTag be a key in std::unordered_set / std::unordered_map.
+// Returns the cached hash, so hashing a tag never reads its Bio.
+template <>
+struct std::hash<FancyNameTag> {
+    std::size_t operator()(const FancyNameTag& tag) const noexcept { return tag.hash(); }
 };
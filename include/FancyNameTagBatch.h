@@ -0,0 +1,92 @@
+// Header guard - prevents this file from being included more than once
+#pragma once
+
+// Include the Bio struct for the Bio column
+#include "Bio.h"
+// Include BioAlloc to choose how the batch's Bios are allocated
+#include "BioPool.h"
+// Include FancyNameTag, the type the batch builds
+#include "FancyNameTag.h"
+
+// cstddef for std::size_t
+#include <cstddef>
+// cstdint for std::uint8_t
+#include <cstdint>
+// span for non-owning views of the input columns
+#include <span>
+// string for the company column and error messages
+#include <string>
+// vector for the built tags and the error list
+#include <vector>
+
+// Builds many FancyNameTags at once from columnar input: one span of ids,
+// one of companies and one of Bios, where row i of every column describes
+// tag i.
+//
+// Building tags one at a time with the FancyNameTag constructor validates,
+// interns the company and allocates a Bio per tag, and throws on the first
+// bad row. The batch instead:
+//   1. validates each column in its own tight loop (no branches, so the
+//      compiler can vectorize the simple ones), collecting every problem of
+//      every row instead of stopping at the first
+//   2. reserves pool slots for all valid rows with ONE chunk allocation
+//      (BioPool::reserve), then hands them out with no further allocation
+//   3. constructs the tags directly in a vector reserved to the right size
+//
+// Bad rows don't throw; they are reported in FancyNameTagBatch::errors and
+// skipped. That includes a row whose company can't be interned because the
+// CompanyTable is full. Only mismatched column lengths throw std::invalid_argument.
+
+// The invariants a row can break, one bit each (see BatchRowError::problems)
+enum class BatchProblem : std::uint8_t {
+    BadId = 1 << 0,         // id must be positive
+    EmptyCompany = 1 << 1,  // company must not be empty
+    EmptyBioName = 1 << 2,  // bio name must not be empty
+    EmptyBioTitle = 1 << 3, // bio title must not be empty
+    BadBioYear = 1 << 4,    // bio year must be positive
+    CompanyTableFull = 1 << 5 // a new company, but the CompanyTable has no room left
+};
+
+// One rejected row
+struct BatchRowError {
+    std::size_t row;        // index into the input columns
+    std::uint8_t problems;  // BatchProblem bits, OR'ed together
+
+    // True if this row broke the given invariant
+    bool has(BatchProblem problem) const {
+        return (problems & static_cast<std::uint8_t>(problem)) != 0;
+    }
+
+    // Every problem in words, e.g. "id must be positive; bio title must not be empty"
+    std::string problemText() const;
+
+    // The same, prefixed with the row: "row 3: id must be positive; ..."
+    std::string describe() const;
+};
+
+// The result of one batch
+struct FancyNameTagBatch {
+    std::vector<FancyNameTag> tags;      // one tag per valid row, in input order
+    std::vector<std::size_t> rows;       // rows[i] is the input row that built tags[i]
+    std::vector<BatchRowError> errors;   // one entry per rejected row, in input order
+};
+
+// Builds one tag per valid row, copying each Bio.
+//
+// alloc defaults to BioAlloc::Pool so all the Bios come out of a single chunk;
+// BioAlloc::Shared is pooled the same way, and BioAlloc::Heap still calls new
+// once per Bio.
+FancyNameTagBatch makeFancyNameTags(std::span<const int> ids,
+                                    std::span<const std::string> companies,
+                                    std::span<const Bio> bios,
+                                    BioAlloc alloc = BioAlloc::Pool);
+
+// Same, but MOVES each valid row's Bio into its tag instead of copying it:
+//
+//   FancyNameTagBatch batch = makeFancyNameTags(ids, companies, std::move(bios));
+//
+// Bios of rejected rows are left untouched.
+FancyNameTagBatch makeFancyNameTags(std::span<const int> ids,
+                                    std::span<const std::string> companies,
+                                    std::vector<Bio>&& bios,
+                                    BioAlloc alloc = BioAlloc::Pool);
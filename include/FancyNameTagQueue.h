@@ -0,0 +1,133 @@
+// Header guard - prevents this file from being included more than once
+#pragma once
+
+// Include FancyNameTag, the type the queue hands over
+#include "FancyNameTag.h"
+
+// atomic for the positions, sequence numbers and wake-up counters
+#include <atomic>
+// cstddef for std::size_t
+#include <cstddef>
+// cstdint for std::uint32_t
+#include <cstdint>
+// memory for std::unique_ptr (the cell array)
+#include <memory>
+// optional for pops that may not get anything
+#include <optional>
+// span for batch pushes
+#include <span>
+// vector for batch pops
+#include <vector>
+
+// How a blocking push()/pop() waits when the queue is full/empty.
+enum class QueueWait {
+    Spin,  // keep retrying (yielding now and then): lowest latency, burns a core
+    Block  // sleep until the other side makes progress (std::atomic::wait)
+};
+
+// A bounded multi-producer, multi-consumer queue that hands FancyNameTags
+// from one thread to another by MOVING them.
+//
+// Copying a tag into a std::deque and out again deep-copies its Bio twice.
+// This queue only ever uses FancyNameTag's noexcept move constructor: a push
+// moves the tag into a slot, a pop moves it out. Nothing is copied, and
+// because nothing it does can throw, a failed push leaves the caller's tag
+// untouched.
+//
+// It is Dmitry Vyukov's bounded MPMC queue: a ring of cells, each with a
+// sequence number that says whose turn it is. A producer claims a position
+// with one compare-and-swap on the shared enqueue position, fills its cell
+// and bumps the cell's sequence; consumers do the mirror image. There is no
+// lock, and producers and consumers only meet at the cell they both use.
+//
+// Batch operations claim a run of positions with ONE compare-and-swap, so
+// moving 64 tags costs one contended atomic instead of 64.
+//
+// The try* functions never wait. push()/pop() wait in the QueueWait mode
+// given to the constructor. close() wakes every waiter: pushes fail from then
+// on, and pops drain what is left and then report the queue empty.
+class FancyNameTagQueue {
+public:
+    // capacity is rounded up to a power of two (at least 2)
+    explicit FancyNameTagQueue(std::size_t capacity, QueueWait wait = QueueWait::Block);
+
+    // Destroys any tags still in the queue
+    ~FancyNameTagQueue();
+
+    FancyNameTagQueue(const FancyNameTagQueue&) = delete;
+    FancyNameTagQueue& operator=(const FancyNameTagQueue&) = delete;
+
+    std::size_t capacity() const { return mask_ + 1; }
+
+    // Number of tags in the queue right now (other threads may change it
+    // before you look at the answer)
+    std::size_t sizeApprox() const;
+
+    // Moves tag in if there is room. Returns false (tag untouched) if full or closed.
+    bool tryPush(FancyNameTag&& tag) noexcept;
+
+    // Moves the first tags of the span in, as many as fit right now.
+    // Returns how many were moved; the rest are untouched.
+    std::size_t tryPushBatch(std::span<FancyNameTag> tags) noexcept;
+
+    // Moves the oldest tag out, if there is one
+    std::optional<FancyNameTag> tryPop() noexcept;
+
+    // Moves up to max tags out, oldest first, appending them to out.
+    // Returns how many. Only reserving room in out can throw, and that
+    // happens before anything leaves the queue.
+    std::size_t tryPopBatch(std::vector<FancyNameTag>& out, std::size_t max);
+
+    // Waits for room, then moves tag in. Returns false (tag untouched) if
+    // the queue is closed.
+    bool push(FancyNameTag&& tag);
+
+    // Waits until every tag of the span is moved in. Returns how many were
+    // moved, which is less than tags.size() only if the queue was closed.
+    std::size_t pushBatch(std::span<FancyNameTag> tags);
+
+    // Waits for a tag. Returns std::nullopt once the queue is closed and empty.
+    std::optional<FancyNameTag> pop();
+
+    // Waits for at least one tag, then moves up to max out like tryPopBatch().
+    // Returns 0 once the queue is closed and empty.
+    std::size_t popBatch(std::vector<FancyNameTag>& out, std::size_t max);
+
+    // Stops further pushes and wakes every waiting thread
+    void close();
+    bool closed() const { return closed_.load(std::memory_order_acquire); }
+
+private:
+    // One slot of the ring. sequence == position: free for the producer of
+    // that position. sequence == position + 1: holds that position's tag.
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        alignas(FancyNameTag) unsigned char storage[sizeof(FancyNameTag)];
+
+        FancyNameTag* tag() { return reinterpret_cast<FancyNameTag*>(storage); }
+    };
+
+    Cell& cell(std::size_t position) { return cells_[position & mask_]; }
+
+    // Bump a counter the other side may be sleeping on (QueueWait::Block only)
+    void notifyPushed() noexcept;
+    void notifyPopped() noexcept;
+
+    // Waits in the queue's mode until counter moves past seen (or a spin round ends)
+    void waitFor(const std::atomic<std::uint32_t>& counter, std::uint32_t seen, unsigned& spins) const;
+
+    std::unique_ptr<Cell[]> cells_;
+    std::size_t mask_;
+    QueueWait wait_;
+
+    // Each position gets its own cache line: producers hammer one, consumers
+    // the other, and they would slow each other down on a shared line
+    alignas(64) std::atomic<std::size_t> enqueuePos_{0};
+    alignas(64) std::atomic<std::size_t> dequeuePos_{0};
+
+    // Wake-up counters for QueueWait::Block: bumped after every push/pop so a
+    // sleeping consumer/producer can std::atomic::wait for a change
+    alignas(64) std::atomic<std::uint32_t> pushed_{0};
+    std::atomic<std::uint32_t> popped_{0};
+    std::atomic<bool> closed_{false};
+};
@@ -0,0 +1,137 @@
+// Header guard - prevents this file from being included more than once
+#pragma once
+
+// Include BioAlloc so the reader can choose how Bios are allocated
+#include "BioPool.h"
+// Include FancyNameTag, what the reader produces
+#include "FancyNameTag.h"
+
+// condition_variable and mutex for the worker pool's task queue
+#include <condition_variable>
+#include <mutex>
+// cstddef for std::size_t
+#include <cstddef>
+// deque for the chunks in flight (oldest first) and the task queue
+#include <deque>
+// functional for std::function (queued tasks)
+#include <functional>
+// future for each chunk's result
+#include <future>
+// istream for the input
+#include <istream>
+// string for error messages
+#include <string>
+// thread for the workers
+#include <thread>
+// vector for chunk contents
+#include <vector>
+
+// Reads FancyNameTags from a text stream, one row per line, in two formats:
+//
+//   Csv        id,company,name,title,department,year
+//              Fields may be "quoted" (a quote inside is written "").
+//   JsonLines  one flat JSON object per line:
+//              {"id":1,"company":"WSU","name":"Scott","title":"Professor",
+//               "department":"Computer Science","year":2010}
+//              Keys may come in any order; unknown keys are ignored.
+//
+// The input is read in chunks of chunkLines lines. Each chunk is parsed,
+// validated and turned into tags on a worker thread, and next() hands the
+// chunks back IN INPUT ORDER. At most maxChunksInFlight chunks are read ahead
+// of the consumer, and no line is kept longer than maxLineBytes, so the
+// buffered input stays bounded however long the input is.
+//
+// One thing does grow with the input: every distinct company is interned
+// into the process-wide CompanyTable, which never frees a name and holds
+// about 1M of them. Once it is full, rows with a company it hasn't seen
+// before are rejected (reported like any other bad row); rows with known
+// companies are still read.
+//
+// Rows are validated with exactly the constructor's rules (positive id,
+// non-empty company, bio name and title, positive year — see
+// FancyNameTagBatch.h). A bad row doesn't stop the stream: it is reported in
+// the chunk's errors with its line number and the next row carries on. A line
+// longer than maxLineBytes is skipped and reported the same way.
+//
+//   std::ifstream file("tags.csv");
+//   FancyNameTagReader reader(file);
+//   FancyNameTagChunk chunk;
+//   while (reader.next(chunk)) {
+//       for (FancyNameTag& tag : chunk.tags) { ... }
+//       for (const IngestError& error : chunk.errors) { ... }
+//   }
+
+enum class IngestFormat {
+    Csv,
+    JsonLines
+};
+
+struct IngestOptions {
+    IngestFormat format = IngestFormat::Csv;
+    bool skipHeader = false;           // Csv: the first line is column names
+    std::size_t chunkLines = 4096;     // lines handed to a worker at a time
+    std::size_t workers = 0;           // 0: one per hardware thread
+    std::size_t maxChunksInFlight = 0; // 0: two per worker
+    std::size_t maxLineBytes = 1 << 20; // longer lines are reported, not read (1 MiB)
+
+    // Heap by default. Pool would work, but every Bio would be allocated on
+    // a worker's free list and freed onto the consumer's, so pool slots would
+    // pile up on the consumer thread for as long as the stream runs.
+    BioAlloc alloc = BioAlloc::Heap;
+};
+
+// One rejected line
+struct IngestError {
+    std::size_t line;      // 1-based line number in the input
+    std::string message;   // e.g. "id must be positive" or "expected 6 fields, got 5"
+};
+
+// The results for one chunk of input lines
+struct FancyNameTagChunk {
+    std::vector<FancyNameTag> tags;      // valid rows, in input order
+    std::vector<std::size_t> lines;      // lines[i] is the input line of tags[i]
+    std::vector<IngestError> errors;     // rejected lines, in input order
+};
+
+class FancyNameTagReader {
+public:
+    // The stream must outlive the reader. It is only read from the thread
+    // that calls next().
+    explicit FancyNameTagReader(std::istream& in, IngestOptions options = {});
+
+    // Waits for the workers to stop. Chunks not taken yet are discarded.
+    ~FancyNameTagReader();
+
+    FancyNameTagReader(const FancyNameTagReader&) = delete;
+    FancyNameTagReader& operator=(const FancyNameTagReader&) = delete;
+
+    // Replaces chunk with the next chunk's results. Returns false (and leaves
+    // chunk empty) once the whole input has been returned. Rethrows anything
+    // a worker threw (e.g. std::bad_alloc). Throws std::length_error if one
+    // chunk's lines add up to more than 4 GB (lower chunkLines or maxLineBytes).
+    bool next(FancyNameTagChunk& chunk);
+
+    // Input lines read so far (including ones not yet returned by next())
+    std::size_t linesRead() const { return linesRead_; }
+
+private:
+    // Reads up to chunkLines lines and queues them for a worker.
+    // Returns false at the end of the input.
+    bool submitChunk();
+
+    // Worker loop: runs queued tasks until the reader is destroyed
+    void work();
+
+    std::istream& in_;
+    IngestOptions options_;
+    std::size_t linesRead_ = 0;
+    bool endOfInput_ = false;
+
+    std::deque<std::future<FancyNameTagChunk>> inFlight_; // oldest first
+
+    std::mutex mutex_;
+    std::condition_variable ready_;
+    std::deque<std::function<void()>> tasks_;
+    bool stopping_ = false;
+    std::vector<std::thread> workers_;
+};
@@ -0,0 +1,59 @@
+// Header guard - prevents this file from being included more than once
+#pragma once
+
+// charconv for std::to_chars (number -> text without locales or allocation)
+#include <charconv>
+// cstddef for std::size_t
+#include <cstddef>
+// string for std::string (the output buffer)
+#include <string>
+// string_view for text arguments that don't need their own copy
+#include <string_view>
+
+// Small helpers for building output text directly into a caller's std::string.
+//
+// The print() functions stream every field through std::cout with manipulators
+// like std::setw, and build temporaries like ("\"" + name_ + "\""). Each of
+// those costs a locale lookup or a heap allocation. These helpers append to an
+// existing std::string instead; if the caller reuses the same string (clear()
+// keeps its capacity), formatting allocates nothing at all.
+//
+// Each helper produces exactly the characters the matching stream code prints.
+
+// Appends text right-justified in a field of the given width
+// (same as: std::cout << std::right << std::setw(width) << text)
+inline void appendRight(std::string& out, std::string_view text, std::size_t width) {
+    if (text.size() < width) {
+        out.append(width - text.size(), ' ');
+    }
+    out.append(text);
+}
+
+// Appends text left-justified in a field of the given width
+// (same as: std::cout << std::left << std::setw(width) << text)
+inline void appendLeft(std::string& out, std::string_view text, std::size_t width) {
+    out.append(text);
+    if (text.size() < width) {
+        out.append(width - text.size(), ' ');
+    }
+}
+
+// Appends text wrapped in double quotes, left-justified in a field of the given width
+// (same as: std::cout << std::left << std::setw(width) << ("\"" + text + "\""))
+inline void appendQuotedLeft(std::string& out, std::string_view text, std::size_t width) {
+    out.push_back('"');
+    out.append(text);
+    out.push_back('"');
+    if (text.size() + 2 < width) {
+        out.append(width - text.size() - 2, ' ');
+    }
+}
+
+// Appends an int in decimal, left-justified in a field of the given width
+// (width 0 means no padding, same as: std::cout << value)
+inline void appendInt(std::string& out, int value, std::size_t width = 0) {
+    // 11 characters fit any 32-bit int, including the minus sign
+    char digits[16];
+    const std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), value);
+    appendLeft(out, std::string_view(digits, static_cast<std::size_t>(result.ptr - digits)), width);
+}
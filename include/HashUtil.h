@@ -0,0 +1,35 @@
+// Header guard - prevents this file from being included more than once
+#pragma once
+
+// cstddef for std::size_t
+#include <cstddef>
+// cstdint for std::uint32_t and std::uint64_t
+#include <cstdint>
+// functional for std::hash
+#include <functional>
+// string_view to hash characters without copying them
+#include <string_view>
+
+// Small helpers for building one hash out of several fields.
+//
+// std::hash gives a hash for one value. A tag has several fields, so we hash
+// each one and mix it into a running "seed". Just adding or XOR-ing the
+// hashes would be a poor mix: XOR makes (a, b) and (b, a) collide, and
+// std::hash<int> is the identity in libstdc++, so ids 1, 2, 3... would only
+// ever change the lowest bits.
+
+// Mixes value into seed (the 64-bit form of boost::hash_combine).
+// The constant is 2^64 divided by the golden ratio: its bits look random.
+constexpr std::uint64_t hashCombine(std::uint64_t seed, std::uint64_t value) noexcept {
+    return seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 12) + (seed >> 4));
+}
+
+// Mixes the hash of some characters into seed
+inline std::uint64_t hashCombine(std::uint64_t seed, std::string_view text) noexcept {
+    return hashCombine(seed, std::hash<std::string_view>{}(text));
+}
+
+// Folds a 64-bit hash into the 32 bits a tag keeps, using all 64 of them
+constexpr std::uint32_t foldHash(std::uint64_t hash) noexcept {
+    return static_cast<std::uint32_t>(hash ^ (hash >> 32));
+}
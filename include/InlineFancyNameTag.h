@@ -0,0 +1,114 @@
+// Header guard - prevents this file from being included more than once
+#pragma once
+
+// Include the Bio struct since we store one (inline or on the heap)
+#include "Bio.h"
+// Include CompanyId — the company name is interned, not stored per tag
+#include "CompanyTable.h"
+
+// cstddef for std::size_t
+#include <cstddef>
+// iostream for std::cout in print()
+#include <iostream>
+// stdexcept for std::invalid_argument
+#include <stdexcept>
+// string for std::string members and parameters
+#include <string>
+// string_view for appendTo() arguments
+#include <string_view>
+
+// Same public API as FancyNameTag, but the Bio usually lives INSIDE the object
+// instead of in a separate heap allocation.
+//
+// FancyNameTag keeps a Bio* bio_, so every getBio() or print() has to follow
+// that pointer to some other place in memory. When you scan a
+// std::vector<FancyNameTag>, the tags are next to each other but their Bios
+// are scattered around the heap — each one is a likely cache miss.
+//
+// InlineFancyNameTag reserves room for a Bio right inside itself (small-buffer
+// storage) and constructs the Bio there with placement new, so the tag and its
+// Bio share the same cache lines.
+//
+// "Very large" Bios (any string longer than kMaxInlineChars) go on the heap
+// instead: their characters are on the heap anyway, and a heap Bio can be moved
+// by stealing one pointer, like FancyNameTag.
+//
+// The trade-off in kMaxInlineChars: std::string keeps up to 15 characters
+// inside itself (libstdc++/MSVC). A string of 16..31 characters, like the
+// repo's usual department "Computer Science", has its text on the heap even
+// though its Bio is inline. Such a Bio still stays in the tag, so reading the
+// year, the string sizes or anything up to the text itself needs no pointer
+// chase, and the tag needs no separate Bio allocation. Only the text is a
+// separate block.
+//
+// bio_ always points at the Bio we own — either at our own inline buffer or at
+// the heap — so getBio() is the same single dereference in both cases.
+// After a move, bio_ is nullptr in the source, exactly like FancyNameTag:
+// hasBio() returns false and print() shows "(moved)".
+class InlineFancyNameTag {
+public:
+    // Longest name/title/department (in characters) that is still stored inline.
+    // Sized for real bios ("Computer Science", "Associate Professor") rather
+    // than the 15-character small-string buffer; see the trade-off above.
+    static constexpr std::size_t kMaxInlineChars = 31;
+
+    // Constructor: stores a copy of bio inline when it fits, on the heap otherwise
+    InlineFancyNameTag(int id, const std::string& company, const Bio& bio);
+
+    // Destructor: destroys the inline Bio or frees the heap Bio
+    ~InlineFancyNameTag();
+
+    // Copy constructor: deep copies the Bio (inline copies stay inline)
+    InlineFancyNameTag(const InlineFancyNameTag& other);
+
+    // Move constructor: steals a heap Bio's pointer, or move-constructs an inline
+    // Bio into our own buffer. Either way the source is left without a Bio.
+    InlineFancyNameTag(InlineFancyNameTag&& other) noexcept;
+
+    // Assignment is deleted to keep this variant small (FancyNameTag has both)
+    InlineFancyNameTag& operator=(const InlineFancyNameTag& other) = delete;
+    InlineFancyNameTag& operator=(InlineFancyNameTag&& other) = delete;
+
+    // Prints all data in the same columns as FancyNameTag::print, with the Bio's
+    // location shown as INLINE or HEAP
+    void print(const std::string& label, const std::string& state = "") const;
+
+    // Appends exactly what print() writes to out (see FancyNameTag::appendTo)
+    void appendTo(std::string& out, std::string_view label, std::string_view state = "") const;
+
+    // Same getters and setters as FancyNameTag
+    int getId() const;
+    const std::string& getCompany() const;
+    CompanyId getCompanyId() const;
+    const Bio& getBio() const;
+
+    void setId(int id);
+    void setCompany(const std::string& company);
+    void setBio(const Bio& bio);
+    void setBioTitle(const std::string& title);
+
+    // Returns true unless this object was moved from
+    bool hasBio() const;
+
+    // Returns true when the Bio is stored inside this object
+    bool isBioInline() const;
+
+    // Returns true when a Bio this size would be stored inline
+    static bool fitsInline(const Bio& bio);
+
+private:
+    // Creates a copy of bio in the right place and points bio_ at it
+    void storeBio(const Bio& bio);
+    // Destroys whatever Bio we own and sets bio_ to nullptr
+    void releaseBio() noexcept;
+    // Swaps in an already validated Bio; leaves the old one in place if that throws
+    void replaceBio(Bio&& replacement);
+
+    int id_;              // numeric identifier
+    CompanyId company_;   // interned company name
+    Bio* bio_;            // points at inlineBio_ or a heap Bio (nullptr after a move)
+
+    // Raw, correctly aligned bytes big enough for one Bio.
+    // No Bio exists here until placement new constructs one.
+    alignas(Bio) unsigned char inlineBio_[sizeof(Bio)];
+};
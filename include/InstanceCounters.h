@@ -0,0 +1,163 @@
+// Header guard - prevents this file from being included more than once
+#pragma once
+
+// atomic for counters that many threads update at once
+#include <atomic>
+// compare for std::strong_ordering
+#include <compare>
+// cstddef for std::size_t
+#include <cstddef>
+// cstdint for fixed-width counter types
+#include <cstdint>
+
+// Per-type instance counters: how many objects of a type are alive, and how
+// many were created, copied, moved and destroyed. They make hidden copies
+// visible — a test can check that an operation made zero copies:
+//
+//   const InstanceCounts before = InstanceCounter<FancyNameTag>::snapshot();
+//   tags.push_back(std::move(tag));
+//   const InstanceCounts delta = InstanceCounter<FancyNameTag>::snapshot() - before;
+//   EXPECT_EQ(delta.copies, 0u);
+//
+// A class opts in by holding a Counted<T> member (see below). NameTag,
+// FancyNameTag and Bio do.
+//
+// Counting costs one relaxed atomic add per constructor/destructor, on a
+// cache line every thread shares — enough to throttle parallel code. So it is
+// compiled out by default (all counts then stay 0); run_tests always counts,
+// and -DNAMETAG_COUNTERS=ON turns it on for the other targets too.
+
+#ifndef NAMETAG_COUNTERS
+#define NAMETAG_COUNTERS 0
+#endif
+
+// True unless counting is compiled out
+inline constexpr bool kCountersEnabled = NAMETAG_COUNTERS != 0;
+
+// [[no_unique_address]] lets an empty member take no space at all.
+// MSVC accepts the standard spelling but ignores it, so use its own.
+#if defined(_MSC_VER)
+#define NAMETAG_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#define NAMETAG_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
+// A plain copy of the counters at one moment
+struct InstanceCounts {
+    std::int64_t live = 0;         // alive right now (never cleared by reset())
+    std::uint64_t created = 0;     // made by a regular constructor
+    std::uint64_t copies = 0;      // copy constructions + copy assignments
+    std::uint64_t moves = 0;       // move constructions + move assignments
+    std::uint64_t destroyed = 0;
+    std::uint64_t heapBytes = 0;   // bytes allocated for the type's heap data (e.g. bio_)
+
+    // Change between two snapshots (later - earlier)
+    friend InstanceCounts operator-(const InstanceCounts& later, const InstanceCounts& earlier) {
+        InstanceCounts delta;
+        delta.live = later.live - earlier.live;
+        delta.created = later.created - earlier.created;
+        delta.copies = later.copies - earlier.copies;
+        delta.moves = later.moves - earlier.moves;
+        delta.destroyed = later.destroyed - earlier.destroyed;
+        delta.heapBytes = later.heapBytes - earlier.heapBytes;
+        return delta;
+    }
+};
+
+// The counters for one type T. All members are static — one set per type.
+template <typename T>
+class InstanceCounter {
+public:
+    // Reads every counter (each one atomically; the set is not one atomic
+    // snapshot if other threads are creating objects at the same time)
+    static InstanceCounts snapshot() noexcept {
+        InstanceCounts counts;
+        counts.live = data_.live.load(std::memory_order_relaxed);
+        counts.created = data_.created.load(std::memory_order_relaxed);
+        counts.copies = data_.copies.load(std::memory_order_relaxed);
+        counts.moves = data_.moves.load(std::memory_order_relaxed);
+        counts.destroyed = data_.destroyed.load(std::memory_order_relaxed);
+        counts.heapBytes = data_.heapBytes.load(std::memory_order_relaxed);
+        return counts;
+    }
+
+    // Clears the totals. live is left alone — those objects still exist.
+    static void reset() noexcept {
+        data_.created.store(0, std::memory_order_relaxed);
+        data_.copies.store(0, std::memory_order_relaxed);
+        data_.moves.store(0, std::memory_order_relaxed);
+        data_.destroyed.store(0, std::memory_order_relaxed);
+        data_.heapBytes.store(0, std::memory_order_relaxed);
+    }
+
+    // Hooks called by Counted<T> and by T itself
+    static void onCreate() noexcept { add(data_.created); addLive(1); }
+    static void onCopy() noexcept { add(data_.copies); addLive(1); }
+    static void onMove() noexcept { add(data_.moves); addLive(1); }
+    static void onCopyAssign() noexcept { add(data_.copies); }
+    static void onMoveAssign() noexcept { add(data_.moves); }
+    static void onDestroy() noexcept { add(data_.destroyed); addLive(-1); }
+    static void addHeapBytes(std::size_t bytes) noexcept { add(data_.heapBytes, bytes); }
+
+private:
+    static void add(std::atomic<std::uint64_t>& counter, std::uint64_t amount = 1) noexcept {
+        if constexpr (kCountersEnabled) {
+            counter.fetch_add(amount, std::memory_order_relaxed);
+        }
+    }
+
+    static void addLive(std::int64_t amount) noexcept {
+        if constexpr (kCountersEnabled) {
+            data_.live.fetch_add(amount, std::memory_order_relaxed);
+        }
+    }
+
+    // Each type's counters get their own cache line, so counting NameTags on
+    // one thread doesn't slow down counting Bios on another
+    struct alignas(64) Data {
+        std::atomic<std::int64_t> live{0};
+        std::atomic<std::uint64_t> created{0};
+        std::atomic<std::uint64_t> copies{0};
+        std::atomic<std::uint64_t> moves{0};
+        std::atomic<std::uint64_t> destroyed{0};
+        std::atomic<std::uint64_t> heapBytes{0};
+    };
+
+    static inline Data data_;
+};
+
+// An empty member that counts its owner's lifecycle.
+//
+// Because it is a member, the owner's compiler-generated copy and move
+// constructors call Counted's — so NameTag keeps "= default" copy/move and
+// still gets counted. Declare it with NAMETAG_NO_UNIQUE_ADDRESS so it adds
+// no bytes to the owner:
+//
+//   NAMETAG_NO_UNIQUE_ADDRESS Counted<NameTag> counted_;
+//
+// A class with its own copy/move constructors must pass the source's
+// member along: counted_(other.counted_) / counted_(std::move(other.counted_)).
+// Otherwise the copy is counted as a regular creation.
+template <typename T>
+class Counted {
+public:
+    Counted() noexcept { InstanceCounter<T>::onCreate(); }
+    Counted(const Counted&) noexcept { InstanceCounter<T>::onCopy(); }
+    Counted(Counted&&) noexcept { InstanceCounter<T>::onMove(); }
+    Counted& operator=(const Counted&) noexcept {
+        InstanceCounter<T>::onCopyAssign();
+        return *this;
+    }
+    Counted& operator=(Counted&&) noexcept {
+        InstanceCounter<T>::onMoveAssign();
+        return *this;
+    }
+    ~Counted() { InstanceCounter<T>::onDestroy(); }
+
+    // Counting never makes two objects different: every Counted compares
+    // equal, so an owner can still "= default" its == and <=> (Bio does)
+    friend constexpr bool operator==(const Counted&, const Counted&) noexcept { return true; }
+    friend constexpr std::strong_ordering operator<=>(const Counted&, const Counted&) noexcept {
+        return std::strong_ordering::equal;
+    }
+};
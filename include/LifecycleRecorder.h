@@ -0,0 +1,219 @@
+// Header guard - prevents this file from being included more than once
+#pragma once
+
+// Include the Bio struct, whose contents constructor and destructor events record
+#include "Bio.h"
+
+// atomic for the recording on/off switch
+#include <atomic>
+// cstddef for std::size_t
+#include <cstddef>
+// cstdint for fixed-width integer fields
+#include <cstdint>
+// istream to read a recording back
+#include <istream>
+// string for file paths and decoded text
+#include <string>
+// string_view for the text an event carries
+#include <string_view>
+// vector to hold decoded events
+#include <vector>
+
+// Lifecycle auditing: counts how many copies versus moves really happen.
+//
+// The console trace (Trace.h) is text meant for people. This is the same
+// information as binary records, cheap enough to leave on under load:
+//
+//   1. A tag constructor/destructor calls recordLifecycle(...). When recording
+//      is off that is one relaxed atomic load and a branch.
+//   2. When it is on, the event goes into a ring buffer owned by the calling
+//      thread. Only that thread writes to it and only the drainer reads it,
+//      so there are no locks and no shared counters — just two indices.
+//   3. A background drainer thread copies the rings into a binary file.
+//   4. The lifecycle_decode tool turns that file back into lines like
+//      "Copy Constructor (STACK 1c80): id=1, copied bio from HEAP ..."
+//
+// Copies and moves record addresses only. Constructors and destructors also
+// record the text their console line shows (company, name, Bio), so every
+// line of the trace can be rebuilt.
+//
+// If a thread records faster than the drainer empties its ring, new events
+// are dropped (and counted) instead of making the tag constructor wait.
+
+// What happened to the object
+enum class LifecycleKind : std::uint8_t {
+    Construct = 0,
+    Copy = 1,
+    Move = 2,
+    Destroy = 3,
+    CopyAssign = 4,
+    MoveAssign = 5
+};
+
+// Which class the object is
+enum class LifecycleTag : std::uint8_t {
+    FancyNameTag = 0,
+    InlineFancyNameTag = 1,
+    NameTag = 2
+};
+
+// Whether events get a timestamp. Reading the CPU clock is most of what an
+// event costs (see lifecycle_recorder_bench.cpp), so a recording that only
+// needs to count copies and moves can leave it out. Without timestamps every
+// event reads back as 0 and the decoder keeps each thread's events in order,
+// but can't interleave one thread's events with another's.
+enum class LifecycleTimestamps : std::uint8_t {
+    On = 0,
+    Off = 1
+};
+
+// Bits for LifecycleEvent::flags
+inline constexpr std::uint8_t kLifecycleBioInline = 1;       // bio is in the object itself
+inline constexpr std::uint8_t kLifecycleSourceBioInline = 2; // source's bio was inline
+
+// Strings an event can carry, in this order: company, name (NameTag's own,
+// or the Bio's), Bio title, Bio department
+inline constexpr std::size_t kLifecycleTextCount = 4;
+
+// One record, exactly as it is stored in the ring and in the file.
+// Addresses are stored as integers: they identify objects, they are never followed.
+//
+// An event with text is followed by its strings' bytes, back to back, padded
+// out to whole records (so a ring slot or file record is always 64 bytes).
+struct LifecycleEvent {
+    std::uint64_t timestamp = 0;   // CPU clock ticks when recorded; steady_clock
+                                   // nanoseconds after readLifecycleRecords()
+                                   // (0 with LifecycleTimestamps::Off)
+    std::uint64_t object = 0;      // the tag's own address (this)
+    std::uint64_t source = 0;      // the tag copied/moved from (0 otherwise)
+    std::uint64_t bio = 0;         // the tag's Bio after the event (0 if none)
+    std::uint64_t sourceBio = 0;   // the source's Bio when it was copied
+    std::int32_t id = 0;
+    std::int32_t year = 0;         // the Bio's year, when the event has text
+    std::uint16_t textSizes[kLifecycleTextCount] = {}; // bytes of each string that follows
+    LifecycleKind kind = LifecycleKind::Construct;
+    LifecycleTag tag = LifecycleTag::FancyNameTag;
+    std::uint8_t flags = 0;
+    std::uint8_t reserved[5] = {};
+};
+
+static_assert(sizeof(LifecycleEvent) == 64, "LifecycleEvent is written to disk as-is");
+
+// Starts and stops recording, and owns the drainer thread.
+// All members are static — there is one recorder per program.
+class LifecycleRecorder {
+public:
+    // Opens the output file, writes its header, starts the drainer and turns
+    // recording on. Throws std::runtime_error if the file can't be opened,
+    // std::logic_error if a recording is already running.
+    static void start(const std::string& path, LifecycleTimestamps timestamps = LifecycleTimestamps::On);
+
+    // Turns recording off, writes everything still in the rings and closes
+    // the file. Does nothing if no recording is running.
+    static void stop();
+
+    // True between start() and stop()
+    static bool isRecording() noexcept {
+        return recording_.load(std::memory_order_relaxed);
+    }
+
+    // Adds an event to the calling thread's ring (the timestamp is filled in here).
+    // The fields are passed one by one and written straight into the ring slot:
+    // building a LifecycleEvent on the caller's stack and copying it cost more
+    // than everything else record() does.
+    static void record(LifecycleKind kind, LifecycleTag tag, const void* object, int id,
+                       const void* bio, const void* source, const void* sourceBio,
+                       std::uint8_t flags) noexcept;
+
+    // The same, plus the strings (see kLifecycleTextCount) and the Bio's year.
+    // A string longer than 65535 bytes is cut short.
+    static void recordText(LifecycleKind kind, LifecycleTag tag, const void* object, int id,
+                           const void* bio, std::uint8_t flags,
+                           const std::string_view (&text)[kLifecycleTextCount], int year) noexcept;
+
+    // Events written to the file / dropped because a ring was full,
+    // counted since the last start()
+    static std::uint64_t writtenEvents();
+    static std::uint64_t droppedEvents();
+
+    // Records (events plus their text) each thread's ring can hold before the
+    // drainer must catch up
+    static constexpr std::size_t kRingCapacity = std::size_t{1} << 13;
+
+private:
+    static inline std::atomic<bool> recording_{false};
+};
+
+// Records for as long as it is alive (RAII): start() in the constructor,
+// stop() in the destructor. Declare it first in a scope so it outlives
+// every tag in that scope and their destructors are recorded too.
+class LifecycleRecording {
+public:
+    explicit LifecycleRecording(const std::string& path, LifecycleTimestamps timestamps = LifecycleTimestamps::On) {
+        LifecycleRecorder::start(path, timestamps);
+    }
+    ~LifecycleRecording() { LifecycleRecorder::stop(); }
+
+    LifecycleRecording(const LifecycleRecording&) = delete;
+    LifecycleRecording& operator=(const LifecycleRecording&) = delete;
+};
+
+// Called from the tag classes for copies and moves. The check is inline so
+// the common case (recording off) costs a load and a branch.
+inline void recordLifecycle(LifecycleKind kind, LifecycleTag tag, const void* object, int id,
+                            const void* bio, const void* source = nullptr,
+                            const void* sourceBio = nullptr, std::uint8_t flags = 0) noexcept {
+    if (!LifecycleRecorder::isRecording()) {
+        return;
+    }
+    LifecycleRecorder::record(kind, tag, object, id, bio, source, sourceBio, flags);
+}
+
+// Called from FancyNameTag/InlineFancyNameTag constructors and destructors:
+// also records the Bio's contents and the company (pass none when the line
+// doesn't show it). A moved-from tag (no Bio) records no text.
+inline void recordLifecycleWithBio(LifecycleKind kind, LifecycleTag tag, const void* object, int id,
+                                   const Bio* bio, std::string_view company = {},
+                                   std::uint8_t flags = 0) noexcept {
+    if (!LifecycleRecorder::isRecording()) {
+        return;
+    }
+    if (bio == nullptr) {
+        LifecycleRecorder::record(kind, tag, object, id, nullptr, nullptr, nullptr, flags);
+        return;
+    }
+    const std::string_view text[kLifecycleTextCount] = {company, bio->name, bio->title, bio->department};
+    LifecycleRecorder::recordText(kind, tag, object, id, bio, flags, text, bio->year);
+}
+
+// Called from the NameTag constructor: records its name and company
+inline void recordLifecycleWithName(LifecycleKind kind, const void* object, int id,
+                                    std::string_view name, std::string_view company) noexcept {
+    if (!LifecycleRecorder::isRecording()) {
+        return;
+    }
+    const std::string_view text[kLifecycleTextCount] = {company, name, {}, {}};
+    LifecycleRecorder::recordText(kind, LifecycleTag::NameTag, object, id, nullptr, 0, text, 0);
+}
+
+// ==================== Reading a recording back ====================
+
+// One event read back from a recording, with the text it carried
+struct LifecycleRecord {
+    LifecycleEvent event;
+    std::string company;
+    std::string name;  // NameTag's name, or the Bio's
+    std::string title;
+    std::string department;
+};
+
+// Reads every event in a recording, sorted by timestamp (the drainer writes
+// one thread's events at a time, so the file itself is only ordered per thread).
+// Throws std::runtime_error if the header is missing or from another format
+// version, or if the file ends in the middle of an event's text.
+std::vector<LifecycleRecord> readLifecycleRecords(std::istream& in);
+
+// Appends the console line the tag printed for this event, e.g.
+//   Move Constructor (STACK 1c80): id=1, took ownership of bio at HEAP 2a40
+// Every line matches the console trace exactly.
+void appendLifecycleLine(std::string& out, const LifecycleRecord& record);
@@ -1,17 +1,34 @@
 // Header guard - prevents this file from being included more than once
 #pragma once
 
+// Include CompanyId — the company name is interned, not stored per tag
+#include "CompanyTable.h"
+// Include Counted so NameTag copies and moves are counted
+#include "InstanceCounters.h"
+
+// compare for std::strong_ordering
+#include <compare>
+// cstddef for std::size_t
+#include <cstddef>
+// cstdint for the 32-bit cached hash
+#include <cstdint>
+// functional for std::hash
+#include <functional>
 // iostream for std::cout in print()
 #include <iostream>
 // stdexcept for std::invalid_argument
 #include <stdexcept>
 // string for std::string members and parameters
 #include <string>
+// string_view for appendTo() arguments
+#include <string_view>
 
 // A simple class with only stack-allocated members.
-// The compiler-generated copy and move constructors work correctly here
-// because all members are trivially copyable/movable.
-// We do NOT need to write custom copy/move for this class.
+// The compiler-generated copy constructor works correctly here because every
+// member copies correctly on its own (an int, a std::string, a CompanyId
+// handle and the cached hash). The moves are written out for one reason
+// only: the moved-from tag's name changes, so its cached hash has to be
+// recomputed (see hash()).
 //
 // This is a class (not a struct) because we enforce invariants:
 //   - id_ must be positive
@@ -23,13 +40,40 @@
 class NameTag {
 public:
     // Constructor: takes an id number, a person's name, and a company name
-    NameTag(int id, const std::string& name, const std::string& company);
+    //
+    // name is taken BY VALUE (a "sink" parameter): the caller's string is
+    // copied or moved into the parameter, and the constructor then moves it
+    // into name_. A temporary like NameTag(1, "Waldo", ...) or
+    // NameTag(1, std::move(name), ...) is never copied at all.
+    //
+    // company is only looked up in the CompanyTable (never stored per tag), so
+    // a string_view is enough — a string literal doesn't even become a
+    // std::string first.
+    NameTag(int id, std::string name, std::string_view company);
+
+    // The compiler-generated copy operations are exactly right, so we ask for
+    // them with "= default". The moves do what the compiler's would (move
+    // name_, copy the rest) and then rehash the source, like FancyNameTag's.
+    // noexcept promises that the moves never throw — true, since moving an
+    // int, a std::string and a CompanyId can't throw. std::vector, std::sort
+    // and erase() check for that promise before they move tags instead of
+    // copying them (tests/type_traits_test.cpp checks it too).
+    NameTag(const NameTag& other) = default;
+    NameTag(NameTag&& other) noexcept;
+    NameTag& operator=(const NameTag& other) = default;
+    NameTag& operator=(NameTag&& other) noexcept;
+    ~NameTag() = default;
 
     // Prints the NameTag's data with a right-justified label and optional state on the right
     // Example: print("original", "unchanged") produces:
     //     original  STACK xxxxx  id=1  name="Alice"  company="WSU"  (unchanged)
     void print(const std::string& label, const std::string& state = "") const;
 
+    // Appends exactly what print(label, state) writes to out, without touching
+    // std::cout. Reuse the same string (call clear() between tags) and
+    // formatting allocates nothing once the string has grown large enough.
+    void appendTo(std::string& out, std::string_view label, std::string_view state = "") const;
+
     // Returns the id by value (int is small/cheap to copy, no reference needed).
     // No need for "const int" here - the caller gets their own copy,
     // so they can't modify our private id_ no matter what.
@@ -44,19 +88,58 @@ public:
     // "const std::string&" prevents the caller from modifying our private data.
     // The trailing "const" means this method promises not to modify the object.
     const std::string& getCompany() const;
+    // Returns the interned company handle. Comparing two handles is an integer
+    // compare, and equal handles always mean equal company names.
+    CompanyId getCompanyId() const;
 
     // Sets the id after validating it is positive.
     // This is how we allow modification while still enforcing our invariants.
     void setId(int id);
     // Sets the name after validating it is not empty.
     // This is how we allow modification while still enforcing our invariants.
+    // The const& version copies into name_'s existing buffer when it is big
+    // enough; the && version steals the caller's buffer instead.
     void setName(const std::string& name);
+    void setName(std::string&& name);
     // Sets the company name after validating it is not empty.
     // This is how we allow modification while still enforcing our invariants.
-    void setCompany(const std::string& company);
+    void setCompany(std::string_view company);
+
+    // Two tags are equal when their id, name and company are all equal.
+    // The cached hashes are compared first: different hashes always mean
+    // different tags, so most unequal pairs never get to the string compare.
+    bool operator==(const NameTag& other) const;
+    // Orders by id, then name, then company name (alphabetically, not by
+    // CompanyId — those numbers only say which company was interned first).
+    // The compiler writes <, <=, > and >= from this, and != from ==.
+    std::strong_ordering operator<=>(const NameTag& other) const;
+
+    // Hash of id, name and company. It is computed by the constructor and
+    // again by every setter, so reading it (or hashing the tag in a
+    // std::unordered_set) never touches the name's characters.
+    // The moves rehash the moved-from tag too, so its hash always matches
+    // what it holds now (its id and company, and whatever the move left in
+    // its name), exactly like a moved-from FancyNameTag.
+    std::uint32_t hash() const;
 
 private:
+    // Recomputes hash_ from id_, name_ and company_ (after any change)
+    void rehash() noexcept;
+
     int id_;              // numeric identifier (stack-allocated)
+    // Cached hash() (see rehash()). It sits in the 4 bytes of padding after
+    // id_ that name_'s 8-byte alignment left unused, so NameTag is no bigger.
+    std::uint32_t hash_;
     std::string name_;    // person's name (stack-allocated)
-    std::string company_; // company name (stack-allocated)
+    CompanyId company_;   // interned company name (a 4-byte handle into CompanyTable)
+    // Empty, takes no space. The default copy/move constructors copy/move it
+    // too, which is what counts them.
+    NAMETAG_NO_UNIQUE_ADDRESS Counted<NameTag> counted_;
+};
+
+// Lets a NameTag be a key in std::unordered_set / std::unordered_map.
+// Returns the cached hash, so hashing a tag costs one load.
+template <>
+struct std::hash<NameTag> {
+    std::size_t operator()(const NameTag& tag) const noexcept { return tag.hash(); }
 };
@@ -0,0 +1,193 @@
+// Header guard - prevents this file from being included more than once
+#pragma once
+
+// Include CompanyId — the name key pairs a name with an interned company
+#include "CompanyTable.h"
+// Include NameTag, the type the index stores
+#include "NameTag.h"
+
+// array for the fixed set of shards
+#include <array>
+// cstddef for std::size_t
+#include <cstddef>
+// cstdint for std::uint32_t
+#include <cstdint>
+// functional for std::hash
+#include <functional>
+// mutex for std::unique_lock (shared_mutex for readers and writers)
+#include <mutex>
+#include <shared_mutex>
+// optional for lookups that may not find anything
+#include <optional>
+// string for the stored name keys
+#include <string>
+// string_view so lookups never build a std::string
+#include <string_view>
+// unordered_map for each shard's hash map
+#include <unordered_map>
+// vector for the ids that share a name
+#include <vector>
+
+// A thread-safe index of NameTags, keyed by id AND by (name, company).
+//
+// NameTag only offers getId()/getName(), so finding a tag in a plain vector
+// means scanning every element. The index instead keeps two sets of hash maps:
+//   - by id:              id -> the NameTag itself (ids are unique)
+//   - by name + company:  (name, company) -> ids of every tag with that pair
+//
+// Each set is split into kShards shards, and each shard has its own
+// std::shared_mutex. Readers take a shared lock on the ONE shard their key
+// hashes to, so lookups on different shards never touch the same lock, and
+// lookups on the same shard still run side by side. Writers lock only the
+// shards they change.
+//
+// The index owns its tags. Changing a tag's id, name or company goes through
+// setId()/setName()/setCompany() here, which update the tag and both keys
+// under the same locks — so no reader ever finds a tag under a key it no
+// longer has. (A NameTag changed behind the index's back couldn't be found
+// again, which is why it hands out copies and const references only.)
+//
+// Every single call is atomic on its own. Two calls in a row (find the ids for
+// a name, then look each id up) can see a writer's change in between.
+//
+// Name lookups take string_views and never allocate: the company is found
+// with CompanyTable::find() and the maps accept a (string_view, CompanyId)
+// key directly (heterogeneous lookup).
+class NameTagIndex {
+public:
+    // Number of shards in each key set (a power of two)
+    static constexpr std::size_t kShards = 64;
+
+    NameTagIndex() = default;
+    NameTagIndex(const NameTagIndex&) = delete;
+    NameTagIndex& operator=(const NameTagIndex&) = delete;
+
+    // Adds a tag. Throws std::invalid_argument if its id is already indexed.
+    void insert(NameTag tag);
+
+    // Removes the tag with this id. Returns false if there is none.
+    bool erase(int id);
+
+    // Returns a copy of the tag with this id, if any
+    std::optional<NameTag> findById(int id) const;
+
+    bool contains(int id) const;
+
+    // Calls fn(const NameTag&) on the tag with this id while holding its
+    // shard's reader lock, so nothing is copied. Returns false (and doesn't
+    // call fn) if there is no such tag. fn must not call back into the index.
+    template <typename Fn>
+    bool visitById(int id, Fn&& fn) const {
+        const IdShard& shard = idShard(id);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        const auto found = shard.tags.find(id);
+        if (found == shard.tags.end()) {
+            return false;
+        }
+        fn(found->second);
+        return true;
+    }
+
+    // Ids of the tags with exactly this name and company, in insertion order
+    std::vector<int> idsByName(std::string_view name, std::string_view company) const;
+
+    // Number of tags with exactly this name and company
+    std::size_t countByName(std::string_view name, std::string_view company) const;
+
+    // Calls fn(int id) for each tag with this name and company while holding
+    // the name shard's reader lock. Returns how many ids it visited.
+    // fn must not call back into the index.
+    template <typename Fn>
+    std::size_t forEachIdByName(std::string_view name, std::string_view company, Fn&& fn) const {
+        const std::optional<CompanyId> companyId = CompanyTable::find(company);
+        if (!companyId) {
+            return 0; // never interned, so no tag can have it
+        }
+        const NameKeyView key{name, *companyId};
+        const NameShard& shard = nameShard(key);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        const auto found = shard.ids.find(key);
+        if (found == shard.ids.end()) {
+            return 0;
+        }
+        for (int id : found->second) {
+            fn(id);
+        }
+        return found->second.size();
+    }
+
+    // Change one tag and its keys together. Each validates with the NameTag
+    // setter's rules and throws std::invalid_argument if there is no tag with
+    // this id; setId() also throws if newId is already taken. If anything
+    // throws, the index is unchanged.
+    void setId(int id, int newId);
+    void setName(int id, std::string name);
+    void setCompany(int id, std::string_view company);
+
+    // Number of tags (sums the shards, so it is only a snapshot)
+    std::size_t size() const;
+
+private:
+    // The second key. Stored keys own their name; lookups use NameKeyView.
+    struct NameKey {
+        std::string name;
+        CompanyId company;
+    };
+    struct NameKeyView {
+        std::string_view name;
+        CompanyId company;
+    };
+
+    // Hashes and compares both key types the same way, so find() can take a
+    // NameKeyView without building a NameKey ("is_transparent")
+    struct NameKeyHash {
+        using is_transparent = void;
+        std::size_t operator()(const NameKeyView& key) const {
+            return std::hash<std::string_view>{}(key.name) ^ (key.company.value() * 0x9E3779B97F4A7C15ull);
+        }
+        std::size_t operator()(const NameKey& key) const {
+            return (*this)(NameKeyView{key.name, key.company});
+        }
+    };
+    struct NameKeyEqual {
+        using is_transparent = void;
+        template <typename A, typename B>
+        bool operator()(const A& a, const B& b) const {
+            return a.company == b.company && std::string_view(a.name) == std::string_view(b.name);
+        }
+    };
+
+    // alignas(64): each shard's mutex sits on its own cache line, so readers
+    // locking neighboring shards don't slow each other down
+    struct alignas(64) IdShard {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<int, NameTag> tags;
+    };
+    struct alignas(64) NameShard {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<NameKey, std::vector<int>, NameKeyHash, NameKeyEqual> ids;
+    };
+
+    // Shard numbers. Ids are mixed first, so runs of consecutive ids spread
+    // over every shard.
+    static std::size_t idShardIndex(int id) {
+        return (static_cast<std::uint32_t>(id) * 0x9E3779B9u) >> 26; // top 6 bits: 0..63
+    }
+    static std::size_t nameShardIndex(const NameKeyView& key) {
+        return (NameKeyHash{}(key) * 0x9E3779B97F4A7C15ull) >> 58;
+    }
+    static_assert(kShards == 64, "the shard index functions keep the top 6 bits");
+
+    IdShard& idShard(int id) { return idShards_[idShardIndex(id)]; }
+    const IdShard& idShard(int id) const { return idShards_[idShardIndex(id)]; }
+    NameShard& nameShard(const NameKeyView& key) { return nameShards_[nameShardIndex(key)]; }
+    const NameShard& nameShard(const NameKeyView& key) const { return nameShards_[nameShardIndex(key)]; }
+
+    // Moves id from one name key to another; both shards must be locked
+    void renameKey(int id, const NameKeyView& from, const NameKeyView& to);
+    // Replaces id with newId under one name key; its shard must be locked
+    void reidKey(const NameKeyView& key, int id, int newId);
+
+    std::array<IdShard, kShards> idShards_;
+    std::array<NameShard, kShards> nameShards_;
+};
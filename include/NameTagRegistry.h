@@ -0,0 +1,124 @@
+// Header guard - prevents this file from being included more than once
+#pragma once
+
+// Include NameTag so views can be turned back into real tags
+#include "NameTag.h"
+
+// cstddef for std::size_t
+#include <cstddef>
+// iterator for std::forward_iterator_tag
+#include <iterator>
+// optional for lookups that may not find anything
+#include <optional>
+// string for std::string columns
+#include <string>
+// string_view for non-owning views into the columns
+#include <string_view>
+// vector for the column arrays
+#include <vector>
+
+// A read-only, non-owning look at one row of a NameTagRegistry.
+// It has the same getters as NameTag, but returns string_views that point
+// into the registry's columns instead of owning strings.
+// A view is only valid until the registry is modified.
+struct NameTagView {
+    int id;
+    std::string_view name;
+    std::string_view company;
+
+    int getId() const { return id; }
+    std::string_view getName() const { return name; }
+    std::string_view getCompany() const { return company; }
+
+    // Makes an owning NameTag with the same data
+    NameTag toNameTag() const;
+};
+
+// Stores many NameTags as a "structure of arrays" (SoA) instead of an
+// "array of structures" (AoS) like std::vector<NameTag>.
+//
+// AoS: [id name company][id name company][id name company]...
+// SoA: ids:       [id][id][id]...
+//      names:     [name][name][name]...
+//      companies: [CompanyId][CompanyId][CompanyId]...
+//
+// A query like "how many tags have id between 100 and 200" only needs ids,
+// so with SoA every byte the CPU loads into cache is an id — nothing is
+// wasted on names and companies the query never looks at.
+//
+// Companies are stored as interned CompanyId handles (see CompanyTable.h):
+// each distinct company string exists once, and each row stores a 4-byte id.
+// Filtering by company becomes one table lookup followed by an integer scan.
+//
+// Rows are numbered 0..size()-1. Removing a row moves the LAST row into the
+// hole (swap-and-pop), so removal is O(1) but row numbers can change.
+class NameTagRegistry {
+public:
+    // Iterates over rows, producing a NameTagView for each
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = NameTagView;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = NameTagView;
+
+        const_iterator() = default;
+        const_iterator(const NameTagRegistry* registry, std::size_t row)
+            : registry_(registry), row_(row) {}
+
+        NameTagView operator*() const { return registry_->at(row_); }
+        const_iterator& operator++() { ++row_; return *this; }
+        const_iterator operator++(int) { const_iterator old = *this; ++row_; return old; }
+        bool operator==(const const_iterator& other) const { return row_ == other.row_; }
+
+    private:
+        const NameTagRegistry* registry_ = nullptr;
+        std::size_t row_ = 0;
+    };
+
+    // Adds a row after validating it with the same rules as NameTag (so a
+    // moved-from NameTag is rejected). Returns the new row's index.
+    // If anything throws, the registry is unchanged.
+    std::size_t add(int id, const std::string& name, const std::string& company);
+    std::size_t add(const NameTag& tag);
+
+    // Removes the row at the given index (the last row moves into its place)
+    void removeAt(std::size_t row);
+
+    // Removes the first row with this id. Returns false if there is none.
+    bool removeById(int id);
+
+    // Returns the first row with this id, if any
+    std::optional<NameTagView> findById(int id) const;
+
+    // Returns the view of one row (row must be < size())
+    NameTagView at(std::size_t row) const;
+
+    std::size_t size() const;
+    bool empty() const;
+    void reserve(std::size_t rows);
+    void clear();
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, size()); }
+
+    // Column scans: return matching row indexes, or just count them.
+    // Id ranges are inclusive: minId <= id <= maxId.
+    std::vector<std::size_t> rowsWithIdInRange(int minId, int maxId) const;
+    std::size_t countIdInRange(int minId, int maxId) const;
+    std::vector<std::size_t> rowsWithCompany(std::string_view company) const;
+    std::size_t countCompany(std::string_view company) const;
+
+    // Direct read-only access to the id column, for custom scans
+    const std::vector<int>& ids() const { return ids_; }
+
+private:
+    // Appends one validated row to every column (strong guarantee)
+    std::size_t appendRow(int id, const std::string& name, CompanyId company);
+
+    // Columns — row i is ids_[i], names_[i], companies_[i]
+    std::vector<int> ids_;
+    std::vector<std::string> names_;
+    std::vector<CompanyId> companies_;
+};
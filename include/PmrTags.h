@@ -0,0 +1,185 @@
+// Header guard - prevents this file from being included more than once
+#pragma once
+
+// Include the Bio struct, what a PmrBio converts to and from
+#include "Bio.h"
+// Include CompanyId — the company name is interned, not stored per tag
+#include "CompanyTable.h"
+
+// memory_resource for std::pmr::polymorphic_allocator and the resources
+#include <memory_resource>
+// stdexcept for std::invalid_argument
+#include <stdexcept>
+// string for std::pmr::string
+#include <string>
+// string_view for constructor and setter arguments
+#include <string_view>
+
+// Bio, NameTag and FancyNameTag variants whose memory comes from a
+// std::pmr::memory_resource the caller picks, instead of from new/delete.
+//
+// Give every request handler its own std::pmr::monotonic_buffer_resource,
+// build that request's tags with it, and when the request is done, drop the
+// tags and the resource: everything they allocated goes back in one step.
+//
+//   std::pmr::monotonic_buffer_resource arena;
+//   PmrFancyNameTag tag(1, "WSU", bio, &arena);  // Bio and its strings: arena
+//
+// What lands in the resource: a PmrNameTag's name, a PmrFancyNameTag's Bio
+// and that Bio's three strings. Companies are interned in the process-wide
+// CompanyTable (a tag only holds a 4-byte CompanyId), so there is no company
+// string per tag to place anywhere.
+//
+// Each type has an allocator_type and takes the allocator as its last
+// constructor argument, so std::pmr containers pass their own resource
+// along: every element of a std::pmr::vector<PmrFancyNameTag> allocates from
+// the vector's resource ("uses-allocator construction").
+//
+// The allocator rules are the standard ones for std::pmr (the same as
+// std::pmr::string), because a resource must outlive everything allocated
+// from it and the caller decides which one that is:
+//
+//   copy constructor           the DEFAULT resource (std::pmr::get_default_resource()),
+//                              not the source's: a copy may outlive the source's arena
+//   copy constructor + alloc   the given resource
+//   move constructor           the source's resource; memory is taken over, nothing is copied
+//   move constructor + alloc   the given resource. Same resource as the source:
+//                              memory is taken over. Different: the data is copied
+//                              and the source keeps its own
+//   copy / move assignment     the object keeps ITS resource. A move between
+//                              different resources copies (the source keeps its data)
+//
+// A resource never changes after construction, so none of these can leave
+// an object holding memory from a resource it doesn't know about.
+
+// Bio with std::pmr::string members
+struct PmrBio {
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+
+    std::pmr::string name;
+    std::pmr::string title;
+    std::pmr::string department;
+    int year = 0;
+
+    // Empty strings, in alloc's resource
+    explicit PmrBio(allocator_type alloc = {});
+    PmrBio(std::string_view name, std::string_view title, std::string_view department, int year,
+           allocator_type alloc = {});
+    // Converts from a Bio (copies its strings into alloc's resource)
+    explicit PmrBio(const Bio& bio, allocator_type alloc = {});
+
+    // See the table above. The assignments are std::pmr::string's.
+    PmrBio(const PmrBio& other, allocator_type alloc = {});
+    PmrBio(PmrBio&& other) noexcept = default;
+    PmrBio(PmrBio&& other, allocator_type alloc);
+    PmrBio& operator=(const PmrBio& other) = default;
+    PmrBio& operator=(PmrBio&& other) = default;
+
+    // The resource the strings come from
+    allocator_type get_allocator() const { return name.get_allocator(); }
+
+    // Converts back to a Bio (new std::strings)
+    Bio toBio() const;
+
+    // Same output as Bio::print() and Bio::appendTo()
+    void print() const;
+    void appendTo(std::string& out) const;
+
+    // Compares contents (never resources), like Bio
+    bool operator==(const PmrBio& other) const = default;
+};
+
+// NameTag with its name in a memory_resource
+class PmrNameTag {
+public:
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+
+    // Same rules as NameTag: id > 0, name and company not empty.
+    // Throws std::invalid_argument otherwise.
+    PmrNameTag(int id, std::string_view name, std::string_view company, allocator_type alloc = {});
+
+    // See the table above
+    PmrNameTag(const PmrNameTag& other, allocator_type alloc = {});
+    PmrNameTag(PmrNameTag&& other) noexcept = default;
+    PmrNameTag(PmrNameTag&& other, allocator_type alloc);
+    PmrNameTag& operator=(const PmrNameTag& other) = default;
+    PmrNameTag& operator=(PmrNameTag&& other) = default;
+    ~PmrNameTag() = default;
+
+    int getId() const { return id_; }
+    const std::pmr::string& getName() const { return name_; }
+    const std::string& getCompany() const { return company_.str(); }
+    CompanyId getCompanyId() const { return company_; }
+
+    // The resource the name comes from
+    allocator_type get_allocator() const { return name_.get_allocator(); }
+
+    // Same validation as NameTag's setters
+    void setId(int id);
+    void setName(std::string_view name);
+    void setCompany(std::string_view company);
+
+private:
+    int id_;
+    std::pmr::string name_;
+    CompanyId company_;
+};
+
+// FancyNameTag with its Bio (and the Bio's strings) in a memory_resource
+class PmrFancyNameTag {
+public:
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+
+    // Same rules as FancyNameTag: id > 0, company, bio name and title not
+    // empty, bio year > 0. Throws std::invalid_argument otherwise.
+    // The Bio is built in alloc's resource, strings and all.
+    PmrFancyNameTag(int id, std::string_view company, const Bio& bio, allocator_type alloc = {});
+    PmrFancyNameTag(int id, std::string_view company, const PmrBio& bio, allocator_type alloc = {});
+    // Moves bio's strings in (only if bio's resource is alloc's; otherwise
+    // they are copied, like any move between resources)
+    PmrFancyNameTag(int id, std::string_view company, PmrBio&& bio, allocator_type alloc = {});
+
+    // Destroys the Bio and returns its memory to the resource
+    ~PmrFancyNameTag();
+
+    // See the table above. A moved-from tag (same resource) has no Bio,
+    // like a moved-from FancyNameTag.
+    PmrFancyNameTag(const PmrFancyNameTag& other, allocator_type alloc = {});
+    PmrFancyNameTag(PmrFancyNameTag&& other) noexcept;
+    PmrFancyNameTag(PmrFancyNameTag&& other, allocator_type alloc);
+    PmrFancyNameTag& operator=(const PmrFancyNameTag& other);
+    // Not noexcept: between different resources it has to copy the Bio
+    PmrFancyNameTag& operator=(PmrFancyNameTag&& other);
+
+    int getId() const { return id_; }
+    const std::string& getCompany() const { return company_.str(); }
+    CompanyId getCompanyId() const { return company_; }
+    // Throws std::logic_error for a moved-from tag
+    const PmrBio& getBio() const;
+    // False after this tag's Bio was moved out
+    bool hasBio() const { return bio_ != nullptr; }
+
+    // The resource the Bio comes from
+    allocator_type get_allocator() const { return alloc_; }
+
+    // Same validation as FancyNameTag's setters
+    void setId(int id);
+    void setCompany(std::string_view company);
+    void setBio(const Bio& bio);
+    void setBioTitle(std::string_view title);
+
+private:
+    // Validates, then interns the company and builds the Bio in alloc_
+    // (BioArg: Bio or PmrBio, any ref)
+    template <typename BioArg>
+    void construct(std::string_view company, BioArg&& bio);
+    // A copy of bio in alloc_ (nullptr for nullptr)
+    PmrBio* copyBio(const PmrBio* bio) const;
+    // Destroys the Bio and frees it in alloc_
+    void destroyBio() noexcept;
+
+    int id_;
+    CompanyId company_;
+    PmrBio* bio_ = nullptr;  // allocated from alloc_ (nullptr after a move)
+    allocator_type alloc_;   // never changes after construction
+};
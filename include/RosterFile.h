@@ -0,0 +1,241 @@
+// Header guard - prevents this file from being included more than once
+#pragma once
+
+// Include BioAlloc so promoted FancyNameTags can pick their Bio strategy
+#include "BioPool.h"
+// Include FancyNameTag, what a FancyNameTagView is promoted to
+#include "FancyNameTag.h"
+// Include NameTag, what a NameTagView is promoted to
+#include "NameTag.h"
+// Include NameTagView, the read-only NameTag row type (shared with NameTagRegistry)
+#include "NameTagRegistry.h"
+
+// cstddef for std::size_t
+#include <cstddef>
+// cstdint for the fixed-width fields of the file format
+#include <cstdint>
+// optional for the owning tag a lazy tag is promoted to
+#include <optional>
+// span for the writer's input
+#include <span>
+// string for the file path and owned strings
+#include <string>
+// string_view for zero-copy strings pointing into the mapped file
+#include <string_view>
+// unordered_map to de-duplicate the writer's string table
+#include <unordered_map>
+// utility for std::move
+#include <utility>
+// vector for the writer's records and string table
+#include <vector>
+
+// A compact binary "roster" file holding many NameTags and FancyNameTags,
+// built for startup: opening it maps the file into memory and reads nothing
+// else, and every string a view hands out points straight into the mapping.
+//
+// Layout (all integers little-endian):
+//
+//   RosterHeader        magic "NTROSTER", version, record counts, section offsets
+//   NameTag records     NameTagRecord[nameTagCount]       (12 bytes each)
+//   FancyNameTag recs   FancyNameTagRecord[fancyCount]    (24 bytes each)
+//   string table        [u32 length][bytes] [u32 length][bytes] ...
+//
+// Records are fixed size, so record i is found with one multiply. Strings
+// live in the table and records refer to them by byte offset. Companies,
+// titles and departments repeat across thousands of tags, so the writer
+// stores each distinct one ONCE; names are (nearly) unique and are simply
+// appended.
+//
+// Bump kRosterVersion whenever the layout changes — the loader rejects
+// files from any other version rather than misreading them.
+
+inline constexpr std::uint32_t kRosterVersion = 1;
+
+// Offsets/sizes of the sections. Every section starts on an 8-byte boundary.
+struct RosterHeader {
+    char magic[8];               // "NTROSTER"
+    std::uint32_t version;       // kRosterVersion
+    std::uint32_t headerSize;    // sizeof(RosterHeader), for sanity checking
+    std::uint64_t nameTagCount;
+    std::uint64_t fancyCount;
+    std::uint64_t nameTagOffset; // byte offset of the first NameTagRecord
+    std::uint64_t fancyOffset;   // byte offset of the first FancyNameTagRecord
+    std::uint64_t stringsOffset; // byte offset of the string table
+    std::uint64_t stringsSize;   // string table size in bytes
+};
+
+// A string reference is the byte offset of its [u32 length] prefix in the table
+struct NameTagRecord {
+    std::int32_t id;
+    std::uint32_t name;
+    std::uint32_t company;
+};
+
+struct FancyNameTagRecord {
+    std::int32_t id;
+    std::uint32_t company;
+    std::uint32_t name;
+    std::uint32_t title;
+    std::uint32_t department;
+    std::int32_t year;
+};
+
+static_assert(sizeof(RosterHeader) == 64);
+static_assert(sizeof(NameTagRecord) == 12);
+static_assert(sizeof(FancyNameTagRecord) == 24);
+
+// A read-only look at one FancyNameTag record: the FancyNameTag getters,
+// minus the Bio allocation. Like NameTagView, every string_view points into
+// its RosterFile and is only valid while that file stays open.
+struct FancyNameTagView {
+    int id;
+    std::string_view company;
+    std::string_view name;
+    std::string_view title;
+    std::string_view department;
+    int year;
+
+    // Makes an owning Bio / FancyNameTag with the same data
+    Bio toBio() const;
+    FancyNameTag toFancyNameTag(BioAlloc alloc = defaultBioAlloc()) const;
+};
+
+// Collects tags and writes them as a roster file.
+//
+//   RosterWriter writer;
+//   for (const FancyNameTag& tag : tags) writer.add(tag);
+//   writer.write("roster.bin");
+class RosterWriter {
+public:
+    void add(const NameTag& tag);
+    void add(const FancyNameTag& tag);
+    void add(const NameTagView& tag);
+    void add(const FancyNameTagView& tag);
+
+    std::size_t nameTagCount() const { return nameTags_.size(); }
+    std::size_t fancyCount() const { return fancy_.size(); }
+
+    // Writes everything added so far. Throws std::runtime_error if the file
+    // can't be written.
+    void write(const std::string& path) const;
+
+private:
+    // Appends s to the string table and returns its offset
+    std::uint32_t appendString(std::string_view s);
+    // Same, but returns the existing offset if s was stored before
+    std::uint32_t internString(std::string_view s);
+
+    std::vector<NameTagRecord> nameTags_;
+    std::vector<FancyNameTagRecord> fancy_;
+    std::vector<char> strings_;
+    std::unordered_map<std::string, std::uint32_t> interned_;
+};
+
+// Writes tags to path in one call (see RosterWriter)
+void writeRoster(const std::string& path,
+                 std::span<const NameTag> nameTags,
+                 std::span<const FancyNameTag> fancyTags);
+
+// An open roster file, memory-mapped read-only.
+//
+// Opening checks the header and that every section lies inside the file, then
+// touches nothing else: the OS pages records and strings in as views read
+// them. String references are bounds-checked when they are read, so a
+// corrupt file throws std::runtime_error instead of reading past the end.
+//
+// Views (and the string_views inside them) point into the mapping, so the
+// RosterFile must outlive them. It can be moved but not copied.
+class RosterFile {
+public:
+    // Maps path. Throws std::runtime_error if it can't be opened, is not a
+    // roster file, has another version or is truncated.
+    explicit RosterFile(const std::string& path);
+    ~RosterFile();
+
+    RosterFile(RosterFile&& other) noexcept;
+    RosterFile& operator=(RosterFile&& other) noexcept;
+    RosterFile(const RosterFile&) = delete;
+    RosterFile& operator=(const RosterFile&) = delete;
+
+    std::size_t nameTagCount() const { return nameTagCount_; }
+    std::size_t fancyCount() const { return fancyCount_; }
+
+    // Zero-copy views of one record (index must be < the matching count)
+    NameTagView nameTag(std::size_t index) const;
+    FancyNameTagView fancyNameTag(std::size_t index) const;
+
+    // Size of the mapped file in bytes
+    std::size_t sizeBytes() const { return size_; }
+
+private:
+    std::string_view stringAt(std::uint32_t offset) const;
+    void unmap() noexcept;
+
+    const char* data_ = nullptr;
+    std::size_t size_ = 0;
+    bool mapped_ = false;        // false: data_ is a heap copy (no mmap on this platform)
+    std::size_t nameTagCount_ = 0;
+    std::size_t fancyCount_ = 0;
+    const char* nameTags_ = nullptr;
+    const char* fancy_ = nullptr;
+    const char* strings_ = nullptr;
+    std::size_t stringsSize_ = 0;
+};
+
+// A FancyNameTag that starts out as a view into a RosterFile and only becomes
+// a real FancyNameTag (allocating its Bio) the first time it is changed.
+//
+// Most tags loaded at startup are only ever read, so they never allocate.
+// The getters read from the view until the tag is promoted, and from the
+// owning tag afterwards. The RosterFile must outlive every unpromoted tag.
+class LazyFancyNameTag {
+public:
+    explicit LazyFancyNameTag(const FancyNameTagView& view) : view_(view) {}
+
+    int getId() const { return tag_ ? tag_->getId() : view_.id; }
+    std::string_view getCompany() const { return tag_ ? std::string_view(tag_->getCompany()) : view_.company; }
+    std::string_view getName() const { return tag_ ? std::string_view(tag_->getBio().name) : view_.name; }
+    std::string_view getTitle() const { return tag_ ? std::string_view(tag_->getBio().title) : view_.title; }
+    std::string_view getDepartment() const {
+        return tag_ ? std::string_view(tag_->getBio().department) : view_.department;
+    }
+    int getYear() const { return tag_ ? tag_->getBio().year : view_.year; }
+
+    // True once a setter has turned this into an owning FancyNameTag
+    bool isPromoted() const { return tag_.has_value(); }
+
+    // Mutators: promote (once), then forward to the FancyNameTag setter
+    void setId(int id) { promote().setId(id); }
+    void setCompany(std::string_view company) { promote().setCompany(company); }
+    void setBio(Bio bio) { promote().setBio(std::move(bio)); }
+    void setBioTitle(std::string title) { promote().setBioTitle(std::move(title)); }
+
+    // The owning tag, promoting first if needed
+    FancyNameTag& promote(BioAlloc alloc = defaultBioAlloc());
+
+private:
+    FancyNameTagView view_;
+    std::optional<FancyNameTag> tag_;
+};
+
+// The same for NameTag
+class LazyNameTag {
+public:
+    explicit LazyNameTag(const NameTagView& view) : view_(view) {}
+
+    int getId() const { return tag_ ? tag_->getId() : view_.id; }
+    std::string_view getName() const { return tag_ ? std::string_view(tag_->getName()) : view_.name; }
+    std::string_view getCompany() const { return tag_ ? std::string_view(tag_->getCompany()) : view_.company; }
+
+    bool isPromoted() const { return tag_.has_value(); }
+
+    void setId(int id) { promote().setId(id); }
+    void setName(std::string name) { promote().setName(std::move(name)); }
+    void setCompany(std::string_view company) { promote().setCompany(company); }
+
+    NameTag& promote();
+
+private:
+    NameTagView view_;
+    std::optional<NameTag> tag_;
+};
@@ -0,0 +1,106 @@
+// Header guard - prevents this file from being included more than once
+#pragma once
+
+// Include the Bio struct, which the snapshot copies
+#include "Bio.h"
+// Include BioAlloc for promoting a snapshot entry back to a FancyNameTag
+#include "BioPool.h"
+// Include CompanyId — snapshot entries keep the interned handle
+#include "CompanyTable.h"
+// Include FancyNameTag, the type the snapshot is taken from
+#include "FancyNameTag.h"
+// Include the pool that runs the copies
+#include "WorkStealingPool.h"
+
+// cstddef for std::size_t
+#include <cstddef>
+// span for the tags to copy and the snapshot's view of its entries
+#include <span>
+// string for getCompany()
+#include <string>
+// vector for the entries and the Bio blocks
+#include <vector>
+
+// One tag in a snapshot: a read-only copy of a FancyNameTag's data.
+// bio points into storage owned by the snapshot, so an entry is only valid
+// while its snapshot is alive.
+struct SnapshotTag {
+    int id;
+    CompanyId company;
+    const Bio* bio; // nullptr if the original tag had been moved from
+
+    const std::string& getCompany() const { return company.str(); }
+    // Throws std::logic_error if the original had been moved from (bio is nullptr)
+    const Bio& getBio() const;
+
+    // Makes an independent, owning FancyNameTag with the same data.
+    // Throws std::logic_error for a moved-from entry: a FancyNameTag can't be
+    // built without a Bio.
+    FancyNameTag toFancyNameTag(BioAlloc alloc = defaultBioAlloc()) const;
+};
+
+// A read-only copy of a FancyNameTag collection, taken in parallel.
+//
+// Copying a std::vector<FancyNameTag> runs the deep-copy constructor once per
+// tag, one after another on one core, and each copy does its own new Bio.
+// parallelSnapshot() instead hands the index range to a WorkStealingPool.
+// Workers split it into ranges, and each range:
+//   1. allocates ONE block with room for all of its Bios
+//   2. copies each tag's Bio into the next place in that block
+//   3. fills in the entries for its indices (the entry array is sized up
+//      front, so no range waits for another)
+//
+// The snapshot owns every block and frees them all at once when it is
+// destroyed, on whatever thread that happens. Nothing goes back to a
+// thread-local free list (as BioAlloc::Pool slots would), so taking and
+// dropping snapshots over and over doesn't leave memory stranded on the
+// worker threads.
+//
+// It is move-only: copying it would be exactly the slow serial copy this
+// exists to avoid.
+class FancyNameTagSnapshot {
+public:
+    FancyNameTagSnapshot() = default;
+    ~FancyNameTagSnapshot();
+
+    FancyNameTagSnapshot(const FancyNameTagSnapshot&) = delete;
+    FancyNameTagSnapshot& operator=(const FancyNameTagSnapshot&) = delete;
+    FancyNameTagSnapshot(FancyNameTagSnapshot&& other) noexcept;
+    FancyNameTagSnapshot& operator=(FancyNameTagSnapshot&& other) noexcept;
+
+    std::size_t size() const { return tags_.size(); }
+    bool empty() const { return tags_.empty(); }
+
+    const SnapshotTag& operator[](std::size_t i) const { return tags_[i]; }
+    auto begin() const { return tags_.begin(); }
+    auto end() const { return tags_.end(); }
+    std::span<const SnapshotTag> tags() const { return tags_; }
+
+    // Number of Bio blocks (one per range the copy was split into)
+    std::size_t blockCount() const { return blocks_.size(); }
+
+private:
+    friend FancyNameTagSnapshot parallelSnapshot(std::span<const FancyNameTag>, WorkStealingPool&,
+                                                 std::size_t);
+
+    // count Bios constructed side by side in one allocation
+    struct BioBlock {
+        Bio* bios;
+        std::size_t count;
+    };
+
+    // Destroys every Bio and frees every block
+    void release() noexcept;
+
+    std::vector<SnapshotTag> tags_;
+    std::vector<BioBlock> blocks_;
+};
+
+// Copies every tag in parallel on pool (see FancyNameTagSnapshot).
+//
+// grain is the largest range one task copies; 0 picks one that gives every
+// worker about four ranges to start with, leaving room for stealing.
+// If any copy throws, everything copied so far is freed and the first
+// exception is rethrown.
+FancyNameTagSnapshot parallelSnapshot(std::span<const FancyNameTag> tags, WorkStealingPool& pool,
+                                      std::size_t grain = 0);
@@ -0,0 +1,124 @@
+// Header guard - prevents this file from being included more than once
+#pragma once
+
+// Include FancyNameTag (and Bio), two of the types we serialize
+#include "FancyNameTag.h"
+// Include NameTag, the third
+#include "NameTag.h"
+// Include NameTagView, what a NameTag record is read back as
+#include "NameTagRegistry.h"
+// Include FancyNameTagView, what a FancyNameTag record is read back as
+#include "RosterFile.h"
+
+// cstddef for std::size_t
+#include <cstddef>
+// cstdint for the fixed-width fields of the format
+#include <cstdint>
+// span for the buffer being read
+#include <span>
+// string_view for zero-copy strings pointing into the buffer
+#include <string_view>
+// vector for the buffer being written
+#include <vector>
+
+// A flat binary encoding of Bios, NameTags and FancyNameTags, for handing
+// tags to another process through shared memory (or a pipe, or a file).
+//
+// "Flat" means a record is one contiguous run of bytes with no pointers in
+// it: lengths, not addresses. The bytes mean the same thing wherever they
+// are mapped, so the reading process can use them in place. Each record is
+//
+//   u32 size      bytes in the whole record, header and padding included
+//   u16 kind      TagRecordKind
+//   u16 version   kTagBufferVersion
+//   i32 ...       the integer fields (id, year)
+//   u32 ...       one length per string
+//   bytes         the strings, back to back, then padding to a multiple of 4
+//
+// All integers are little-endian. Records follow each other directly, so a
+// buffer can hold any mix of them (see TagBufferReader).
+//
+// Reading hands out views: string_views that point straight into the
+// buffer, so reading allocates and copies nothing. The buffer must outlive
+// them. To get a real object, call the view's toBio(), toNameTag() or
+// toFancyNameTag(): each string is copied exactly once, from the buffer into
+// its new std::string, and the Bio built from them is moved (not copied)
+// into the new FancyNameTag.
+
+inline constexpr std::uint16_t kTagBufferVersion = 1;
+
+// What a record holds
+enum class TagRecordKind : std::uint16_t {
+    Bio = 1,
+    NameTag = 2,
+    FancyNameTag = 3
+};
+
+// A read-only look at a serialized Bio
+struct BioView {
+    std::string_view name;
+    std::string_view title;
+    std::string_view department;
+    int year;
+
+    // Makes an owning Bio with the same data
+    Bio toBio() const;
+};
+
+// Bytes serialize() appends for value
+std::size_t serializedSize(const Bio& bio);
+std::size_t serializedSize(const NameTag& tag);
+std::size_t serializedSize(const FancyNameTag& tag);
+
+// Appends one record to out. The FancyNameTag version throws
+// std::invalid_argument for a moved-from tag (it has no Bio), and all of
+// them throw std::length_error if a string is larger than 4 GB.
+void serialize(const Bio& bio, std::vector<char>& out);
+void serialize(const NameTag& tag, std::vector<char>& out);
+void serialize(const FancyNameTag& tag, std::vector<char>& out);
+
+// Reads the records in a buffer one after another.
+//
+//   TagBufferReader reader(buffer);
+//   while (!reader.atEnd()) {
+//       FancyNameTagView view = reader.readFancyNameTag();
+//       ...
+//   }
+//
+// Every record is checked before it is read: a truncated or corrupt buffer
+// (or reading the wrong kind) throws std::runtime_error and leaves the reader
+// where it was. Nothing is ever read outside the buffer.
+class TagBufferReader {
+public:
+    explicit TagBufferReader(std::span<const char> buffer) : buffer_(buffer) {}
+
+    // True when every record has been read
+    bool atEnd() const { return position_ == buffer_.size(); }
+
+    // Byte offset of the next record
+    std::size_t position() const { return position_; }
+
+    // Kind of the next record (doesn't move past it)
+    TagRecordKind nextKind() const;
+
+    // Reads the next record, which must be of that kind
+    BioView readBio();
+    NameTagView readNameTag();
+    FancyNameTagView readFancyNameTag();
+
+    // Moves past the next record, whatever it is
+    void skip();
+
+private:
+    // Checks the next record and splits it into its integers and strings
+    std::size_t readRecord(TagRecordKind kind, std::span<std::int32_t> ints,
+                           std::span<std::string_view> strings) const;
+
+    std::span<const char> buffer_;
+    std::size_t position_ = 0;
+};
+
+// Reads the single record at the start of buffer
+BioView deserializeBio(std::span<const char> buffer);
+NameTagView deserializeNameTag(std::span<const char> buffer);
+FancyNameTagView deserializeFancyNameTag(std::span<const char> buffer);
@@ -0,0 +1,114 @@
+// Header guard - prevents this file from being included more than once
+#pragma once
+
+// Include FancyNameTag, one of the two collections we can search
+#include "FancyNameTag.h"
+// Include NameTag, the other
+#include "NameTag.h"
+
+// cstddef for std::size_t
+#include <cstddef>
+// cstdint for std::uint32_t offsets
+#include <cstdint>
+// span for the tags to index
+#include <span>
+// string for the packed text
+#include <string>
+// string_view for the search text
+#include <string_view>
+// vector for offsets and results
+#include <vector>
+
+// Which strings a search looks at
+enum class SearchField {
+    Name,    // NameTag::getName(), or a FancyNameTag's Bio name
+    Company, // getCompany()
+    Either   // name or company
+};
+
+// The substring-search loop that does the scanning
+enum class SearchKernel {
+    Scalar, // std::string_view::find — works everywhere
+    Sse2,   // 16 bytes per step (x86 with SSE2)
+    Avx2    // 32 bytes per step (x86 with AVX2)
+};
+
+// Answers "which tags have a name or company containing X, ignoring case"
+// without touching the tags themselves.
+//
+// The scalar way is a loop that lower-cases getName()/getCompany() of every
+// tag and calls find() on each — one short string at a time, scattered all
+// over the heap. TagSearch copies the strings ONCE, lower-cased, into one
+// contiguous block ("ann\0bob\0carol\0..."), so a search is a single pass
+// over packed bytes. The SIMD kernels compare 16 or 32 positions at a time
+// against the first and last character of the search text and only check the
+// few positions where both match. When one is found, the match position is
+// mapped back to its tag and the scan jumps to the next tag's string.
+//
+// Companies are interned, so only the distinct company names are packed:
+// a company search scans a few dozen names and then picks the tags whose
+// CompanyId matched.
+//
+// Case folding is ASCII only (A-Z); other bytes, such as UTF-8 sequences,
+// must match exactly. An empty search text matches every tag.
+//
+// TagSearch is a copy: changing or destroying the tags afterwards doesn't
+// affect it (build a new one). Searching is const and safe from many threads.
+class TagSearch {
+public:
+    // Indexes the names and companies of tags. Result i means tags[i].
+    explicit TagSearch(std::span<const NameTag> tags);
+
+    // Same, with each tag's Bio name as its name (empty for a moved-from tag)
+    explicit TagSearch(std::span<const FancyNameTag> tags);
+
+    // Positions (ascending) of the tags whose field contains text, ignoring case
+    std::vector<std::size_t> find(std::string_view text, SearchField field = SearchField::Either) const;
+
+    // Number of tags find() would return
+    std::size_t count(std::string_view text, SearchField field = SearchField::Either) const;
+
+    // Number of tags indexed
+    std::size_t size() const { return companyOfTag_.size(); }
+
+    // Bytes one search over the given field scans
+    std::size_t packedBytes(SearchField field = SearchField::Either) const;
+
+    // The kernel searches use. Starts as bestKernel().
+    SearchKernel kernel() const { return kernel_; }
+
+    // Switches kernels (for tests and benchmarks).
+    // Throws std::invalid_argument if this CPU can't run it.
+    void setKernel(SearchKernel kernel);
+
+    // Fastest kernel this CPU supports (checked once, at run time)
+    static SearchKernel bestKernel();
+
+    // Returns true if this CPU (and this build) can run the kernel
+    static bool isSupported(SearchKernel kernel);
+
+private:
+    // One field's strings, lower-cased and packed back to back
+    struct PackedText {
+        std::string text;                  // each string followed by '\0'
+        std::vector<std::uint32_t> starts; // where string i begins, plus text.size() at the end
+
+        void add(std::string_view value);
+        // Calls hit(i) once for every string i that contains needle
+        template <typename Hit>
+        void forEachMatch(std::string_view needle, SearchKernel kernel, Hit hit) const;
+    };
+
+    // Building: packs one tag's name (and its company, the first time it is seen)
+    void add(std::string_view name, CompanyId company, std::vector<std::uint32_t>& companyIndex);
+    // Building: closes both texts after the last add()
+    void finish();
+
+    // Sets hits[i] for every tag that matches
+    void mark(std::string_view text, SearchField field, std::vector<unsigned char>& hits) const;
+
+    PackedText names_;                       // one string per tag
+    PackedText companies_;                   // one string per distinct company
+    std::vector<std::uint32_t> companyOfTag_; // index into companies_ for each tag
+    SearchKernel kernel_ = bestKernel();
+};
@@ -0,0 +1,121 @@
+// Header guard - prevents this file from being included more than once
+#pragma once
+
+// Include ShortAddr so addresses can be added to a trace line
+#include "AddrUtil.h"
+// Include Bio so a whole Bio can be added to a trace line
+#include "Bio.h"
+// Include the allocation-free formatting helpers
+#include "FormatUtil.h"
+
+// iostream for std::cout (where verbose and buffered traces end up)
+#include <iostream>
+// string for the line buffer
+#include <string>
+// string_view for text pieces
+#include <string_view>
+
+// Lifecycle tracing: the "Constructor (STACK ...)", "Copy Constructor ...",
+// "Move Constructor ..." and "Destructor ..." lines the tag classes log.
+//
+// Those lines are great for learning, but writing every one to std::cout
+// makes every thread wait on the stream and makes the classes useless in a
+// hot loop. So the tracing policy is chosen at COMPILE time:
+//
+//   None     - trace code is compiled away completely (if constexpr)
+//   Buffered - lines are collected in a per-thread buffer and written to
+//              std::cout in large blocks (when the buffer fills, when
+//              traceFlush() is called, or when the thread exits)
+//   Verbose  - every line is written to std::cout immediately (the default,
+//              and the output you see in main.cpp)
+//
+// Pick one with the CMake option NAMETAG_TRACE (NONE, BUFFERED or VERBOSE),
+// which sets NAMETAG_TRACE_LEVEL to 0, 1 or 2 for every target.
+enum class TraceLevel {
+    None = 0,
+    Buffered = 1,
+    Verbose = 2
+};
+
+#ifndef NAMETAG_TRACE_LEVEL
+#define NAMETAG_TRACE_LEVEL 2
+#endif
+
+// The policy this program was compiled with
+inline constexpr TraceLevel kTraceLevel = static_cast<TraceLevel>(NAMETAG_TRACE_LEVEL);
+
+// Where finished trace lines go, one specialization per policy.
+// Each has:
+//   enabled      - false only for None
+//   emit(line)   - takes one complete line (including its '\n')
+//   flush()      - pushes out anything still buffered
+template <TraceLevel Level>
+struct Tracer;
+
+template <>
+struct Tracer<TraceLevel::None> {
+    static constexpr bool enabled = false;
+    static void emit(std::string_view) {}
+    static void flush() {}
+};
+
+template <>
+struct Tracer<TraceLevel::Buffered> {
+    static constexpr bool enabled = true;
+    static void emit(std::string_view line);
+    static void flush();
+};
+
+template <>
+struct Tracer<TraceLevel::Verbose> {
+    static constexpr bool enabled = true;
+    static void emit(std::string_view line) {
+        std::cout.write(line.data(), static_cast<std::streamsize>(line.size()));
+    }
+    static void flush() { std::cout.flush(); }
+};
+
+// The tracer selected by NAMETAG_TRACE
+using ActiveTracer = Tracer<kTraceLevel>;
+
+// True unless tracing is compiled out. Use it with if constexpr:
+//
+//   if constexpr (kTraceEnabled) {
+//       TraceLine() << "Constructor (STACK " << shortAddr(this) << ")\n";
+//   }
+inline constexpr bool kTraceEnabled = ActiveTracer::enabled;
+
+// Writes out this thread's buffered trace lines (does nothing for None)
+inline void traceFlush() { ActiveTracer::flush(); }
+
+// Builds one trace line with << like std::cout, then hands it to the tracer
+// when the statement ends (the temporary TraceLine is destroyed).
+//
+// The text goes into a per-thread std::string that is reused for every line,
+// so building a line doesn't allocate once that string has grown.
+template <typename Sink = ActiveTracer>
+class BasicTraceLine {
+public:
+    BasicTraceLine() : line_(scratch()) { line_.clear(); }
+    ~BasicTraceLine() { Sink::emit(line_); }
+
+    BasicTraceLine(const BasicTraceLine&) = delete;
+    BasicTraceLine& operator=(const BasicTraceLine&) = delete;
+
+    BasicTraceLine& operator<<(std::string_view text) { line_.append(text); return *this; }
+    BasicTraceLine& operator<<(char c) { line_.push_back(c); return *this; }
+    BasicTraceLine& operator<<(int value) { appendInt(line_, value); return *this; }
+    BasicTraceLine& operator<<(const ShortAddr& addr) { line_.append(addr.view()); return *this; }
+    // A Bio is written the same way Bio::print() writes it
+    BasicTraceLine& operator<<(const Bio& bio) { bio.appendTo(line_); return *this; }
+
+private:
+    static std::string& scratch() {
+        thread_local std::string buffer;
+        return buffer;
+    }
+
+    std::string& line_;
+};
+
+using TraceLine = BasicTraceLine<>;
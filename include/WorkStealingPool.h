@@ -0,0 +1,93 @@
+// Header guard - prevents this file from being included more than once
+#pragma once
+
+// atomic for the pending-task and steal counters
+#include <atomic>
+// condition_variable and mutex for sleeping workers and per-worker deques
+#include <condition_variable>
+#include <mutex>
+// cstddef for std::size_t
+#include <cstddef>
+// cstdint for std::uint64_t
+#include <cstdint>
+// deque for each worker's task deque
+#include <deque>
+// functional for std::function (tasks and loop bodies)
+#include <functional>
+// memory for std::unique_ptr (workers hold a mutex, so they can't move)
+#include <memory>
+// thread for the workers
+#include <thread>
+// vector for the workers
+#include <vector>
+
+// A fixed set of worker threads, each with its own deque of tasks.
+//
+// A worker pushes the tasks it creates onto the BACK of its own deque and
+// pops from the back too (newest first — that work's data is still in its
+// cache). A worker with nothing left steals from the FRONT of another
+// worker's deque: the oldest task there, which for a recursively split loop
+// is the biggest remaining piece. So one worker can start a whole loop and
+// the others pull it apart between them, without a central queue that every
+// thread fights over.
+//
+// Each deque has its own mutex. Owners and thieves only contend when they hit
+// the same deque at the same moment.
+class WorkStealingPool {
+public:
+    // Starts threads workers (0: one per hardware thread)
+    explicit WorkStealingPool(std::size_t threads = 0);
+
+    // Runs every task already submitted, then stops the workers
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    std::size_t size() const { return threads_.size(); }
+
+    // Queues a task. From one of this pool's workers it goes onto that
+    // worker's own deque; from any other thread the workers take turns.
+    void submit(std::function<void()> task);
+
+    // Calls body(begin, end) on ranges covering [0, count), each at most
+    // grain long, in parallel. Blocks until every range is done and rethrows
+    // the first exception a body threw (the other ranges still run).
+    //
+    // The whole range starts as one task that keeps splitting itself in half,
+    // so idle workers can steal big halves early on.
+    // Safe to call from inside a task (the calling worker helps instead of waiting).
+    void parallelFor(std::size_t count, std::size_t grain,
+                     const std::function<void(std::size_t begin, std::size_t end)>& body);
+
+    // Number of tasks a worker took from another worker's deque
+    std::uint64_t steals() const { return steals_.load(std::memory_order_relaxed); }
+
+    // Index (0..size()-1) of the pool worker running the calling thread,
+    // or size() if the caller is not one of this pool's workers
+    std::size_t currentWorker() const;
+
+private:
+    struct Worker {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    void push(std::size_t worker, std::function<void()> task);
+    bool popLocal(std::size_t worker, std::function<void()>& task);
+    bool steal(std::size_t thief, std::function<void()>& task);
+    // Takes one task from anywhere and runs it. Returns false if there was none.
+    bool runOne(std::size_t worker);
+    void work(std::size_t worker);
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::vector<std::thread> threads_;
+
+    std::atomic<std::size_t> pending_{0};   // queued, not yet taken
+    std::atomic<std::size_t> nextWorker_{0}; // round-robin target for outside submits
+    std::atomic<std::uint64_t> steals_{0};
+
+    std::mutex sleepMutex_;
+    std::condition_variable wake_;
+    bool stopping_ = false;
+};
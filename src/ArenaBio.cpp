@@ -0,0 +1,154 @@
+// Include the ArenaBio class declaration
+#include "ArenaBio.h"
+// Include the allocation-free formatting helpers
+#include "FormatUtil.h"
+
+// algorithm for std::copy and std::equal
+#include <algorithm>
+// iostream for std::cout in print()
+#include <iostream>
+// stdexcept for std::length_error
+#include <stdexcept>
+// utility for std::exchange
+#include <utility>
+
+namespace {
+
+// A new block holding a copy of size chars (nullptr for none)
+std::unique_ptr<char[]> copyBlock(const char* chars, std::size_t size) {
+    if (size == 0) {
+        return nullptr;
+    }
+    std::unique_ptr<char[]> block = std::make_unique_for_overwrite<char[]>(size);
+    std::copy(chars, chars + size, block.get());
+    InstanceCounter<ArenaBio>::addHeapBytes(size);
+    return block;
+}
+
+} // namespace
+
+// ==================== Construction ====================
+
+ArenaBio::ArenaBio(std::string_view name, std::string_view title, std::string_view department, int year)
+    : year_(year) {
+    assign(name, title, department);
+}
+
+ArenaBio::ArenaBio(const Bio& bio) : year_(bio.year) {
+    assign(bio.name, bio.title, bio.department);
+}
+
+// Measures first, allocates once, then copies the three strings in order.
+// Only called on an ArenaBio that holds no block yet.
+void ArenaBio::assign(std::string_view name, std::string_view title, std::string_view department) {
+    const std::size_t size = name.size() + title.size() + department.size();
+    if (size > UINT32_MAX) {
+        throw std::length_error("ArenaBio strings add up to more than 4 GB");
+    }
+    if (size > 0) {
+        chars_ = std::make_unique_for_overwrite<char[]>(size);
+        char* end = std::copy(name.begin(), name.end(), chars_.get());
+        end = std::copy(title.begin(), title.end(), end);
+        std::copy(department.begin(), department.end(), end);
+        InstanceCounter<ArenaBio>::addHeapBytes(size);
+    }
+    titleStart_ = static_cast<std::uint32_t>(name.size());
+    departmentStart_ = static_cast<std::uint32_t>(name.size() + title.size());
+    size_ = static_cast<std::uint32_t>(size);
+}
+
+// ==================== Copy and move ====================
+
+// The offsets say where the strings are inside the block, so they are the
+// same in the copy; only the block itself is new
+ArenaBio::ArenaBio(const ArenaBio& other)
+    : titleStart_(other.titleStart_),
+      departmentStart_(other.departmentStart_),
+      size_(other.size_),
+      year_(other.year_),
+      counted_(other.counted_) {
+    chars_ = copyBlock(other.chars_.get(), size_);
+}
+
+// The new block is made before anything changes: if the allocation throws,
+// this ArenaBio is left as it was. The old block is freed by unique_ptr.
+ArenaBio& ArenaBio::operator=(const ArenaBio& other) {
+    if (this != &other) {
+        chars_ = copyBlock(other.chars_.get(), other.size_);
+        titleStart_ = other.titleStart_;
+        departmentStart_ = other.departmentStart_;
+        size_ = other.size_;
+        year_ = other.year_;
+        counted_ = other.counted_;
+    }
+    return *this;
+}
+
+ArenaBio::ArenaBio(ArenaBio&& other) noexcept
+    : chars_(std::move(other.chars_)),
+      titleStart_(std::exchange(other.titleStart_, 0)),
+      departmentStart_(std::exchange(other.departmentStart_, 0)),
+      size_(std::exchange(other.size_, 0)),
+      year_(other.year_),
+      counted_(std::move(other.counted_)) {}
+
+ArenaBio& ArenaBio::operator=(ArenaBio&& other) noexcept {
+    if (this != &other) {
+        chars_ = std::move(other.chars_);
+        titleStart_ = std::exchange(other.titleStart_, 0);
+        departmentStart_ = std::exchange(other.departmentStart_, 0);
+        size_ = std::exchange(other.size_, 0);
+        year_ = other.year_;
+        counted_ = std::move(other.counted_);
+    }
+    return *this;
+}
+
+// ==================== Conversion and output ====================
+
+Bio ArenaBio::toBio() const {
+    return Bio{std::string(name()), std::string(title()), std::string(department()), year_};
+}
+
+// Same format as Bio::print(): name, title, department, year
+void ArenaBio::print() const {
+    std::cout << name()
+              << ", "
+              << title()
+              << ", "
+              << department()
+              << ", "
+              << year_;
+}
+
+// Same text as print(), appended to a caller-owned buffer
+void ArenaBio::appendTo(std::string& out) const {
+    out.append(name());
+    out.append(", ");
+    out.append(title());
+    out.append(", ");
+    out.append(department());
+    out.append(", ");
+    appendInt(out, year_);
+}
+
+// ==================== Comparison ====================
+
+bool ArenaBio::operator==(const ArenaBio& other) const {
+    return year_ == other.year_ && titleStart_ == other.titleStart_ &&
+           departmentStart_ == other.departmentStart_ && size_ == other.size_ &&
+           std::equal(chars_.get(), chars_.get() + size_, other.chars_.get());
+}
+
+std::strong_ordering ArenaBio::operator<=>(const ArenaBio& other) const {
+    if (const auto order = name() <=> other.name(); order != 0) {
+        return order;
+    }
+    if (const auto order = title() <=> other.title(); order != 0) {
+        return order;
+    }
+    if (const auto order = department() <=> other.department(); order != 0) {
+        return order;
+    }
+    return year_ <=> other.year_;
+}
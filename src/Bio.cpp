@@ -1,9 +1,39 @@
 // Include the Bio struct declaration
 #include "Bio.h"
+// Include the allocation-free formatting helpers
+#include "FormatUtil.h"
+// Include the hash-combining helpers
+#include "HashUtil.h"
 
 // Prints all Bio fields in a comma-separated format
+// Output format: name, title, department, year
+// Example output: "Scott, Professor, Computer Science, 2010"
 void Bio::print() const {
-    // TODO: Output each field separated by commas using std::cout
-    // Output format: name, title, department, year
-    // Example output: "Scott, Professor, Computer Science, 2010"
+    std::cout << name
+              << ", "
+              << title
+              << ", "
+              << department
+              << ", "
+              << year;
+}
+
+// Same text as print(), appended to a caller-owned buffer
+void Bio::appendTo(std::string& out) const {
+    out.append(name);
+    out.append(", ");
+    out.append(title);
+    out.append(", ");
+    out.append(department);
+    out.append(", ");
+    appendInt(out, year);
+}
+
+// Mixes every field into one hash (the same fields operator== compares)
+std::size_t std::hash<Bio>::operator()(const Bio& bio) const noexcept {
+    std::uint64_t seed = hashCombine(0, bio.name);
+    seed = hashCombine(seed, bio.title);
+    seed = hashCombine(seed, bio.department);
+    seed = hashCombine(seed, static_cast<std::uint64_t>(bio.year));
+    return static_cast<std::size_t>(seed);
 }
@@ -0,0 +1,292 @@
+// Include the BioPool declarations
+#include "BioPool.h"
+
+// algorithm for std::max
+#include <algorithm>
+// array for the per-thread free list heads
+#include <array>
+// atomic for the process-wide default strategy and Shared reference counts
+#include <atomic>
+// mutex to guard the shared chunk list
+#include <mutex>
+// new for placement new and ::operator new
+#include <new>
+// utility for std::forward and std::move
+#include <utility>
+// vector to remember every chunk we allocate
+#include <vector>
+
+namespace {
+
+// Number of size classes: kGranularity, 2 * kGranularity, ... kMaxSize
+constexpr std::size_t kClassCount = BioPool::kMaxSize / BioPool::kGranularity;
+
+// A free slot stores the pointer to the next free slot inside itself,
+// so the free list needs no extra memory.
+struct FreeSlot {
+    FreeSlot* next;
+};
+
+// One free list per size class, per thread.
+// thread_local means every thread gets its own copy, so no locking is needed
+// to push or pop slots.
+struct ThreadFreeLists {
+    std::array<FreeSlot*, kClassCount> heads{};
+    std::array<std::size_t, kClassCount> counts{};
+};
+
+thread_local ThreadFreeLists t_lists;
+
+// Every chunk ever allocated. Chunks are only needed again at program exit,
+// so a mutex here costs nothing on the hot path.
+// The list is intentionally never destroyed: a tag destroyed during static
+// destruction may still return its slot to a chunk, so the chunks must outlive
+// every other static object.
+struct ChunkList {
+    std::mutex mutex;
+    std::vector<void*> chunks;
+};
+
+ChunkList& chunkList() {
+    static ChunkList* list = new ChunkList;
+    return *list;
+}
+
+// Process-wide default strategy (Heap keeps the original new/delete behavior)
+std::atomic<BioAlloc> g_defaultAlloc{BioAlloc::Heap};
+
+// A Shared Bio lives right after a small header holding its reference count:
+//
+//   [ refs | padding ][ Bio ]
+//   ^ block           ^ the Bio* handed to FancyNameTag
+//
+// The header is padded to kGranularity so the Bio stays suitably aligned,
+// and we can step back from the Bio* to its header with plain pointer math.
+struct SharedHeader {
+    std::atomic<std::size_t> refs;
+};
+
+constexpr std::size_t kSharedHeaderSize =
+    (sizeof(SharedHeader) + BioPool::kGranularity - 1) / BioPool::kGranularity * BioPool::kGranularity;
+constexpr std::size_t kSharedBlockSize = kSharedHeaderSize + sizeof(Bio);
+
+SharedHeader* sharedHeader(const Bio* bio) {
+    auto* bytes = reinterpret_cast<unsigned char*>(const_cast<Bio*>(bio));
+    return reinterpret_cast<SharedHeader*>(bytes - kSharedHeaderSize);
+}
+
+// Builds a header + Bio block with a reference count of 1.
+// Shared blocks come from the pool too, since the last reference may be dropped
+// on any thread and the pool accepts slots from anywhere.
+// BioArg is const Bio& (copy) or Bio (move).
+template <typename BioArg>
+Bio* createShared(BioArg&& bio) {
+    auto* block = static_cast<unsigned char*>(BioPool::allocate(kSharedBlockSize));
+    try {
+        Bio* shared = new (block + kSharedHeaderSize) Bio(std::forward<BioArg>(bio));
+        new (block) SharedHeader{1};
+        return shared;
+    } catch (...) {
+        BioPool::deallocate(block, kSharedBlockSize);
+        throw;
+    }
+}
+
+// Drops one reference and frees the block when it was the last one
+void releaseShared(Bio* bio) noexcept {
+    SharedHeader* header = sharedHeader(bio);
+    // acq_rel: our writes to the Bio happen-before whoever frees it
+    if (header->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        bio->~Bio();
+        header->~SharedHeader();
+        BioPool::deallocate(header, kSharedBlockSize);
+    }
+}
+
+// Maps a request size to its size class index (0 for 0..16 bytes, etc.).
+// A zero-byte request still gets a real slot (like ::operator new(0)), so it
+// goes in the smallest class instead of wrapping around to SIZE_MAX.
+std::size_t sizeClass(std::size_t bytes) {
+    bytes = std::max<std::size_t>(bytes, 1);
+    return (bytes + BioPool::kGranularity - 1) / BioPool::kGranularity - 1;
+}
+
+// Allocates one chunk holding count slots of the given class and pushes all of
+// them onto this thread's free list.
+void refill(std::size_t cls, std::size_t count) {
+    const std::size_t slotSize = (cls + 1) * BioPool::kGranularity;
+    // ::operator new returns memory aligned for any fundamental type
+    auto* chunk = static_cast<unsigned char*>(::operator new(slotSize * count));
+    {
+        ChunkList& list = chunkList();
+        std::lock_guard<std::mutex> lock(list.mutex);
+        list.chunks.push_back(chunk);
+    }
+    // Thread the new slots onto the front of the free list
+    for (std::size_t i = 0; i < count; ++i) {
+        auto* slot = reinterpret_cast<FreeSlot*>(chunk + i * slotSize);
+        slot->next = t_lists.heads[cls];
+        t_lists.heads[cls] = slot;
+    }
+    t_lists.counts[cls] += count;
+}
+
+} // namespace
+
+// Returns the process-wide default allocation strategy
+BioAlloc defaultBioAlloc() {
+    return g_defaultAlloc.load(std::memory_order_relaxed);
+}
+
+// Sets the process-wide default allocation strategy
+void setDefaultBioAlloc(BioAlloc alloc) {
+    g_defaultAlloc.store(alloc, std::memory_order_relaxed);
+}
+
+// Pops a slot from this thread's free list, refilling it with a new chunk if empty
+void* BioPool::allocate(std::size_t bytes) {
+    // Oversized requests are not worth pooling
+    if (bytes > kMaxSize) {
+        return ::operator new(bytes);
+    }
+    const std::size_t cls = sizeClass(bytes);
+    if (t_lists.heads[cls] == nullptr) {
+        refill(cls, kSlotsPerChunk);
+    }
+    FreeSlot* slot = t_lists.heads[cls];
+    t_lists.heads[cls] = slot->next;
+    --t_lists.counts[cls];
+    return slot;
+}
+
+// Pushes the slot onto this thread's free list (never touches the global heap)
+void BioPool::deallocate(void* slot, std::size_t bytes) noexcept {
+    if (slot == nullptr) {
+        return;
+    }
+    if (bytes > kMaxSize) {
+        ::operator delete(slot);
+        return;
+    }
+    const std::size_t cls = sizeClass(bytes);
+    auto* freed = static_cast<FreeSlot*>(slot);
+    freed->next = t_lists.heads[cls];
+    t_lists.heads[cls] = freed;
+    ++t_lists.counts[cls];
+}
+
+// Tops up this thread's free list with a single chunk sized to the shortfall
+void BioPool::reserve(std::size_t count, std::size_t bytes) {
+    if (bytes > kMaxSize) {
+        return;
+    }
+    const std::size_t cls = sizeClass(bytes);
+    if (t_lists.counts[cls] < count) {
+        refill(cls, count - t_lists.counts[cls]);
+    }
+}
+
+// Returns how many free slots this thread holds for the given size
+std::size_t BioPool::freeSlots(std::size_t bytes) {
+    if (bytes > kMaxSize) {
+        return 0;
+    }
+    return t_lists.counts[sizeClass(bytes)];
+}
+
+namespace {
+
+// Shared by both createBio() overloads: BioArg is const Bio& or Bio
+template <typename BioArg>
+Bio* createBioFrom(BioAlloc alloc, BioArg&& bio) {
+    if (alloc == BioAlloc::Pool) {
+        void* slot = BioPool::allocate(sizeof(Bio));
+        // Placement new: construct the Bio inside memory we already have.
+        // If the Bio copy throws, give the slot back before rethrowing.
+        try {
+            return new (slot) Bio(std::forward<BioArg>(bio));
+        } catch (...) {
+            BioPool::deallocate(slot, sizeof(Bio));
+            throw;
+        }
+    }
+    if (alloc == BioAlloc::Shared) {
+        return createShared(std::forward<BioArg>(bio));
+    }
+    return new Bio(std::forward<BioArg>(bio));
+}
+
+} // namespace
+
+// Allocates a copy of bio with the requested strategy
+Bio* createBio(BioAlloc alloc, const Bio& bio) {
+    return createBioFrom(alloc, bio);
+}
+
+// Allocates a new Bio that takes over bio's strings
+Bio* createBio(BioAlloc alloc, Bio&& bio) {
+    return createBioFrom(alloc, std::move(bio));
+}
+
+// Deep copies for Heap/Pool, shares (one more reference) for Shared
+Bio* copyBio(BioAlloc alloc, Bio* bio) {
+    if (alloc == BioAlloc::Shared) {
+        // relaxed is enough to add a reference: the caller already holds one,
+        // so the Bio can't be freed underneath us
+        sharedHeader(bio)->refs.fetch_add(1, std::memory_order_relaxed);
+        return bio;
+    }
+    return createBio(alloc, *bio);
+}
+
+// Destroys a Bio with the strategy that created it
+void destroyBio(BioAlloc alloc, Bio* bio) noexcept {
+    if (bio == nullptr) {
+        return;
+    }
+    if (alloc == BioAlloc::Shared) {
+        releaseShared(bio);
+        return;
+    }
+    if (alloc == BioAlloc::Pool) {
+        // Placement-new objects must be destroyed by calling the destructor
+        // directly, then the memory is returned to the pool
+        bio->~Bio();
+        BioPool::deallocate(bio, sizeof(Bio));
+        return;
+    }
+    delete bio;
+}
+
+// Clones a Shared Bio that other tags still refer to (copy-on-write)
+Bio* makeBioUnique(BioAlloc alloc, Bio* bio) {
+    if (alloc != BioAlloc::Shared || bioUseCount(alloc, bio) == 1) {
+        return bio;
+    }
+    Bio* clone = createShared(*bio);
+    releaseShared(bio);
+    return clone;
+}
+
+// Rounds up to what the pool really hands out (Heap uses plain new)
+std::size_t bioAllocationBytes(BioAlloc alloc) {
+    const auto slotBytes = [](std::size_t bytes) {
+        return bytes > BioPool::kMaxSize ? bytes : (sizeClass(bytes) + 1) * BioPool::kGranularity;
+    };
+    switch (alloc) {
+        case BioAlloc::Pool: return slotBytes(sizeof(Bio));
+        case BioAlloc::Shared: return slotBytes(kSharedBlockSize);
+        case BioAlloc::Heap: break;
+    }
+    return sizeof(Bio);
+}
+
+// Returns the reference count of a Shared Bio (1 for the other strategies)
+std::size_t bioUseCount(BioAlloc alloc, const Bio* bio) {
+    if (alloc != BioAlloc::Shared || bio == nullptr) {
+        return bio == nullptr ? 0 : 1;
+    }
+    // acquire pairs with releaseShared(), so a count of 1 means every other
+    // owner is completely done with the Bio
+    return sharedHeader(bio)->refs.load(std::memory_order_acquire);
+}
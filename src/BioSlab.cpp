@@ -0,0 +1,114 @@
+// Include the BioSlab declaration
+#include "BioSlab.h"
+
+// mutex for the free list
+#include <mutex>
+// stdexcept for std::logic_error and std::length_error
+#include <stdexcept>
+// utility for std::forward and std::move
+#include <utility>
+// vector for the free list
+#include <vector>
+
+// Zero-initialized at compile time, so the slab is usable before main() and
+// from any static initializer
+std::atomic<BioSlab::Slot*> BioSlab::chunks_[BioSlab::kMaxChunks];
+
+namespace {
+
+// Everything create()/destroy() change, behind one lock
+struct FreeList {
+    std::mutex mutex;
+    std::vector<std::uint32_t> indices; // freed slots, reused last-in first-out
+    std::uint32_t nextUnused = 0;       // first slot never handed out
+    std::size_t live = 0;
+};
+
+FreeList& freeList() {
+    // Intentionally leaked: tags with static storage may be destroyed after
+    // this translation unit's statics
+    static FreeList* list = new FreeList;
+    return *list;
+}
+
+} // namespace
+
+BioSlab::Slot& BioSlab::slotAt(std::uint32_t index) {
+    return chunks_[index / kSlotsPerChunk].load(std::memory_order_relaxed)[index % kSlotsPerChunk];
+}
+
+std::uint32_t BioSlab::claimSlot() {
+    FreeList& list = freeList();
+    if (!list.indices.empty()) {
+        const std::uint32_t index = list.indices.back();
+        list.indices.pop_back();
+        return index;
+    }
+    const std::uint32_t index = list.nextUnused;
+    const std::size_t chunk = index / kSlotsPerChunk;
+    if (chunk >= kMaxChunks) {
+        throw std::length_error("BioSlab is full");
+    }
+    if (index % kSlotsPerChunk == 0) {
+        // Room for every index this chunk brings, so destroy() never allocates
+        list.indices.reserve(index + kSlotsPerChunk);
+        // release: a get() on another thread that sees the chunk sees its slots
+        chunks_[chunk].store(new Slot[kSlotsPerChunk], std::memory_order_release);
+    }
+    ++list.nextUnused;
+    return index;
+}
+
+// Construct the Bio first, then make the slot's generation odd
+template <typename BioArg>
+BioHandle BioSlab::createIn(BioArg&& bio) {
+    FreeList& list = freeList();
+    std::lock_guard<std::mutex> lock(list.mutex);
+    const std::uint32_t index = claimSlot();
+    Slot& slot = slotAt(index);
+    try {
+        new (slot.storage) Bio(std::forward<BioArg>(bio));
+    } catch (...) {
+        list.indices.push_back(index); // fits: claimSlot() popped it or reserved room for it
+        throw;
+    }
+    const auto generation = static_cast<std::uint8_t>(slot.generation.load(std::memory_order_relaxed) + 1);
+    slot.generation.store(generation, std::memory_order_relaxed);
+    ++list.live;
+    return BioHandle{index, generation};
+}
+
+BioHandle BioSlab::create(const Bio& bio) {
+    return createIn(bio);
+}
+
+BioHandle BioSlab::create(Bio&& bio) {
+    return createIn(std::move(bio));
+}
+
+void BioSlab::destroy(BioHandle handle) noexcept {
+    FreeList& list = freeList();
+    std::lock_guard<std::mutex> lock(list.mutex);
+    Bio* bio = find(handle);
+    if (!bio) {
+        return;
+    }
+    bio->~Bio();
+    // Even again: this handle (and every copy of it) is stale from now on
+    slotAt(handle.index).generation.store(static_cast<std::uint8_t>(handle.generation + 1),
+                                          std::memory_order_relaxed);
+    --list.live;
+    // Can't throw: claimSlot() reserved room for every index ever handed out
+    list.indices.push_back(handle.index);
+}
+
+std::size_t BioSlab::liveCount() {
+    FreeList& list = freeList();
+    std::lock_guard<std::mutex> lock(list.mutex);
+    return list.live;
+}
+
+void BioSlab::throwBadHandle(BioHandle handle) {
+    throw std::logic_error(handle.empty() ? "BioSlab handle is empty (the tag was moved from)"
+                                          : "BioSlab handle is stale (its Bio was destroyed)");
+}
@@ -0,0 +1,243 @@
+// Include the CompactFancyNameTag class declaration
+#include "CompactFancyNameTag.h"
+// Include the short address utility for readable output
+#include "AddrUtil.h"
+// Include the allocation-free formatting helpers used by appendTo
+#include "FormatUtil.h"
+// Include the compile-time lifecycle tracing policy
+#include "Trace.h"
+// Include iomanip for std::setw and std::left (column alignment in print)
+#include <iomanip>
+// utility for std::exchange
+#include <utility>
+
+// Id + CompanyId + BioHandle, with no padding
+static_assert(sizeof(CompactFancyNameTag) == 12, "CompactFancyNameTag should stay three 32-bit fields");
+
+namespace {
+
+// Same validation (and messages) as FancyNameTag
+void validateBio(const Bio& bio) {
+    if (bio.name.empty()) {
+        throw std::invalid_argument("FancyNameTag bio name must not be empty");
+    }
+    if (bio.title.empty()) {
+        throw std::invalid_argument("FancyNameTag bio title must not be empty");
+    }
+    if (bio.year <= 0) {
+        throw std::invalid_argument("FancyNameTag bio year must be positive");
+    }
+}
+
+// Where the Bio is, for log lines and print() (nullptr for a moved-from tag)
+const Bio* bioAddress(BioHandle handle) {
+    return handle.empty() ? nullptr : &BioSlab::get(handle);
+}
+
+} // namespace
+
+// Constructor: validates everything first, then copies the Bio into the slab
+CompactFancyNameTag::CompactFancyNameTag(int id, std::string_view company, const Bio& bio)
+    : id_(id) {
+
+    if (id_ <= 0) {
+        throw std::invalid_argument("FancyNameTag id must be positive");
+    }
+    if (company.empty()) {
+        throw std::invalid_argument("FancyNameTag company must not be empty");
+    }
+    validateBio(bio);
+    // Interned last: the table never frees a name, so a rejected tag must not add one
+    company_ = CompanyTable::intern(company);
+    bio_ = BioSlab::create(bio);
+
+    if constexpr (kTraceEnabled) {
+        TraceLine() << "Constructor (STACK " << shortAddr(this) << "): id=" << id_
+                    << ", company=\"" << company_.str() << "\", bio={" << getBio()
+                    << "} (SLAB " << shortAddr(&getBio()) << ")\n";
+    }
+}
+
+// Destructor: frees the slot; any copy of our handle is stale from here on
+CompactFancyNameTag::~CompactFancyNameTag() {
+    if constexpr (kTraceEnabled) {
+        TraceLine line;
+        line << "Destructor (STACK " << shortAddr(this) << "): id=" << id_ << ", bio=";
+        if (hasBio()) {
+            line << "{" << getBio() << "} (SLAB " << shortAddr(&getBio()) << ")";
+        } else {
+            line << "(moved)";
+        }
+        line << "\n";
+    }
+    BioSlab::destroy(bio_);
+}
+
+// Copy constructor: deep copy into a new slot (a moved-from source has nothing to copy)
+CompactFancyNameTag::CompactFancyNameTag(const CompactFancyNameTag& other)
+    : id_(other.id_),
+      company_(other.company_),
+      bio_(other.hasBio() ? BioSlab::create(other.getBio()) : BioHandle{}) {
+    if constexpr (kTraceEnabled) {
+        TraceLine() << "Copy Constructor (STACK " << shortAddr(this) << "): id=" << id_
+                    << ", copied bio from SLAB " << shortAddr(bioAddress(other.bio_))
+                    << " to SLAB " << shortAddr(bioAddress(bio_)) << "\n";
+    }
+}
+
+// Move constructor: the handle is two integers, so "stealing" it is a copy
+// followed by emptying the source
+CompactFancyNameTag::CompactFancyNameTag(CompactFancyNameTag&& other) noexcept
+    : id_(other.id_),
+      company_(other.company_),
+      bio_(std::exchange(other.bio_, BioHandle{})) {
+    if constexpr (kTraceEnabled) {
+        TraceLine() << "Move Constructor (STACK " << shortAddr(this) << "): id=" << id_
+                    << ", took ownership of bio at SLAB " << shortAddr(bioAddress(bio_)) << "\n";
+    }
+}
+
+// Copy assignment: same order as FancyNameTag — make the copy (may throw),
+// then free our old slot
+CompactFancyNameTag& CompactFancyNameTag::operator=(const CompactFancyNameTag& other) {
+    if (this == &other) {
+        return *this;
+    }
+    const BioHandle replacement = other.hasBio() ? BioSlab::create(other.getBio()) : BioHandle{};
+    BioSlab::destroy(std::exchange(bio_, replacement));
+    id_ = other.id_;
+    company_ = other.company_;
+
+    if constexpr (kTraceEnabled) {
+        TraceLine() << "Copy Assignment (STACK " << shortAddr(this) << "): id=" << id_
+                    << ", copied bio from SLAB " << shortAddr(bioAddress(other.bio_))
+                    << " to SLAB " << shortAddr(bioAddress(bio_)) << "\n";
+    }
+    return *this;
+}
+
+// Move assignment: free our slot, take the source's handle
+CompactFancyNameTag& CompactFancyNameTag::operator=(CompactFancyNameTag&& other) noexcept {
+    if (this == &other) {
+        return *this;
+    }
+    BioSlab::destroy(std::exchange(bio_, std::exchange(other.bio_, BioHandle{})));
+    id_ = other.id_;
+    company_ = other.company_;
+
+    if constexpr (kTraceEnabled) {
+        TraceLine() << "Move Assignment (STACK " << shortAddr(this) << "): id=" << id_
+                    << ", took ownership of bio at SLAB " << shortAddr(bioAddress(bio_)) << "\n";
+    }
+    return *this;
+}
+
+// Prints the same columns as FancyNameTag::print
+void CompactFancyNameTag::print(const std::string& label, const std::string& state) const {
+    std::cout << std::right
+              << std::setw(18)
+              << label
+              << "  STACK "
+              << shortAddr(this)
+              << "  id="
+              << std::left
+              << std::setw(6)
+              << id_
+              << "company="
+              << std::setw(30)
+              << ("\"" + company_.str() + "\"")
+              << "bio=";
+
+    if (hasBio()) {
+        std::cout << "{";
+        getBio().print();
+        std::cout << "} SLAB "
+                  << shortAddr(&getBio());
+    } else {
+        std::cout << "(moved)";
+    }
+    if (!state.empty()) {
+        std::cout << "  ("
+                  << state
+                  << ")";
+    }
+    std::cout << "\n";
+}
+
+// Same columns as print(), appended to a caller-owned buffer
+void CompactFancyNameTag::appendTo(std::string& out, std::string_view label, std::string_view state) const {
+    appendRight(out, label, 18);
+    out.append("  STACK ");
+    appendShortAddr(out, this);
+    out.append("  id=");
+    appendInt(out, id_, 6);
+    out.append("company=");
+    appendQuotedLeft(out, company_.str(), 30);
+    out.append("bio=");
+    if (hasBio()) {
+        out.push_back('{');
+        getBio().appendTo(out);
+        out.append("} SLAB ");
+        appendShortAddr(out, &getBio());
+    } else {
+        out.append("(moved)");
+    }
+    if (!state.empty()) {
+        out.append("  (");
+        out.append(state);
+        out.push_back(')');
+    }
+    out.push_back('\n');
+}
+
+// Returns the id value
+int CompactFancyNameTag::getId() const { return id_; }
+
+// Returns a const reference to the company string
+const std::string& CompactFancyNameTag::getCompany() const { return company_.str(); }
+
+// Returns the interned company handle (compare these instead of strings)
+CompanyId CompactFancyNameTag::getCompanyId() const { return company_; }
+
+// Returns a const reference to the Bio in the slab (throws if moved from)
+const Bio& CompactFancyNameTag::getBio() const { return BioSlab::get(bio_); }
+
+// Sets the id, enforcing the invariant that it must be positive
+void CompactFancyNameTag::setId(int id) {
+    if (id <= 0) {
+        throw std::invalid_argument("FancyNameTag id must be positive");
+    }
+    id_ = id;
+}
+
+// Sets the company name, enforcing the invariant that it must not be empty
+void CompactFancyNameTag::setCompany(std::string_view company) {
+    if (company.empty()) {
+        throw std::invalid_argument("FancyNameTag company must not be empty");
+    }
+    company_ = CompanyTable::intern(company);
+}
+
+// Replaces the whole Bio: the new one gets a new slot (and generation), so
+// handles taken before the call no longer refer to this tag's Bio
+void CompactFancyNameTag::setBio(const Bio& bio) {
+    validateBio(bio);
+    BioSlab::destroy(std::exchange(bio_, BioSlab::create(bio)));
+}
+
+// Changes only the Bio's title, in place (the handle stays the same)
+void CompactFancyNameTag::setBioTitle(const std::string& title) {
+    if (title.empty()) {
+        throw std::invalid_argument("FancyNameTag bio title must not be empty");
+    }
+    if (!hasBio()) {
+        throw std::logic_error("FancyNameTag has no bio (it was moved from)");
+    }
+    BioSlab::get(bio_).title = title;
+}
+
+// A moved-from object has an empty handle
+bool CompactFancyNameTag::hasBio() const { return !bio_.empty(); }
+
+// Returns the slab handle
+BioHandle CompactFancyNameTag::getBioHandle() const { return bio_; }
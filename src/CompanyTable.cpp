@@ -0,0 +1,144 @@
+// Include the CompanyTable and CompanyId declarations
+#include "CompanyTable.h"
+
+// array for the fixed table of chunk pointers
+#include <array>
+// atomic so readers can find chunks without locking
+#include <atomic>
+// mutex for std::unique_lock
+#include <mutex>
+// shared_mutex so many threads can look names up at once
+#include <shared_mutex>
+// stdexcept for std::length_error
+#include <stdexcept>
+// unordered_map for the name -> id index
+#include <unordered_map>
+
+namespace {
+
+// Names are stored in fixed-size chunks that never move once allocated,
+// so a reference to a name (and a string_view of it) stays valid forever.
+constexpr std::size_t kChunkSize = 256;
+constexpr std::size_t kMaxChunks = 4096; // up to ~1M distinct companies
+
+struct Chunk {
+    std::string names[kChunkSize];
+};
+
+struct Table {
+    // chunks[i] is published with a release store, so a reader that loads it
+    // with acquire sees the fully constructed chunk — no lock needed
+    std::array<std::atomic<Chunk*>, kMaxChunks> chunks{};
+    std::uint32_t count = 0;
+
+    // Guards count, index and writes into the chunks
+    std::shared_mutex mutex;
+    // Keys are views of the interned strings themselves (no second copy)
+    std::unordered_map<std::string_view, std::uint32_t> index;
+
+    Table() {
+        // Id 0 is always the empty string, so CompanyId{} means ""
+        Chunk* first = new Chunk;
+        chunks[0].store(first, std::memory_order_release);
+        index.emplace(std::string_view(first->names[0]), 0);
+        count = 1;
+    }
+};
+
+// Intentionally never destroyed: tags destroyed during static destruction may
+// still read their company name
+Table& table() {
+    static Table* instance = new Table;
+    return *instance;
+}
+
+} // namespace
+
+// Looks the name up in the table
+const std::string& CompanyId::str() const {
+    return CompanyTable::name(*this);
+}
+
+// Returns the existing id, or adds the name under an exclusive lock
+CompanyId CompanyTable::intern(std::string_view company) {
+    Table& t = table();
+    {
+        // Fast path: the name is already there (the common case)
+        std::shared_lock<std::shared_mutex> lock(t.mutex);
+        auto found = t.index.find(company);
+        if (found != t.index.end()) {
+            return CompanyId(found->second);
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(t.mutex);
+    // Another thread may have added it between the two locks
+    auto found = t.index.find(company);
+    if (found != t.index.end()) {
+        return CompanyId(found->second);
+    }
+    const std::uint32_t id = t.count;
+    if (id >= kChunkSize * kMaxChunks) {
+        throw std::length_error("CompanyTable is full");
+    }
+    const std::size_t chunkIndex = id / kChunkSize;
+    Chunk* chunk = t.chunks[chunkIndex].load(std::memory_order_relaxed);
+    if (chunk == nullptr) {
+        chunk = new Chunk;
+        t.chunks[chunkIndex].store(chunk, std::memory_order_release);
+    }
+    std::string& slot = chunk->names[id % kChunkSize];
+    slot.assign(company);
+    t.index.emplace(std::string_view(slot), id);
+    ++t.count;
+    return CompanyId(id);
+}
+
+// Returns the id only if the name was interned before
+std::optional<CompanyId> CompanyTable::find(std::string_view company) {
+    Table& t = table();
+    std::shared_lock<std::shared_mutex> lock(t.mutex);
+    auto found = t.index.find(company);
+    if (found == t.index.end()) {
+        return std::nullopt;
+    }
+    return CompanyId(found->second);
+}
+
+// Lock-free: the id came from intern(), so its chunk is already published
+const std::string& CompanyTable::name(CompanyId id) {
+    const std::uint32_t value = id.value();
+    const Chunk* chunk = table().chunks[value / kChunkSize].load(std::memory_order_acquire);
+    return chunk->names[value % kChunkSize];
+}
+
+// Number of interned names
+std::size_t CompanyTable::size() {
+    Table& t = table();
+    std::shared_lock<std::shared_mutex> lock(t.mutex);
+    return t.count;
+}
+
+// Approximate bytes held by the table
+std::size_t CompanyTable::memoryUsage() {
+    Table& t = table();
+    std::shared_lock<std::shared_mutex> lock(t.mutex);
+    std::size_t bytes = sizeof(Table);
+    const std::size_t chunkCount = (t.count + kChunkSize - 1) / kChunkSize;
+    bytes += chunkCount * sizeof(Chunk);
+    for (std::uint32_t id = 0; id < t.count; ++id) {
+        const std::string& name = t.chunks[id / kChunkSize].load(std::memory_order_relaxed)->names[id % kChunkSize];
+        // Count the separate character buffer only when the name doesn't fit
+        // in the string object's own small buffer
+        const auto* object = reinterpret_cast<const char*>(&name);
+        const bool onHeap = name.data() < object || name.data() >= object + sizeof(std::string);
+        if (onHeap) {
+            bytes += name.capacity() + 1;
+        }
+    }
+    // Each index entry is a node holding the key, the value and a next pointer,
+    // plus one pointer per bucket
+    bytes += t.index.size() * (sizeof(std::string_view) + sizeof(std::uint32_t) + 2 * sizeof(void*));
+    bytes += t.index.bucket_count() * sizeof(void*);
+    return bytes;
+}
@@ -2,88 +2,154 @@
 #include "FancyNameTag.h"
 // Include the short address utility for readable output
 #include "AddrUtil.h"
+// Include the allocation-free formatting helpers used by appendTo
+#include "FormatUtil.h"
+// Include the hash-combining helpers for the cached hash
+#include "HashUtil.h"
+// Include the binary lifecycle event recorder
+#include "LifecycleRecorder.h"
+// Include the compile-time lifecycle tracing policy
+#include "Trace.h"
 // Include iomanip for std::setw and std::left (column alignment in print)
 #include <iomanip>
 
-// utility for std::exchange and std::move
+// utility for std::exchange, std::forward and std::move
 #include <utility>
 
-// Constructor: copies id and company by value, allocates a new Bio on the heap
-FancyNameTag::FancyNameTag(int id, const std::string& company, const Bio& bio)
+namespace {
+
+// Adds one Bio allocation to FancyNameTag's heapBytes counter
+void countBioAllocation(BioAlloc alloc) {
+    if constexpr (kCountersEnabled) {
+        InstanceCounter<FancyNameTag>::addHeapBytes(bioAllocationBytes(alloc));
+    }
+}
+
+} // namespace
+
+// Constructor: copies the id, interns the company, allocates a new Bio on the heap
+FancyNameTag::FancyNameTag(int id, std::string_view company, const Bio& bio, BioAlloc alloc)
     : id_(id),
-      company_(company),
-      bio_(new Bio(bio)) {
+      bio_(nullptr),
+      alloc_(alloc) {
+    construct(company, bio);
+}
+
+// Constructor for a Bio we may steal from: the same, but the new Bio is
+// move-constructed. std::move is needed again here — inside the function,
+// "bio" has a name, so it is an lvalue and would otherwise be copied.
+FancyNameTag::FancyNameTag(int id, std::string_view company, Bio&& bio, BioAlloc alloc)
+    : id_(id),
+      bio_(nullptr),
+      alloc_(alloc) {
+    construct(company, std::move(bio));
+}
 
+// Validates, then interns the company and allocates the Bio (copied or moved,
+// depending on BioArg)
+template <typename BioArg>
+void FancyNameTag::construct(std::string_view company, BioArg&& bio) {
     // Validate invariants: id must be positive
     if (id_ <= 0) {
         throw std::invalid_argument("FancyNameTag id must be positive");
     }
     // Validate invariants: company must not be empty
-    if (company_.empty()) {
+    if (company.empty()) {
         throw std::invalid_argument("FancyNameTag company must not be empty");
     }
     // Validate the Bio fields: name must not be empty
-    if (bio_->name.empty()) {
+    if (bio.name.empty()) {
         throw std::invalid_argument("FancyNameTag bio name must not be empty");
     }
     // Validate the Bio fields: title must not be empty
-    if (bio_->title.empty()) {
+    if (bio.title.empty()) {
         throw std::invalid_argument("FancyNameTag bio title must not be empty");
     }
     // Validate the Bio fields: year must be positive
-    if (bio_->year <= 0) {
+    if (bio.year <= 0) {
         throw std::invalid_argument("FancyNameTag bio year must be positive");
     }
 
-    // Log construction with the Bio contents and its heap address
+    // Intern the company and allocate the Bio only after validation passes.
+    // Interned names are never freed, and if the constructor throws, the
+    // destructor never runs — so either one done before a failed check would leak.
+    company_ = CompanyTable::intern(company);
+    bio_ = createBio(alloc_, std::forward<BioArg>(bio));
+    countBioAllocation(alloc_);
+    rehash();
+
+    logConstruction();
+}
+
+// Batch constructor: everything was validated and allocated by the caller
+// (makeFancyNameTags). Only the trace line can fail (formatting allocates);
+// it goes first, so a throw leaves the Bio with the caller, uncounted.
+FancyNameTag::FancyNameTag(BatchKey, int id, CompanyId company, Bio* bio, BioAlloc alloc)
+    : id_(id),
+      company_(company),
+      bio_(bio),
+      alloc_(alloc) {
+    logConstruction();
+    countBioAllocation(alloc_);
+    rehash();
+}
+
+// Log construction with the Bio contents and its heap address
+void FancyNameTag::logConstruction() const {
     // In C++, 'this' is a pointer to the current object.
     // It plays the same role as 'self' in Python, but explicitly as a pointer.
     // We use it here only to show the stack address of this object so you can
     // see that copies and moves create different objects in memory.
 
-    std::cout << "Constructor (STACK "
-              << shortAddr(this)
-              << "): id="
-              << id_
-              << ", company=\""
-              << company_
-              << "\", bio={"; bio_->print(); std::cout
-              << "} (HEAP " << shortAddr(bio_)
-              << ")\n";
+    // The log line goes through the tracing policy chosen at compile time
+    // (see Trace.h) — with NAMETAG_TRACE=NONE this block isn't compiled at all.
+
+    if constexpr (kTraceEnabled) {
+        TraceLine() << "Constructor (STACK "
+                    << shortAddr(this)
+                    << "): id="
+                    << id_
+                    << ", company=\""
+                    << company_.str()
+                    << "\", bio={" << *bio_
+                    << "} (HEAP " << shortAddr(bio_)
+                    << ")\n";
+    }
+    recordLifecycleWithBio(LifecycleKind::Construct, LifecycleTag::FancyNameTag, this, id_, bio_, company_.str());
 }
 
 // ============================================================================
-// TODO 1: Destructor
+// Destructor
 // ============================================================================
 // The destructor is called automatically when the object goes out of scope.
-// Since we allocated bio_ on the heap with 'new', we must free it with 'delete'.
-//
-// Steps:
-//   1. Print a message showing what's being destroyed (use the logging pattern below)
-//   2. Check if bio_ is not nullptr before printing its contents
-//   3. Delete bio_ (delete on nullptr is safe and does nothing)
-//
-// Logging pattern (copy this structure):
-//   std::cout << "Destructor (STACK " << shortAddr(this) << "): id=" << id_ << ", bio=";
-//   if (bio_) {
-//       std::cout << "{"; bio_->print(); std::cout << "} (HEAP " << shortAddr(bio_) << ")";
-//   } else {
-//       std::cout << "(moved)";
-//   }
-//   std::cout << "\n";
+// Since we allocated bio_ ourselves, we must free it — with the same strategy
+// that allocated it (delete for BioAlloc::Heap, back to the pool for BioAlloc::Pool).
+// destroyBio() on nullptr is safe and does nothing, just like delete.
 // ============================================================================
 FancyNameTag::~FancyNameTag() {
-    // TODO: Implement the destructor
-    // 1. Print the destructor message (use the logging pattern above)
-    // 2. Delete bio_ to free the heap memory
+    // Log the destruction, showing the Bio only if this object still owns one
+    if constexpr (kTraceEnabled) {
+        TraceLine line;
+        line << "Destructor (STACK " << shortAddr(this) << "): id=" << id_ << ", bio=";
+        if (bio_) {
+            line << "{" << *bio_ << "} (HEAP " << shortAddr(bio_) << ")";
+        } else {
+            line << "(moved)";
+        }
+        line << "\n";
+    }
+    recordLifecycleWithBio(LifecycleKind::Destroy, LifecycleTag::FancyNameTag, this, id_, bio_);
+
+    // Free the Bio the same way it was allocated
+    destroyBio(alloc_, bio_);
 }
 
 // ============================================================================
-// TODO 2: Copy Constructor
+// Copy Constructor
 // ============================================================================
 // The copy constructor creates a NEW object as a copy of an existing one.
 // Since we own a raw pointer (bio_), we must perform a DEEP COPY:
-//   - Allocate NEW heap memory for our own Bio
+//   - Allocate NEW memory for our own Bio
 //   - Copy the data from other's Bio into our new Bio
 //
 // If we just copied the pointer (shallow copy), both objects would point to
@@ -94,67 +160,132 @@ FancyNameTag::~FancyNameTag() {
 // Syntax reminder:
 //   - "other.bio_" is a pointer (Bio*)
 //   - "*other.bio_" dereferences it to get the actual Bio object
-//   - "new Bio(*other.bio_)" allocates a new Bio and copies the data into it
-//
-// Steps:
-//   1. Initialize id_ from other.id_ (int copy)
-//   2. Initialize company_ from other.company_ (string copy)
-//   3. Initialize bio_ with: new Bio(*other.bio_)  <-- DEEP COPY
-//   4. Print a message showing the copy (use the logging pattern below)
+//   - "copyBio(alloc, other.bio_)" allocates a new Bio and copies the data into it
+//   - a moved-from tag has no Bio to copy, so its copy has none either
 //
-// Logging pattern (put this in the constructor body):
-//   std::cout << "Copy Constructor (STACK " << shortAddr(this) << "): id=" << id_
-//             << ", copied bio from HEAP " << shortAddr(other.bio_)
-//             << " to HEAP " << shortAddr(bio_) << "\n";
+// The one exception is BioAlloc::Shared (copy-on-write): there copyBio() shares
+// the same immutable Bio and bumps its reference count. That's still safe,
+// because a tag never modifies a shared Bio — its mutators clone it first.
 // ============================================================================
 FancyNameTag::FancyNameTag(const FancyNameTag& other)
-    // TODO: Initialize id_ from other.id_
-    // TODO: Initialize company_ from other.company_
-    // TODO: Initialize bio_ with a deep copy: new Bio(*other.bio_)
-{
-    // TODO: Print the copy constructor message (use the logging pattern above)
+    : id_(other.id_),
+      company_(other.company_),
+      bio_(other.bio_ ? copyBio(other.alloc_, other.bio_) : nullptr),  // DEEP COPY (or share, for Shared)
+      alloc_(other.alloc_),
+      hash_(other.hash_),
+      counted_(other.counted_) {
+    // Shared only bumped a reference count; the others allocated a new Bio
+    if (bio_ != nullptr && bio_ != other.bio_) {
+        countBioAllocation(alloc_);
+    }
+    if constexpr (kTraceEnabled) {
+        TraceLine() << "Copy Constructor (STACK " << shortAddr(this) << "): id=" << id_
+                    << ", copied bio from HEAP " << shortAddr(other.bio_)
+                    << " to HEAP " << shortAddr(bio_) << "\n";
+    }
+    recordLifecycle(LifecycleKind::Copy, LifecycleTag::FancyNameTag, this, id_, bio_, &other, other.bio_);
 }
 
 // ============================================================================
-// TODO 3: Move Constructor
+// Move Constructor
 // ============================================================================
 // The move constructor TRANSFERS ownership of resources from a temporary object.
 // Instead of allocating new memory and copying, we "steal" the other's pointer.
 // This is much faster because no heap allocation is needed!
 //
 // After the move, "other" is left in a "valid but unspecified" state.
-// We set other.bio_ to nullptr so its destructor won't delete our Bio.
+// We set other.bio_ to nullptr so its destructor won't free our Bio.
 //
 // Key tools:
-//   - std::move(other.company_): transfers the string's internal buffer
+//   - company_ is an interned CompanyId (a 4-byte handle), so it is simply copied
 //   - std::exchange(other.bio_, nullptr): returns other.bio_ and sets it to nullptr
 //
-// The "noexcept" keyword is a promise that this function will never throw.
-// This is important because std::vector will REFUSE to use move unless it's noexcept.
-// (If a move threw mid-reallocation, the vector would be in an unrecoverable state.)
+// The strategy travels with the pointer: whoever ends up owning bio_ must free
+// it the same way it was allocated.
+// ============================================================================
+FancyNameTag::FancyNameTag(FancyNameTag&& other) noexcept
+    : id_(other.id_),
+      company_(other.company_),
+      bio_(std::exchange(other.bio_, nullptr)),  // steals the pointer
+      alloc_(other.alloc_),
+      hash_(other.hash_),
+      counted_(std::move(other.counted_)) {
+    other.rehash(); // other has no Bio now
+    if constexpr (kTraceEnabled) {
+        TraceLine() << "Move Constructor (STACK " << shortAddr(this) << "): id=" << id_
+                    << ", took ownership of bio at HEAP " << shortAddr(bio_) << "\n";
+    }
+    recordLifecycle(LifecycleKind::Move, LifecycleTag::FancyNameTag, this, id_, bio_, &other);
+}
+
+// ============================================================================
+// Copy Assignment
+// ============================================================================
+// Unlike the copy constructor, "this" already exists and already owns a Bio.
+// So assignment has two jobs: copy other's Bio, and free our old one.
 //
-// Steps:
-//   1. Initialize id_ from other.id_ (int copy - primitives have nothing to "steal")
-//   2. Initialize company_ with: std::move(other.company_)  <-- transfers the string
-//   3. Initialize bio_ with: std::exchange(other.bio_, nullptr)  <-- steals the pointer
-//   4. Print a message showing the move (use the logging pattern below)
+// The order matters:
+//   1. Copy other's Bio into a NEW allocation (this may throw)
+//   2. Only then free our old Bio and take the new pointer (can't throw)
+// If step 1 throws, we haven't touched anything yet, so the tag is unchanged.
+// Freeing first would leave bio_ dangling if the copy then failed.
 //
-// Logging pattern (put this in the constructor body):
-//   std::cout << "Move Constructor (STACK " << shortAddr(this) << "): id=" << id_
-//             << ", took ownership of bio at HEAP " << shortAddr(bio_) << "\n";
+// Self-assignment (tag = tag) is harmless with this order, but we still skip
+// it: there is nothing to do.
 // ============================================================================
-FancyNameTag::FancyNameTag(FancyNameTag&& other) noexcept
-    // TODO: Initialize id_ from other.id_
-    // TODO: Initialize company_ with std::move(other.company_)
-    // TODO: Initialize bio_ with std::exchange(other.bio_, nullptr)
-{
-    // TODO: Print the move constructor message (use the logging pattern above)
+FancyNameTag& FancyNameTag::operator=(const FancyNameTag& other) {
+    if (this == &other) {
+        return *this;
+    }
+    // A moved-from tag has no Bio to copy
+    Bio* replacement = other.bio_ ? copyBio(other.alloc_, other.bio_) : nullptr;
+    if (replacement != nullptr && replacement != other.bio_) {
+        countBioAllocation(other.alloc_);
+    }
+
+    destroyBio(alloc_, std::exchange(bio_, replacement));
+    id_ = other.id_;
+    company_ = other.company_;
+    alloc_ = other.alloc_;
+    hash_ = other.hash_;
+    counted_ = other.counted_;
+
+    if constexpr (kTraceEnabled) {
+        TraceLine() << "Copy Assignment (STACK " << shortAddr(this) << "): id=" << id_
+                    << ", copied bio from HEAP " << shortAddr(other.bio_)
+                    << " to HEAP " << shortAddr(bio_) << "\n";
+    }
+    recordLifecycle(LifecycleKind::CopyAssign, LifecycleTag::FancyNameTag, this, id_, bio_, &other, other.bio_);
+    return *this;
 }
 
-// Note: Copy and move assignment operators are deleted in the header.
-// This keeps the example focused on construction. In practice, you'd either:
-//   1. Implement them (full Rule of Five), or
-//   2. Use std::unique_ptr<Bio> which handles everything automatically
+// ============================================================================
+// Move Assignment
+// ============================================================================
+// Free our Bio, then steal other's pointer (leaving other.bio_ == nullptr),
+// exactly like the move constructor. destroyBio() and pointer copies can't
+// throw, so this is noexcept — std::sort, vector::erase and vector::insert
+// check for that and move tags instead of copying them.
+// ============================================================================
+FancyNameTag& FancyNameTag::operator=(FancyNameTag&& other) noexcept {
+    if (this == &other) {
+        return *this;
+    }
+    destroyBio(alloc_, std::exchange(bio_, std::exchange(other.bio_, nullptr)));
+    id_ = other.id_;
+    company_ = other.company_;
+    alloc_ = other.alloc_;
+    hash_ = other.hash_;
+    other.rehash(); // other has no Bio now
+    counted_ = std::move(other.counted_);
+
+    if constexpr (kTraceEnabled) {
+        TraceLine() << "Move Assignment (STACK " << shortAddr(this) << "): id=" << id_
+                    << ", took ownership of bio at HEAP " << shortAddr(bio_) << "\n";
+    }
+    recordLifecycle(LifecycleKind::MoveAssign, LifecycleTag::FancyNameTag, this, id_, bio_, &other);
+    return *this;
+}
 
 // Prints all FancyNameTag data with a descriptive label and optional state hint
 // Uses fixed-width columns so consecutive prints line up for easy comparison
@@ -185,7 +316,7 @@ void FancyNameTag::print(const std::string& label, const std::string& state) con
 
               << "company="
               << std::setw(30)
-              << ("\"" + company_ + "\"")
+              << ("\"" + company_.str() + "\"")
 
     // Column 5: bio contents and heap address
 
@@ -212,15 +343,50 @@ void FancyNameTag::print(const std::string& label, const std::string& state) con
     std::cout << "\n";
 }
 
+// Same columns as print(), appended to a caller-owned buffer
+void FancyNameTag::appendTo(std::string& out, std::string_view label, std::string_view state) const {
+    appendRight(out, label, 18);
+    out.append("  STACK ");
+    appendShortAddr(out, this);
+    out.append("  id=");
+    appendInt(out, id_, 6);
+    out.append("company=");
+    appendQuotedLeft(out, company_.str(), 30);
+    out.append("bio=");
+    if (bio_) {
+        out.push_back('{');
+        bio_->appendTo(out);
+        out.append("} HEAP ");
+        appendShortAddr(out, bio_);
+    } else {
+        out.append("(moved)");
+    }
+    if (!state.empty()) {
+        out.append("  (");
+        out.append(state);
+        out.push_back(')');
+    }
+    out.push_back('\n');
+}
+
 // Returns the id value
 int FancyNameTag::getId() const { return id_; }
 
 // Returns a const reference to the company string
-const std::string& FancyNameTag::getCompany() const { return company_; }
+const std::string& FancyNameTag::getCompany() const { return company_.str(); }
+
+// Returns the interned company handle (compare these instead of strings)
+CompanyId FancyNameTag::getCompanyId() const { return company_; }
 
 // Returns a const reference to the Bio object (dereferences the pointer)
 const Bio& FancyNameTag::getBio() const { return *bio_; }
 
+// Returns the strategy that allocated bio_
+BioAlloc FancyNameTag::getBioAlloc() const { return alloc_; }
+
+// Returns how many tags currently refer to bio_
+std::size_t FancyNameTag::getBioUseCount() const { return bioUseCount(alloc_, bio_); }
+
 // Sets the id, enforcing the invariant that it must be positive
 void FancyNameTag::setId(int id) {
     // Validate before modifying — this is the advantage of using a setter
@@ -229,14 +395,118 @@ void FancyNameTag::setId(int id) {
         throw std::invalid_argument("FancyNameTag id must be positive");
     }
     id_ = id;
+    rehash();
+}
+
+// Replaces the whole Bio with a copy of bio
+void FancyNameTag::setBio(const Bio& bio) {
+    replaceBio(bio);
+}
+
+// Replaces the whole Bio, moving bio's strings into the new one
+void FancyNameTag::setBio(Bio&& bio) {
+    replaceBio(std::move(bio));
+}
+
+// Replaces the whole Bio, enforcing the same invariants as the constructor
+template <typename BioArg>
+void FancyNameTag::replaceBio(BioArg&& bio) {
+    if (bio.name.empty()) {
+        throw std::invalid_argument("FancyNameTag bio name must not be empty");
+    }
+    if (bio.title.empty()) {
+        throw std::invalid_argument("FancyNameTag bio title must not be empty");
+    }
+    if (bio.year <= 0) {
+        throw std::invalid_argument("FancyNameTag bio year must be positive");
+    }
+    // Build the replacement first so a failed allocation leaves us unchanged.
+    // A moved-from tag (bio_ == nullptr) simply gets a Bio again.
+    Bio* replacement = createBio(alloc_, std::forward<BioArg>(bio));
+    countBioAllocation(alloc_);
+    destroyBio(alloc_, std::exchange(bio_, replacement));
+    rehash();
+}
+
+// Copies title into the Bio
+void FancyNameTag::setBioTitle(const std::string& title) {
+    replaceBioTitle(title);
+}
+
+// Moves title into the Bio
+void FancyNameTag::setBioTitle(std::string&& title) {
+    replaceBioTitle(std::move(title));
+}
+
+// Changes only the Bio's title (copy-on-write: a shared Bio is cloned first)
+template <typename TitleArg>
+void FancyNameTag::replaceBioTitle(TitleArg&& title) {
+    if (title.empty()) {
+        throw std::invalid_argument("FancyNameTag bio title must not be empty");
+    }
+    if (!bio_) {
+        throw std::logic_error("FancyNameTag has no bio (it was moved from)");
+    }
+    // Clone only if another tag still refers to this Bio
+    Bio* unique = makeBioUnique(alloc_, bio_);
+    if (unique != bio_) {
+        countBioAllocation(alloc_);
+    }
+    bio_ = unique;
+    bio_->title = std::forward<TitleArg>(title);
+    rehash();
 }
 
 // Sets the company name, enforcing the invariant that it must not be empty
-void FancyNameTag::setCompany(const std::string& company) {
+void FancyNameTag::setCompany(std::string_view company) {
     // Validate before modifying — this is the advantage of using a setter
     // instead of making company_ public
     if (company.empty()) {
         throw std::invalid_argument("FancyNameTag company must not be empty");
     }
-    company_ = company;
+    company_ = CompanyTable::intern(company);
+    rehash();
+}
+
+// ==================== Equality, ordering and hashing ====================
+
+// A moved-from tag hashes only its id and company. The company is hashed by
+// its CompanyId: equal names are always interned to the same id.
+void FancyNameTag::rehash() noexcept {
+    std::uint64_t seed = hashCombine(0, static_cast<std::uint64_t>(id_));
+    seed = hashCombine(seed, company_.value());
+    if (bio_) {
+        seed = hashCombine(seed, std::hash<Bio>{}(*bio_));
+    }
+    hash_ = foldHash(seed);
+}
+
+// Cheapest checks first (hash, id, company are integers). Tags that share
+// one Bio (BioAlloc::Shared) are equal without reading it.
+bool FancyNameTag::operator==(const FancyNameTag& other) const {
+    if (hash_ != other.hash_ || id_ != other.id_ || company_ != other.company_) {
+        return false;
+    }
+    if (bio_ == other.bio_) {
+        return true;
+    }
+    return bio_ && other.bio_ && *bio_ == *other.bio_;
 }
+
+// Each "<=>" returns less, equal or greater; the first one that isn't
+// equal decides
+std::strong_ordering FancyNameTag::operator<=>(const FancyNameTag& other) const {
+    if (const auto order = id_ <=> other.id_; order != 0) {
+        return order;
+    }
+    if (company_ != other.company_) {
+        return company_.str() <=> other.company_.str();
+    }
+    if (!bio_ || !other.bio_) {
+        return (bio_ != nullptr) <=> (other.bio_ != nullptr); // no Bio first
+    }
+    return *bio_ <=> *other.bio_;
+}
+
+// Returns the hash cached by the last constructor, assignment or setter
+std::uint32_t FancyNameTag::hash() const { return hash_; }
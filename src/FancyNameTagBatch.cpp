@@ -0,0 +1,175 @@
+// Include the batch construction declarations
+#include "FancyNameTagBatch.h"
+// Include CompanyTable to intern each row's company
+#include "CompanyTable.h"
+
+// stdexcept for std::invalid_argument and std::length_error
+#include <stdexcept>
+// utility for std::move
+#include <utility>
+
+// The one class FancyNameTag::BatchKey trusts (it is a friend there), so
+// the unchecked batch constructor can only be reached from this file
+class FancyNameTagBatchBuilder {
+public:
+    // BioRef is const Bio (copy each Bio) or Bio (move each Bio)
+    template <typename BioRef>
+    static FancyNameTagBatch build(std::span<const int> ids,
+                                   std::span<const std::string> companies,
+                                   std::span<BioRef> bios,
+                                   BioAlloc alloc);
+};
+
+namespace {
+
+constexpr auto bit(BatchProblem problem) {
+    return static_cast<std::uint8_t>(problem);
+}
+
+// Pass 1: checks every invariant for every row, one column at a time.
+//
+// Each loop body is a compare turned into a bit and OR'ed into the row's
+// mask — no "if", so there is nothing for the branch predictor to miss when
+// bad rows are scattered through the input, and the id loop (plain ints in a
+// row) is turned into SIMD compares by the optimizer.
+std::vector<std::uint8_t> validateColumns(std::span<const int> ids,
+                                          std::span<const std::string> companies,
+                                          std::span<const Bio> bios) {
+    const std::size_t rows = ids.size();
+    std::vector<std::uint8_t> problems(rows, 0);
+    for (std::size_t i = 0; i < rows; ++i) {
+        problems[i] |= static_cast<std::uint8_t>(ids[i] <= 0) * bit(BatchProblem::BadId);
+    }
+    for (std::size_t i = 0; i < rows; ++i) {
+        problems[i] |= static_cast<std::uint8_t>(companies[i].empty()) * bit(BatchProblem::EmptyCompany);
+    }
+    for (std::size_t i = 0; i < rows; ++i) {
+        const Bio& bio = bios[i];
+        problems[i] |= static_cast<std::uint8_t>(bio.name.empty()) * bit(BatchProblem::EmptyBioName)
+                     | static_cast<std::uint8_t>(bio.title.empty()) * bit(BatchProblem::EmptyBioTitle)
+                     | static_cast<std::uint8_t>(bio.year <= 0) * bit(BatchProblem::BadBioYear);
+    }
+    return problems;
+}
+
+// Interns companies, remembering the last one: columnar input is usually
+// grouped by company, so most rows skip the CompanyTable lookup entirely
+class CompanyCache {
+public:
+    CompanyId intern(const std::string& company) {
+        if (!last_ || *last_ != company) {
+            id_ = CompanyTable::intern(company);
+            last_ = &company;
+        }
+        return id_;
+    }
+
+private:
+    const std::string* last_ = nullptr;
+    CompanyId id_;
+};
+
+} // namespace
+
+// Pass 2 and 3: reserve everything once, then build the valid rows in order
+template <typename BioRef>
+FancyNameTagBatch FancyNameTagBatchBuilder::build(std::span<const int> ids,
+                                                  std::span<const std::string> companies,
+                                                  std::span<BioRef> bios,
+                                                  BioAlloc alloc) {
+    if (companies.size() != ids.size() || bios.size() != ids.size()) {
+        throw std::invalid_argument("makeFancyNameTags columns must all have the same length");
+    }
+    const std::vector<std::uint8_t> problems = validateColumns(ids, companies, bios);
+
+    FancyNameTagBatch batch;
+    std::size_t valid = 0;
+    for (const std::uint8_t mask : problems) {
+        valid += mask == 0;
+    }
+    batch.tags.reserve(valid);
+    batch.rows.reserve(valid);
+    batch.errors.reserve(ids.size() - valid);
+
+    // Pool and Shared Bios come from the pool: make sure this thread's free
+    // list already holds a slot for every valid row (one chunk allocation)
+    if (alloc != BioAlloc::Heap) {
+        BioPool::reserve(valid, bioAllocationBytes(alloc));
+    }
+
+    CompanyCache companyCache;
+    for (std::size_t row = 0; row < ids.size(); ++row) {
+        if (problems[row] != 0) {
+            batch.errors.push_back(BatchRowError{row, problems[row]});
+            continue;
+        }
+        // Intern first: it can throw (a full CompanyTable), and a Bio created
+        // before it would then have no owner. After createBio() only the tag
+        // constructor's trace line can throw (both vectors were reserved).
+        CompanyId company;
+        try {
+            company = companyCache.intern(companies[row]);
+        } catch (const std::length_error&) {
+            // Only this row is lost; rows with companies already in the table still build
+            batch.errors.push_back(BatchRowError{row, bit(BatchProblem::CompanyTableFull)});
+            continue;
+        }
+        // createBio(alloc, Bio&&) moves when BioRef is Bio, copies when it is const Bio
+        Bio* bio = createBio(alloc, std::move(bios[row]));
+        try {
+            batch.tags.emplace_back(FancyNameTag::BatchKey{}, ids[row], company, bio, alloc);
+        } catch (...) {
+            // The tag was never built, so the Bio is still ours to free
+            destroyBio(alloc, bio);
+            throw;
+        }
+        batch.rows.push_back(row);
+    }
+    return batch;
+}
+
+// Builds the valid rows, copying their Bios
+FancyNameTagBatch makeFancyNameTags(std::span<const int> ids,
+                                    std::span<const std::string> companies,
+                                    std::span<const Bio> bios,
+                                    BioAlloc alloc) {
+    return FancyNameTagBatchBuilder::build(ids, companies, bios, alloc);
+}
+
+// Builds the valid rows, moving their Bios
+FancyNameTagBatch makeFancyNameTags(std::span<const int> ids,
+                                    std::span<const std::string> companies,
+                                    std::vector<Bio>&& bios,
+                                    BioAlloc alloc) {
+    return FancyNameTagBatchBuilder::build(ids, companies, std::span<Bio>(bios), alloc);
+}
+
+// Lists a rejected row's problems with the same wording as the constructor's exceptions
+std::string BatchRowError::problemText() const {
+    static constexpr struct {
+        BatchProblem problem;
+        const char* text;
+    } kMessages[] = {
+        {BatchProblem::BadId, "id must be positive"},
+        {BatchProblem::EmptyCompany, "company must not be empty"},
+        {BatchProblem::EmptyBioName, "bio name must not be empty"},
+        {BatchProblem::EmptyBioTitle, "bio title must not be empty"},
+        {BatchProblem::BadBioYear, "bio year must be positive"},
+        {BatchProblem::CompanyTableFull, "company table is full (too many distinct companies)"},
+    };
+    std::string text;
+    for (const auto& message : kMessages) {
+        if (has(message.problem)) {
+            if (!text.empty()) {
+                text += "; ";
+            }
+            text += message.text;
+        }
+    }
+    return text;
+}
+
+// problemText() with the row number in front
+std::string BatchRowError::describe() const {
+    return "row " + std::to_string(row) + ": " + problemText();
+}
@@ -0,0 +1,288 @@
+// Include the FancyNameTagQueue class declaration
+#include "FancyNameTagQueue.h"
+
+// algorithm for std::min
+#include <algorithm>
+// new for placement new
+#include <new>
+// thread for std::this_thread::yield
+#include <thread>
+// type_traits for the noexcept checks below
+#include <type_traits>
+// utility for std::move
+#include <utility>
+
+// The whole point of the queue: a tag crosses threads by the noexcept move
+// constructor and nothing else, so no push or pop can throw halfway through
+static_assert(std::is_nothrow_move_constructible_v<FancyNameTag>,
+              "FancyNameTagQueue relies on FancyNameTag's move constructor being noexcept");
+static_assert(std::is_nothrow_destructible_v<FancyNameTag>);
+
+namespace {
+
+// Busy-wait for a few rounds, then start giving the core away
+constexpr unsigned kSpinsBeforeYield = 64;
+// QueueWait::Block spins and yields this many rounds before it sleeps: the
+// other side is usually only a moment away, and sleeping on every empty/full
+// queue turns each handoff into a futex wake-up and a context switch
+constexpr unsigned kSpinsBeforeSleep = 128;
+
+void relax(unsigned& spins) {
+    if (++spins > kSpinsBeforeYield) {
+        std::this_thread::yield();
+    }
+}
+
+// Rounds up to a power of two so a position maps to a cell with a mask
+std::size_t roundUpToPowerOfTwo(std::size_t value) {
+    std::size_t power = 2;
+    while (power < value) {
+        power *= 2;
+    }
+    return power;
+}
+
+} // namespace
+
+// Cell i starts out free for position i
+FancyNameTagQueue::FancyNameTagQueue(std::size_t capacity, QueueWait wait)
+    : cells_(std::make_unique<Cell[]>(roundUpToPowerOfTwo(capacity))),
+      mask_(roundUpToPowerOfTwo(capacity) - 1),
+      wait_(wait) {
+    for (std::size_t i = 0; i <= mask_; ++i) {
+        cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+// Every position between the two ends holds a tag
+FancyNameTagQueue::~FancyNameTagQueue() {
+    const std::size_t end = enqueuePos_.load(std::memory_order_relaxed);
+    for (std::size_t pos = dequeuePos_.load(std::memory_order_relaxed); pos != end; ++pos) {
+        cell(pos).tag()->~FancyNameTag();
+    }
+}
+
+std::size_t FancyNameTagQueue::sizeApprox() const {
+    const std::size_t tail = dequeuePos_.load(std::memory_order_acquire);
+    const std::size_t head = enqueuePos_.load(std::memory_order_acquire);
+    return head > tail ? head - tail : 0;
+}
+
+// ==================== Non-blocking ====================
+
+bool FancyNameTagQueue::tryPush(FancyNameTag&& tag) noexcept {
+    if (closed()) {
+        return false;
+    }
+    std::size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+    Cell* target;
+    while (true) {
+        target = &cell(pos);
+        const std::size_t sequence = target->sequence.load(std::memory_order_acquire);
+        const auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+        if (diff == 0) {
+            // Our turn: claim the position (on failure pos is reloaded)
+            if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false; // the consumer from one lap ago hasn't emptied it: full
+        } else {
+            pos = enqueuePos_.load(std::memory_order_relaxed); // someone else claimed it
+        }
+    }
+    new (target->storage) FancyNameTag(std::move(tag));
+    target->sequence.store(pos + 1, std::memory_order_release);
+    notifyPushed();
+    return true;
+}
+
+std::optional<FancyNameTag> FancyNameTagQueue::tryPop() noexcept {
+    std::optional<FancyNameTag> result;
+    std::size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+    Cell* source;
+    while (true) {
+        source = &cell(pos);
+        const std::size_t sequence = source->sequence.load(std::memory_order_acquire);
+        const auto diff = static_cast<std::ptrdiff_t>(sequence - (pos + 1));
+        if (diff == 0) {
+            if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return result; // nothing published at this position yet: empty
+        } else {
+            pos = dequeuePos_.load(std::memory_order_relaxed);
+        }
+    }
+    result.emplace(std::move(*source->tag()));
+    source->tag()->~FancyNameTag();
+    // Free for the producer one lap later
+    source->sequence.store(pos + mask_ + 1, std::memory_order_release);
+    notifyPopped();
+    return result;
+}
+
+// Claims k positions at once. Room for k means the consumers have already
+// claimed (not necessarily finished) every cell we need, so the short wait
+// below is only for a consumer that is in the middle of moving a tag out.
+std::size_t FancyNameTagQueue::tryPushBatch(std::span<FancyNameTag> tags) noexcept {
+    if (tags.empty() || closed()) {
+        return 0;
+    }
+    std::size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+    std::size_t count;
+    while (true) {
+        const std::size_t used = pos - dequeuePos_.load(std::memory_order_acquire);
+        if (used > capacity()) {
+            pos = enqueuePos_.load(std::memory_order_relaxed); // pos was stale
+            continue;
+        }
+        count = std::min(tags.size(), capacity() - used);
+        if (count == 0) {
+            return 0;
+        }
+        if (enqueuePos_.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed)) {
+            break;
+        }
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        Cell& target = cell(pos + i);
+        unsigned spins = 0;
+        while (target.sequence.load(std::memory_order_acquire) != pos + i) {
+            relax(spins);
+        }
+        new (target.storage) FancyNameTag(std::move(tags[i]));
+        target.sequence.store(pos + i + 1, std::memory_order_release);
+    }
+    notifyPushed();
+    return count;
+}
+
+// The mirror image: every position below the enqueue position has been
+// claimed by a producer, which may still be moving its tag in
+std::size_t FancyNameTagQueue::tryPopBatch(std::vector<FancyNameTag>& out, std::size_t max) {
+    max = std::min(max, capacity());
+    if (max == 0) {
+        return 0;
+    }
+    out.reserve(out.size() + max); // the only thing that can throw, so do it first
+
+    std::size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+    std::size_t count;
+    while (true) {
+        const std::size_t available = enqueuePos_.load(std::memory_order_acquire) - pos;
+        count = std::min(max, available);
+        if (count == 0) {
+            return 0;
+        }
+        if (dequeuePos_.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed)) {
+            break;
+        }
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        Cell& source = cell(pos + i);
+        unsigned spins = 0;
+        while (source.sequence.load(std::memory_order_acquire) != pos + i + 1) {
+            relax(spins);
+        }
+        out.emplace_back(std::move(*source.tag())); // fits: reserved above
+        source.tag()->~FancyNameTag();
+        source.sequence.store(pos + i + mask_ + 1, std::memory_order_release);
+    }
+    notifyPopped();
+    return count;
+}
+
+// ==================== Blocking ====================
+//
+// Each loop reads the other side's wake-up counter BEFORE trying. If the try
+// fails and the counter still has that value, no push/pop has finished since,
+// so it is safe to sleep until it changes (no wake-up can be missed).
+
+bool FancyNameTagQueue::push(FancyNameTag&& tag) {
+    unsigned spins = 0;
+    while (true) {
+        const std::uint32_t seen = popped_.load(std::memory_order_acquire);
+        if (tryPush(std::move(tag))) {
+            return true;
+        }
+        if (closed()) {
+            return false;
+        }
+        waitFor(popped_, seen, spins);
+    }
+}
+
+std::size_t FancyNameTagQueue::pushBatch(std::span<FancyNameTag> tags) {
+    std::size_t pushed = 0;
+    unsigned spins = 0;
+    while (pushed < tags.size()) {
+        const std::uint32_t seen = popped_.load(std::memory_order_acquire);
+        const std::size_t count = tryPushBatch(tags.subspan(pushed));
+        pushed += count;
+        if (closed()) {
+            break;
+        }
+        if (count == 0) {
+            waitFor(popped_, seen, spins);
+        }
+    }
+    return pushed;
+}
+
+std::optional<FancyNameTag> FancyNameTagQueue::pop() {
+    unsigned spins = 0;
+    while (true) {
+        const std::uint32_t seen = pushed_.load(std::memory_order_acquire);
+        std::optional<FancyNameTag> tag = tryPop();
+        if (tag || (closed() && sizeApprox() == 0)) {
+            return tag;
+        }
+        waitFor(pushed_, seen, spins);
+    }
+}
+
+std::size_t FancyNameTagQueue::popBatch(std::vector<FancyNameTag>& out, std::size_t max) {
+    unsigned spins = 0;
+    while (true) {
+        const std::uint32_t seen = pushed_.load(std::memory_order_acquire);
+        const std::size_t count = tryPopBatch(out, max);
+        if (count > 0 || max == 0 || (closed() && sizeApprox() == 0)) {
+            return count;
+        }
+        waitFor(pushed_, seen, spins);
+    }
+}
+
+void FancyNameTagQueue::close() {
+    closed_.store(true, std::memory_order_release);
+    // Wake everyone regardless of mode, so they notice the flag
+    pushed_.fetch_add(1, std::memory_order_release);
+    popped_.fetch_add(1, std::memory_order_release);
+    pushed_.notify_all();
+    popped_.notify_all();
+}
+
+void FancyNameTagQueue::notifyPushed() noexcept {
+    if (wait_ == QueueWait::Block) {
+        pushed_.fetch_add(1, std::memory_order_release);
+        pushed_.notify_all();
+    }
+}
+
+void FancyNameTagQueue::notifyPopped() noexcept {
+    if (wait_ == QueueWait::Block) {
+        popped_.fetch_add(1, std::memory_order_release);
+        popped_.notify_all();
+    }
+}
+
+void FancyNameTagQueue::waitFor(const std::atomic<std::uint32_t>& counter, std::uint32_t seen,
+                                unsigned& spins) const {
+    if (wait_ == QueueWait::Block && spins >= kSpinsBeforeSleep) {
+        counter.wait(seen, std::memory_order_acquire);
+    } else {
+        relax(spins);
+    }
+}
@@ -0,0 +1,550 @@
+// Include the streaming reader declarations
+#include "FancyNameTagReader.h"
+// Include the batch factory that validates and builds each chunk's tags
+#include "FancyNameTagBatch.h"
+
+// algorithm for std::stable_sort (merging the two kinds of errors)
+#include <algorithm>
+// charconv for std::from_chars (locale-free integer parsing)
+#include <charconv>
+// cstdint for the line end offsets
+#include <cstdint>
+// limits for the largest offset a line end can hold
+#include <limits>
+// memory for std::shared_ptr (std::function needs a copyable task)
+#include <memory>
+// optional for "no error" results
+#include <optional>
+// stdexcept for std::length_error
+#include <stdexcept>
+// streambuf to read lines with a length limit
+#include <streambuf>
+// string_view for parsing without copying
+#include <string_view>
+// utility for std::move
+#include <utility>
+
+namespace {
+
+// The raw text of one chunk: its lines back to back, plus where each ends
+struct RawChunk {
+    std::string text;
+    std::vector<std::uint32_t> ends; // line i is text[ends[i - 1], ends[i])
+    std::size_t firstLine = 1;       // 1-based number of the first line
+    std::vector<std::size_t> tooLong; // indices of lines longer than maxLineBytes
+                                      // (stored empty), in increasing order
+    std::size_t maxLineBytes = 0;
+};
+
+// What readLine() found
+enum class LineRead {
+    Line,    // a whole line
+    TooLong, // a line longer than the limit; only its first maxBytes are in line
+    End      // no more input
+};
+
+// Like std::getline, but stops storing after maxBytes so a line with no end
+// in sight (a binary file, a missing newline) can't take all the memory.
+// The rest of an over-long line is still read, to find where the next begins.
+LineRead readLine(std::istream& in, std::string& line, std::size_t maxBytes) {
+    using Traits = std::streambuf::traits_type;
+    line.clear();
+    std::streambuf* buffer = in.rdbuf();
+    if (buffer == nullptr || !in.good()) {
+        return LineRead::End;
+    }
+    bool any = false;
+    bool tooLong = false;
+    while (true) {
+        const Traits::int_type c = buffer->sbumpc();
+        if (Traits::eq_int_type(c, Traits::eof())) {
+            in.setstate(std::ios::eofbit);
+            break;
+        }
+        any = true;
+        if (Traits::to_char_type(c) == '\n') {
+            break;
+        }
+        if (line.size() < maxBytes) {
+            line.push_back(Traits::to_char_type(c));
+        } else {
+            tooLong = true;
+        }
+    }
+    if (!any) {
+        return LineRead::End;
+    }
+    return tooLong ? LineRead::TooLong : LineRead::Line;
+}
+
+// One parsed (but not yet validated) row
+struct ParsedRow {
+    int id = 0;
+    std::string company;
+    Bio bio{};
+};
+
+// Parses a whole field as an int. Returns false for anything else
+// (empty, trailing junk, out of range).
+bool parseInt(std::string_view text, int& value) {
+    const char* end = text.data() + text.size();
+    const auto [stop, error] = std::from_chars(text.data(), end, value);
+    return error == std::errc() && stop == end && !text.empty();
+}
+
+// ==================== CSV ====================
+
+// Splits one CSV line into fields. A field may be wrapped in double quotes,
+// which allows commas inside it; a quote inside a quoted field is doubled ("").
+std::optional<std::string> splitCsv(std::string_view line, std::vector<std::string>& fields) {
+    fields.clear();
+    std::size_t pos = 0;
+    while (true) {
+        std::string& field = fields.emplace_back();
+        if (pos < line.size() && line[pos] == '"') {
+            ++pos;
+            while (true) {
+                if (pos >= line.size()) {
+                    return "unterminated quoted field";
+                }
+                if (line[pos] == '"') {
+                    if (pos + 1 < line.size() && line[pos + 1] == '"') {
+                        field.push_back('"');
+                        pos += 2;
+                        continue;
+                    }
+                    ++pos;
+                    break;
+                }
+                field.push_back(line[pos++]);
+            }
+            if (pos < line.size() && line[pos] != ',') {
+                return "unexpected text after a quoted field";
+            }
+        } else {
+            const std::size_t comma = std::min(line.find(',', pos), line.size());
+            field.assign(line.substr(pos, comma - pos));
+            pos = comma;
+        }
+        if (pos >= line.size()) {
+            return std::nullopt;
+        }
+        ++pos; // skip the comma
+    }
+}
+
+std::optional<std::string> parseCsvRow(std::string_view line, std::vector<std::string>& fields, ParsedRow& row) {
+    if (auto error = splitCsv(line, fields)) {
+        return error;
+    }
+    if (fields.size() != 6) {
+        return "expected 6 fields, got " + std::to_string(fields.size());
+    }
+    if (!parseInt(fields[0], row.id)) {
+        return "id is not a whole number: \"" + fields[0] + "\"";
+    }
+    if (!parseInt(fields[5], row.bio.year)) {
+        return "year is not a whole number: \"" + fields[5] + "\"";
+    }
+    row.company = std::move(fields[1]);
+    row.bio.name = std::move(fields[2]);
+    row.bio.title = std::move(fields[3]);
+    row.bio.department = std::move(fields[4]);
+    return std::nullopt;
+}
+
+// ==================== JSON Lines ====================
+
+// A small parser for ONE flat JSON object: string and integer values are
+// read, true/false/null are skipped, nested objects and arrays are rejected.
+class JsonLineParser {
+public:
+    explicit JsonLineParser(std::string_view text) : text_(text) {}
+
+    std::optional<std::string> parse(ParsedRow& row) {
+        bool haveId = false, haveCompany = false, haveName = false;
+        bool haveTitle = false, haveDepartment = false, haveYear = false;
+        std::string key;
+
+        skipSpace();
+        if (!consume('{')) {
+            return "expected '{'";
+        }
+        skipSpace();
+        if (!consume('}')) {
+            while (true) {
+                skipSpace();
+                if (auto error = parseString(key)) {
+                    return error;
+                }
+                skipSpace();
+                if (!consume(':')) {
+                    return "expected ':' after \"" + key + "\"";
+                }
+                skipSpace();
+                std::optional<std::string> error;
+                if (key == "id") {
+                    error = parseInt(row.id, key);
+                    haveId = true;
+                } else if (key == "year") {
+                    error = parseInt(row.bio.year, key);
+                    haveYear = true;
+                } else if (key == "company") {
+                    error = parseString(row.company);
+                    haveCompany = true;
+                } else if (key == "name") {
+                    error = parseString(row.bio.name);
+                    haveName = true;
+                } else if (key == "title") {
+                    error = parseString(row.bio.title);
+                    haveTitle = true;
+                } else if (key == "department") {
+                    error = parseString(row.bio.department);
+                    haveDepartment = true;
+                } else {
+                    error = skipValue(key);
+                }
+                if (error) {
+                    return error;
+                }
+                skipSpace();
+                if (consume('}')) {
+                    break;
+                }
+                if (!consume(',')) {
+                    return "expected ',' or '}'";
+                }
+            }
+        }
+        skipSpace();
+        if (pos_ != text_.size()) {
+            return "unexpected text after the object";
+        }
+        const std::pair<bool, const char*> required[] = {
+            {haveId, "id"}, {haveCompany, "company"}, {haveName, "name"},
+            {haveTitle, "title"}, {haveDepartment, "department"}, {haveYear, "year"},
+        };
+        for (const auto& [present, name] : required) {
+            if (!present) {
+                return std::string("missing \"") + name + "\"";
+            }
+        }
+        return std::nullopt;
+    }
+
+private:
+    void skipSpace() {
+        while (pos_ < text_.size() && (text_[pos_] == ' ' || text_[pos_] == '\t' || text_[pos_] == '\r')) {
+            ++pos_;
+        }
+    }
+
+    bool consume(char expected) {
+        if (pos_ < text_.size() && text_[pos_] == expected) {
+            ++pos_;
+            return true;
+        }
+        return false;
+    }
+
+    // Reads a JSON string, decoding escapes (\uXXXX becomes UTF-8)
+    std::optional<std::string> parseString(std::string& out) {
+        out.clear();
+        if (!consume('"')) {
+            return "expected a string";
+        }
+        while (pos_ < text_.size()) {
+            const char c = text_[pos_++];
+            if (c == '"') {
+                return std::nullopt;
+            }
+            if (c != '\\') {
+                out.push_back(c);
+                continue;
+            }
+            if (pos_ >= text_.size()) {
+                break;
+            }
+            const char escape = text_[pos_++];
+            switch (escape) {
+                case '"': out.push_back('"'); break;
+                case '\\': out.push_back('\\'); break;
+                case '/': out.push_back('/'); break;
+                case 'b': out.push_back('\b'); break;
+                case 'f': out.push_back('\f'); break;
+                case 'n': out.push_back('\n'); break;
+                case 'r': out.push_back('\r'); break;
+                case 't': out.push_back('\t'); break;
+                case 'u': {
+                    std::uint32_t code = 0;
+                    if (!parseHex4(code)) {
+                        return "bad \\u escape";
+                    }
+                    // A UTF-16 surrogate pair encodes one code point above U+FFFF
+                    if (code >= 0xD800 && code <= 0xDBFF) {
+                        std::uint32_t low = 0;
+                        if (!consume('\\') || !consume('u') || !parseHex4(low) || low < 0xDC00 || low > 0xDFFF) {
+                            return "bad \\u surrogate pair";
+                        }
+                        code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                    }
+                    appendUtf8(out, code);
+                    break;
+                }
+                default:
+                    return std::string("bad escape \\") + escape;
+            }
+        }
+        return "unterminated string";
+    }
+
+    bool parseHex4(std::uint32_t& value) {
+        if (text_.size() - pos_ < 4) {
+            return false;
+        }
+        const char* begin = text_.data() + pos_;
+        const auto [stop, error] = std::from_chars(begin, begin + 4, value, 16);
+        pos_ += 4;
+        return error == std::errc() && stop == begin + 4;
+    }
+
+    static void appendUtf8(std::string& out, std::uint32_t code) {
+        if (code < 0x80) {
+            out.push_back(static_cast<char>(code));
+        } else if (code < 0x800) {
+            out.push_back(static_cast<char>(0xC0 | (code >> 6)));
+            out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+        } else if (code < 0x10000) {
+            out.push_back(static_cast<char>(0xE0 | (code >> 12)));
+            out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+        } else {
+            out.push_back(static_cast<char>(0xF0 | (code >> 18)));
+            out.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+            out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+        }
+    }
+
+    // The characters a JSON number can contain
+    std::string_view numberText() {
+        const std::size_t start = pos_;
+        while (pos_ < text_.size() && std::string_view("-+.eE0123456789").find(text_[pos_]) != std::string_view::npos) {
+            ++pos_;
+        }
+        return text_.substr(start, pos_ - start);
+    }
+
+    std::optional<std::string> parseInt(int& value, const std::string& key) {
+        const std::string_view number = numberText();
+        if (!::parseInt(number, value)) {
+            return key + " is not a whole number: \"" + std::string(number) + "\"";
+        }
+        return std::nullopt;
+    }
+
+    // Skips the value of a key we don't use
+    std::optional<std::string> skipValue(const std::string& key) {
+        if (pos_ >= text_.size()) {
+            return "missing value for \"" + key + "\"";
+        }
+        const char c = text_[pos_];
+        if (c == '"') {
+            std::string ignored;
+            return parseString(ignored);
+        }
+        if (c == '{' || c == '[') {
+            return "nested value for \"" + key + "\" is not supported";
+        }
+        for (const std::string_view literal : {"true", "false", "null"}) {
+            if (text_.substr(pos_, literal.size()) == literal) {
+                pos_ += literal.size();
+                return std::nullopt;
+            }
+        }
+        if (numberText().empty()) {
+            return "bad value for \"" + key + "\"";
+        }
+        return std::nullopt;
+    }
+
+    std::string_view text_;
+    std::size_t pos_ = 0;
+};
+
+// ==================== One chunk ====================
+
+// Parses every line of a chunk, then validates and builds the parsed rows
+// in one makeFancyNameTags() call (which reports rule violations per row)
+FancyNameTagChunk processChunk(const RawChunk& raw, IngestFormat format, BioAlloc alloc) {
+    FancyNameTagChunk chunk;
+    std::vector<int> ids;
+    std::vector<std::string> companies;
+    std::vector<Bio> bios;
+    std::vector<std::size_t> rowLines;
+    std::vector<std::string> fields;
+    ids.reserve(raw.ends.size());
+    companies.reserve(raw.ends.size());
+    bios.reserve(raw.ends.size());
+    rowLines.reserve(raw.ends.size());
+
+    std::uint32_t begin = 0;
+    std::size_t nextTooLong = 0;
+    for (std::size_t i = 0; i < raw.ends.size(); ++i) {
+        std::string_view line(raw.text.data() + begin, raw.ends[i] - begin);
+        begin = raw.ends[i];
+        const std::size_t lineNumber = raw.firstLine + i;
+        if (nextTooLong < raw.tooLong.size() && raw.tooLong[nextTooLong] == i) {
+            ++nextTooLong;
+            chunk.errors.push_back(IngestError{
+                lineNumber, "line is longer than " + std::to_string(raw.maxLineBytes) + " bytes"});
+            continue;
+        }
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1); // Windows line ending
+        }
+        if (line.find_first_not_of(" \t") == std::string_view::npos) {
+            continue; // blank lines are allowed anywhere
+        }
+        ParsedRow row;
+        const std::optional<std::string> error =
+            format == IngestFormat::Csv ? parseCsvRow(line, fields, row) : JsonLineParser(line).parse(row);
+        if (error) {
+            chunk.errors.push_back(IngestError{lineNumber, *error});
+            continue;
+        }
+        ids.push_back(row.id);
+        companies.push_back(std::move(row.company));
+        bios.push_back(std::move(row.bio));
+        rowLines.push_back(lineNumber);
+    }
+
+    FancyNameTagBatch batch = makeFancyNameTags(ids, companies, std::move(bios), alloc);
+    chunk.tags = std::move(batch.tags);
+    chunk.lines.reserve(batch.rows.size());
+    for (const std::size_t row : batch.rows) {
+        chunk.lines.push_back(rowLines[row]);
+    }
+    if (!batch.errors.empty()) {
+        for (const BatchRowError& error : batch.errors) {
+            chunk.errors.push_back(IngestError{rowLines[error.row], error.problemText()});
+        }
+        // Parse errors and rule errors were collected separately; both lists
+        // are already in line order, so a stable sort just merges them
+        std::stable_sort(chunk.errors.begin(), chunk.errors.end(),
+                         [](const IngestError& a, const IngestError& b) { return a.line < b.line; });
+    }
+    return chunk;
+}
+
+} // namespace
+
+// ==================== FancyNameTagReader ====================
+
+// Starts the workers; nothing is read until the first next()
+FancyNameTagReader::FancyNameTagReader(std::istream& in, IngestOptions options)
+    : in_(in), options_(options) {
+    if (options_.chunkLines == 0) {
+        options_.chunkLines = 1;
+    }
+    if (options_.workers == 0) {
+        options_.workers = std::max(1u, std::thread::hardware_concurrency());
+    }
+    if (options_.maxChunksInFlight == 0) {
+        options_.maxChunksInFlight = 2 * options_.workers;
+    }
+    workers_.reserve(options_.workers);
+    for (std::size_t i = 0; i < options_.workers; ++i) {
+        workers_.emplace_back([this] { work(); });
+    }
+}
+
+// Drops queued chunks, then lets the workers finish the one they're on
+FancyNameTagReader::~FancyNameTagReader() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+        tasks_.clear();
+    }
+    ready_.notify_all();
+    for (std::thread& worker : workers_) {
+        worker.join();
+    }
+}
+
+// Keeps the pipeline full, then waits for the OLDEST chunk — that is what
+// makes the output come back in input order
+bool FancyNameTagReader::next(FancyNameTagChunk& chunk) {
+    chunk = FancyNameTagChunk{};
+    while (!endOfInput_ && inFlight_.size() < options_.maxChunksInFlight) {
+        if (!submitChunk()) {
+            endOfInput_ = true;
+        }
+    }
+    if (inFlight_.empty()) {
+        return false;
+    }
+    std::future<FancyNameTagChunk> oldest = std::move(inFlight_.front());
+    inFlight_.pop_front();
+    chunk = oldest.get();
+    return true;
+}
+
+// Reads the next chunkLines lines into one buffer and queues a task for them
+bool FancyNameTagReader::submitChunk() {
+    RawChunk raw;
+    raw.firstLine = linesRead_ + 1;
+    raw.ends.reserve(options_.chunkLines);
+    raw.maxLineBytes = options_.maxLineBytes;
+    std::string line;
+    LineRead read = LineRead::End;
+    while (raw.ends.size() < options_.chunkLines &&
+           (read = readLine(in_, line, options_.maxLineBytes)) != LineRead::End) {
+        ++linesRead_;
+        if (options_.skipHeader && linesRead_ == 1 && options_.format == IngestFormat::Csv) {
+            raw.firstLine = 2;
+            continue;
+        }
+        if (read == LineRead::TooLong) {
+            raw.tooLong.push_back(raw.ends.size());
+            line.clear(); // only its line number is kept
+        }
+        if (line.size() > std::numeric_limits<std::uint32_t>::max() - raw.text.size()) {
+            throw std::length_error("FancyNameTagReader chunk is larger than 4 GB");
+        }
+        raw.text.append(line);
+        raw.ends.push_back(static_cast<std::uint32_t>(raw.text.size()));
+    }
+    if (raw.ends.empty()) {
+        return false;
+    }
+
+    auto task = std::make_shared<std::packaged_task<FancyNameTagChunk()>>(
+        [raw = std::move(raw), format = options_.format, alloc = options_.alloc] {
+            return processChunk(raw, format, alloc);
+        });
+    inFlight_.push_back(task->get_future());
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.emplace_back([task] { (*task)(); });
+    }
+    ready_.notify_one();
+    return true;
+}
+
+// Each worker takes the next queued chunk until the reader goes away
+void FancyNameTagReader::work() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            ready_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+            if (stopping_) {
+                return;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+        task();
+    }
+}
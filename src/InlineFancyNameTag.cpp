@@ -0,0 +1,304 @@
+// Include the InlineFancyNameTag class declaration
+#include "InlineFancyNameTag.h"
+// Include the short address utility for readable output
+#include "AddrUtil.h"
+// Include the allocation-free formatting helpers used by appendTo
+#include "FormatUtil.h"
+// Include the binary lifecycle event recorder
+#include "LifecycleRecorder.h"
+// Include the compile-time lifecycle tracing policy
+#include "Trace.h"
+// Include iomanip for std::setw and std::left (column alignment in print)
+#include <iomanip>
+// new for placement new
+#include <new>
+// utility for std::exchange and std::move
+#include <utility>
+
+namespace {
+
+// Label for where a Bio lives, used in log lines and print()
+const char* location(bool isInline) {
+    return isInline ? "INLINE" : "HEAP";
+}
+
+// LifecycleEvent flag for where a Bio lives
+std::uint8_t inlineFlag(bool isInline, std::uint8_t flag) {
+    return isInline ? flag : std::uint8_t{0};
+}
+
+} // namespace
+
+// Constructor: validates everything first, then stores the Bio
+InlineFancyNameTag::InlineFancyNameTag(int id, const std::string& company, const Bio& bio)
+    : id_(id),
+      bio_(nullptr) {
+
+    // Same invariants as FancyNameTag
+    if (id_ <= 0) {
+        throw std::invalid_argument("InlineFancyNameTag id must be positive");
+    }
+    if (company.empty()) {
+        throw std::invalid_argument("InlineFancyNameTag company must not be empty");
+    }
+    if (bio.name.empty()) {
+        throw std::invalid_argument("InlineFancyNameTag bio name must not be empty");
+    }
+    if (bio.title.empty()) {
+        throw std::invalid_argument("InlineFancyNameTag bio title must not be empty");
+    }
+    if (bio.year <= 0) {
+        throw std::invalid_argument("InlineFancyNameTag bio year must be positive");
+    }
+    // Interned last: the table never frees a name, so a rejected tag must not add one
+    company_ = CompanyTable::intern(company);
+    storeBio(bio);
+
+    if constexpr (kTraceEnabled) {
+        TraceLine() << "Constructor (STACK " << shortAddr(this) << "): id=" << id_
+                    << ", company=\"" << company_.str() << "\", bio={" << *bio_
+                    << "} (" << location(isBioInline()) << " " << shortAddr(bio_) << ")\n";
+    }
+    recordLifecycleWithBio(LifecycleKind::Construct, LifecycleTag::InlineFancyNameTag, this, id_, bio_,
+                           company_.str(), inlineFlag(isBioInline(), kLifecycleBioInline));
+}
+
+// Destructor: an inline Bio only needs its destructor called (the memory is
+// part of this object); a heap Bio is deleted
+InlineFancyNameTag::~InlineFancyNameTag() {
+    if constexpr (kTraceEnabled) {
+        TraceLine line;
+        line << "Destructor (STACK " << shortAddr(this) << "): id=" << id_ << ", bio=";
+        if (bio_) {
+            line << "{" << *bio_ << "} (" << location(isBioInline()) << " " << shortAddr(bio_) << ")";
+        } else {
+            line << "(moved)";
+        }
+        line << "\n";
+    }
+    recordLifecycleWithBio(LifecycleKind::Destroy, LifecycleTag::InlineFancyNameTag, this, id_, bio_, {},
+                           inlineFlag(isBioInline(), kLifecycleBioInline));
+
+    releaseBio();
+}
+
+// Copy constructor: deep copy. storeBio() picks inline or heap for the copy,
+// which is always the same choice the original made.
+InlineFancyNameTag::InlineFancyNameTag(const InlineFancyNameTag& other)
+    : id_(other.id_),
+      company_(other.company_),
+      bio_(nullptr) {
+    storeBio(*other.bio_);
+    if constexpr (kTraceEnabled) {
+        TraceLine() << "Copy Constructor (STACK " << shortAddr(this) << "): id=" << id_
+                    << ", copied bio from " << location(other.isBioInline()) << " " << shortAddr(other.bio_)
+                    << " to " << location(isBioInline()) << " " << shortAddr(bio_) << "\n";
+    }
+    recordLifecycle(LifecycleKind::Copy, LifecycleTag::InlineFancyNameTag, this, id_, bio_, &other, other.bio_,
+                    inlineFlag(isBioInline(), kLifecycleBioInline) |
+                        inlineFlag(other.isBioInline(), kLifecycleSourceBioInline));
+}
+
+// Move constructor:
+//   - heap Bio:   steal the pointer (same as FancyNameTag)
+//   - inline Bio: the Bio's bytes are part of "other", so we can't take them.
+//                 Instead we move-construct a Bio in OUR buffer (which moves
+//                 the strings — cheap and noexcept) and destroy the source's.
+// Either way other.bio_ ends up nullptr.
+InlineFancyNameTag::InlineFancyNameTag(InlineFancyNameTag&& other) noexcept
+    : id_(other.id_),
+      company_(other.company_),
+      bio_(nullptr) {
+    if (other.isBioInline()) {
+        bio_ = new (inlineBio_) Bio(std::move(*other.bio_));
+        other.releaseBio();
+    } else {
+        bio_ = std::exchange(other.bio_, nullptr);
+    }
+    if constexpr (kTraceEnabled) {
+        TraceLine line;
+        line << "Move Constructor (STACK " << shortAddr(this) << "): id=" << id_;
+        if (bio_) {
+            line << ", took ownership of bio at " << location(isBioInline()) << " " << shortAddr(bio_);
+        }
+        line << "\n";
+    }
+    recordLifecycle(LifecycleKind::Move, LifecycleTag::InlineFancyNameTag, this, id_, bio_, &other,
+                    nullptr, inlineFlag(isBioInline(), kLifecycleBioInline));
+}
+
+// Prints the same columns as FancyNameTag::print
+void InlineFancyNameTag::print(const std::string& label, const std::string& state) const {
+    std::cout << std::right
+              << std::setw(18)
+              << label
+              << "  STACK "
+              << shortAddr(this)
+              << "  id="
+              << std::left
+              << std::setw(6)
+              << id_
+              << "company="
+              << std::setw(30)
+              << ("\"" + company_.str() + "\"")
+              << "bio=";
+
+    if (bio_) {
+        std::cout << "{";
+        bio_->print();
+        std::cout << "} "
+                  << location(isBioInline())
+                  << " "
+                  << shortAddr(bio_);
+    } else {
+        std::cout << "(moved)";
+    }
+    if (!state.empty()) {
+        std::cout << "  ("
+                  << state
+                  << ")";
+    }
+    std::cout << "\n";
+}
+
+// Same columns as print(), appended to a caller-owned buffer
+void InlineFancyNameTag::appendTo(std::string& out, std::string_view label, std::string_view state) const {
+    appendRight(out, label, 18);
+    out.append("  STACK ");
+    appendShortAddr(out, this);
+    out.append("  id=");
+    appendInt(out, id_, 6);
+    out.append("company=");
+    appendQuotedLeft(out, company_.str(), 30);
+    out.append("bio=");
+    if (bio_) {
+        out.push_back('{');
+        bio_->appendTo(out);
+        out.append("} ");
+        out.append(location(isBioInline()));
+        out.push_back(' ');
+        appendShortAddr(out, bio_);
+    } else {
+        out.append("(moved)");
+    }
+    if (!state.empty()) {
+        out.append("  (");
+        out.append(state);
+        out.push_back(')');
+    }
+    out.push_back('\n');
+}
+
+// Returns the id value
+int InlineFancyNameTag::getId() const { return id_; }
+
+// Returns a const reference to the company string
+const std::string& InlineFancyNameTag::getCompany() const { return company_.str(); }
+
+// Returns the interned company handle (compare these instead of strings)
+CompanyId InlineFancyNameTag::getCompanyId() const { return company_; }
+
+// Returns a const reference to the Bio (inline or heap, same dereference)
+const Bio& InlineFancyNameTag::getBio() const { return *bio_; }
+
+// Sets the id, enforcing the invariant that it must be positive
+void InlineFancyNameTag::setId(int id) {
+    if (id <= 0) {
+        throw std::invalid_argument("InlineFancyNameTag id must be positive");
+    }
+    id_ = id;
+}
+
+// Sets the company name, enforcing the invariant that it must not be empty
+void InlineFancyNameTag::setCompany(const std::string& company) {
+    if (company.empty()) {
+        throw std::invalid_argument("InlineFancyNameTag company must not be empty");
+    }
+    company_ = CompanyTable::intern(company);
+}
+
+// Replaces the whole Bio (it may move between inline and heap storage)
+void InlineFancyNameTag::setBio(const Bio& bio) {
+    if (bio.name.empty()) {
+        throw std::invalid_argument("InlineFancyNameTag bio name must not be empty");
+    }
+    if (bio.title.empty()) {
+        throw std::invalid_argument("InlineFancyNameTag bio title must not be empty");
+    }
+    if (bio.year <= 0) {
+        throw std::invalid_argument("InlineFancyNameTag bio year must be positive");
+    }
+    // Copy first: if copying throws, we still own the old Bio
+    replaceBio(Bio(bio));
+}
+
+// Changes only the Bio's title; a title that no longer fits moves the Bio to the heap
+void InlineFancyNameTag::setBioTitle(const std::string& title) {
+    if (title.empty()) {
+        throw std::invalid_argument("InlineFancyNameTag bio title must not be empty");
+    }
+    if (!bio_) {
+        throw std::logic_error("InlineFancyNameTag has no bio (it was moved from)");
+    }
+    // Still stored in the same place: just assign (if that throws, the old
+    // title stays). Otherwise the Bio moves between inline and heap storage.
+    const bool fitsAfter = title.size() <= kMaxInlineChars
+                        && bio_->name.size() <= kMaxInlineChars
+                        && bio_->department.size() <= kMaxInlineChars;
+    if (fitsAfter == isBioInline()) {
+        bio_->title = title;
+        return;
+    }
+    Bio updated(*bio_);
+    updated.title = title;
+    replaceBio(std::move(updated));
+}
+
+// A moved-from object has no Bio
+bool InlineFancyNameTag::hasBio() const { return bio_ != nullptr; }
+
+// The Bio is inline when bio_ points at our own buffer
+bool InlineFancyNameTag::isBioInline() const {
+    return bio_ == reinterpret_cast<const Bio*>(inlineBio_);
+}
+
+// Every text field must be short enough
+bool InlineFancyNameTag::fitsInline(const Bio& bio) {
+    return bio.name.size() <= kMaxInlineChars
+        && bio.title.size() <= kMaxInlineChars
+        && bio.department.size() <= kMaxInlineChars;
+}
+
+// Copies bio into our buffer (placement new) or onto the heap
+void InlineFancyNameTag::storeBio(const Bio& bio) {
+    if (fitsInline(bio)) {
+        bio_ = new (inlineBio_) Bio(bio);
+    } else {
+        bio_ = new Bio(bio);
+    }
+}
+
+// Moving strings never throws, so an inline replacement can go in after the
+// old Bio is gone. A heap one is allocated first: if new throws, we still own
+// the old Bio.
+void InlineFancyNameTag::replaceBio(Bio&& replacement) {
+    if (fitsInline(replacement)) {
+        releaseBio();
+        bio_ = new (inlineBio_) Bio(std::move(replacement));
+    } else {
+        Bio* onHeap = new Bio(std::move(replacement));
+        releaseBio();
+        bio_ = onHeap;
+    }
+}
+
+// Ends the lifetime of our Bio, wherever it is
+void InlineFancyNameTag::releaseBio() noexcept {
+    if (isBioInline()) {
+        // Placement-new objects are destroyed by calling the destructor directly
+        bio_->~Bio();
+    } else {
+        delete bio_;
+    }
+    bio_ = nullptr;
+}
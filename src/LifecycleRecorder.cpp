@@ -0,0 +1,572 @@
+// Include the recorder and event declarations
+#include "LifecycleRecorder.h"
+// Include the short address utility so decoded lines match the console trace
+#include "AddrUtil.h"
+// Include the allocation-free formatting helpers
+#include "FormatUtil.h"
+
+// algorithm for std::min, std::copy, std::fill and std::stable_sort
+#include <algorithm>
+// chrono for steady_clock and the drainer's wake-up interval
+#include <chrono>
+// condition_variable so stop() can wake the drainer right away
+#include <condition_variable>
+// cstring for std::memcmp on the file magic and std::memcpy of event text
+#include <cstring>
+// fstream for the output file
+#include <fstream>
+// iterator for std::begin and std::end
+#include <iterator>
+// memory for std::shared_ptr and std::unique_ptr
+#include <memory>
+// mutex for the ring list and the start/stop state
+#include <mutex>
+// new for std::nothrow
+#include <new>
+// stdexcept for std::runtime_error and std::logic_error
+#include <stdexcept>
+// thread for the drainer
+#include <thread>
+
+// __rdtsc() reads the CPU's time-stamp counter
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define NAMETAG_HAS_RDTSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define NAMETAG_HAS_RDTSC 1
+#endif
+
+namespace {
+
+// How many records an event's text takes up after it
+std::size_t textRecords(const std::uint16_t (&textSizes)[kLifecycleTextCount]) noexcept {
+    std::size_t size = 0;
+    for (const std::uint16_t textSize : textSizes) {
+        size += textSize;
+    }
+    return (size + sizeof(LifecycleEvent) - 1) / sizeof(LifecycleEvent);
+}
+
+// File layout: a 32-byte header, then LifecycleEvent records back to back,
+// each followed by its text records (native byte order — decode on the same
+// kind of machine that recorded)
+constexpr char kMagic[4] = {'N', 'T', 'L', 'C'};
+constexpr std::uint16_t kVersion = 2;
+
+struct FileHeader {
+    char magic[4];
+    std::uint16_t version;
+    std::uint16_t eventSize;
+    // Converts event ticks to steady_clock nanoseconds:
+    //   ns = startNs + (ticks - startTicks) / ticksPerNs
+    // start() writes the header with ticksPerNs = 1; stop() measures the real
+    // rate over the whole recording and rewrites it. 0 means the events have
+    // no timestamps (LifecycleTimestamps::Off).
+    std::uint64_t startTicks;
+    std::uint64_t startNs;
+    double ticksPerNs;
+};
+
+static_assert(sizeof(FileHeader) == 32, "FileHeader is written to disk as-is");
+
+std::uint64_t steadyNs() noexcept {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// Whether record() reads the clock (set by start() before recording turns on)
+std::atomic<bool> timestampsOn{true};
+
+// The cheapest clock available. Reading steady_clock costs ~25-40 ns (more
+// than the rest of record() put together); the x86 time-stamp counter costs
+// about half that, and the header's calibration turns it back into nanoseconds.
+std::uint64_t readTicks() noexcept {
+#if defined(NAMETAG_HAS_RDTSC)
+    return __rdtsc();
+#else
+    return steadyNs();
+#endif
+}
+
+// A single-producer, single-consumer ring of events.
+//
+// The owning thread is the only producer and the drainer is the only
+// consumer, so each index has exactly one writer: publish() only stores head_,
+// drain() only stores tail_. head_ and tail_ sit on separate cache lines so
+// the two threads don't keep stealing the same line from each other.
+class EventRing {
+public:
+    static constexpr std::size_t kCapacity = LifecycleRecorder::kRingCapacity;
+    static constexpr std::uint64_t kMask = kCapacity - 1;
+    static_assert((kCapacity & kMask) == 0, "ring capacity must be a power of two");
+
+    EventRing() : slots_(new LifecycleEvent[kCapacity]) {}
+
+    // Producer side. Returns the first of `count` free slots (the rest follow
+    // it, wrapping around the end), or nullptr if the ring is too full.
+    // Nothing is visible to the drainer until publish().
+    LifecycleEvent* claim(std::size_t count) noexcept {
+        const std::uint64_t head = head_.load(std::memory_order_relaxed);
+        if (head + count - cachedTail_ > kCapacity) {
+            // Looks full — check where the drainer really is before giving up
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+            if (head + count - cachedTail_ > kCapacity) {
+                return nullptr;
+            }
+        }
+        return &slots_[head & kMask];
+    }
+
+    // Producer side. The slot `offset` places after the first claimed one
+    LifecycleEvent& claimed(std::size_t offset) noexcept {
+        return slots_[(head_.load(std::memory_order_relaxed) + offset) & kMask];
+    }
+
+    // Producer side. Hands the first `count` claimed slots to the drainer.
+    void publish(std::size_t count) noexcept {
+        // release: the drainer that sees the new head also sees the events
+        head_.store(head_.load(std::memory_order_relaxed) + count, std::memory_order_release);
+    }
+
+    // Consumer side. Hands every waiting record to write(first, count) in at
+    // most two contiguous runs, frees their slots and returns how many events
+    // they held (an event's text records aren't events of their own).
+    template <typename Write>
+    std::size_t drain(Write write) {
+        const std::uint64_t head = head_.load(std::memory_order_acquire);
+        std::uint64_t tail = tail_.load(std::memory_order_relaxed);
+        std::size_t events = 0;
+        for (std::uint64_t record = tail; record != head; ++events) {
+            record += 1 + textRecords(slots_[record & kMask].textSizes);
+        }
+        while (tail != head) {
+            const std::size_t index = static_cast<std::size_t>(tail & kMask);
+            const std::size_t count = std::min<std::size_t>(static_cast<std::size_t>(head - tail), kCapacity - index);
+            write(&slots_[index], count);
+            tail += count;
+        }
+        // release: the producer that sees the new tail may reuse the slots
+        tail_.store(tail, std::memory_order_release);
+        return events;
+    }
+
+    // Consumer side. Throws away everything waiting (left over from an earlier recording).
+    void discard() {
+        tail_.store(head_.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    bool empty() const {
+        return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+    }
+
+    // Set when the owning thread exits; the drainer then frees the ring once it is empty
+    std::atomic<bool> retired{false};
+
+private:
+    std::unique_ptr<LifecycleEvent[]> slots_;
+    alignas(64) std::atomic<std::uint64_t> head_{0};
+    std::uint64_t cachedTail_ = 0; // producer's last look at tail_
+    alignas(64) std::atomic<std::uint64_t> tail_{0};
+};
+
+// Everything shared between recording threads, the drainer and start()/stop()
+struct Recorder {
+    // Every thread's ring. Locked only when a thread records for the first
+    // time and when the drainer takes its snapshot of the list.
+    std::mutex ringsMutex;
+    std::vector<std::shared_ptr<EventRing>> rings;
+
+    // start()/stop() state
+    std::mutex controlMutex;
+    std::condition_variable wake;
+    bool stopRequested = false;
+    std::thread drainer;
+    std::ofstream file;
+    FileHeader header{};
+
+    std::atomic<std::uint64_t> written{0};
+    std::atomic<std::uint64_t> dropped{0};
+
+    // Writes out everything waiting in every ring.
+    // Runs on the drainer thread, or in stop() after the drainer has exited.
+    void drainAll() {
+        std::vector<std::shared_ptr<EventRing>> snapshot;
+        {
+            std::lock_guard<std::mutex> lock(ringsMutex);
+            snapshot = rings;
+        }
+        for (const auto& ring : snapshot) {
+            const std::size_t count = ring->drain([this](const LifecycleEvent* first, std::size_t n) {
+                file.write(reinterpret_cast<const char*>(first),
+                           static_cast<std::streamsize>(n * sizeof(LifecycleEvent)));
+            });
+            written.fetch_add(count, std::memory_order_relaxed);
+        }
+        file.flush();
+
+        // Forget rings whose threads have exited and whose events are all written
+        std::lock_guard<std::mutex> lock(ringsMutex);
+        std::erase_if(rings, [](const std::shared_ptr<EventRing>& ring) {
+            return ring->retired.load(std::memory_order_acquire) && ring->empty();
+        });
+    }
+
+    void drainLoop() {
+        std::unique_lock<std::mutex> lock(controlMutex);
+        while (!stopRequested) {
+            lock.unlock();
+            drainAll();
+            lock.lock();
+            wake.wait_for(lock, std::chrono::milliseconds(1), [this] { return stopRequested; });
+        }
+    }
+};
+
+// Intentionally never destroyed: tags destroyed during static destruction
+// may still call record()
+Recorder& recorder() {
+    static Recorder* instance = new Recorder;
+    return *instance;
+}
+
+// The calling thread's ring. Both are plain (trivially destructible)
+// thread_locals, so checking them costs no guard on the recording path.
+thread_local EventRing* threadRing = nullptr;
+thread_local bool threadExited = false;
+
+// Marks the ring as retired when its thread exits
+struct RingOwner {
+    std::shared_ptr<EventRing> ring;
+    ~RingOwner() {
+        ring->retired.store(true, std::memory_order_release);
+        threadRing = nullptr;
+        threadExited = true;
+    }
+};
+
+// Slow path: the first event this thread records
+EventRing* registerThread() noexcept {
+    if (threadExited) {
+        return nullptr;
+    }
+    try {
+        auto ring = std::make_shared<EventRing>();
+        {
+            Recorder& r = recorder();
+            std::lock_guard<std::mutex> lock(r.ringsMutex);
+            r.rings.push_back(ring);
+        }
+        thread_local RingOwner owner{ring};
+        threadRing = ring.get();
+        return threadRing;
+    } catch (...) {
+        // Out of memory: skip the event rather than throw from a destructor
+        return nullptr;
+    }
+}
+
+} // namespace
+
+// Opens the file, clears out stale events and starts the drainer
+void LifecycleRecorder::start(const std::string& path, LifecycleTimestamps timestamps) {
+    Recorder& r = recorder();
+    std::lock_guard<std::mutex> lock(r.controlMutex);
+    if (r.drainer.joinable()) {
+        throw std::logic_error("LifecycleRecorder is already recording");
+    }
+    r.file.open(path, std::ios::binary | std::ios::trunc);
+    if (!r.file) {
+        r.file.clear();
+        throw std::runtime_error("LifecycleRecorder could not open " + path);
+    }
+    FileHeader& header = r.header;
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.eventSize = sizeof(LifecycleEvent);
+    header.startNs = steadyNs();
+    header.startTicks = readTicks();
+    header.ticksPerNs = timestamps == LifecycleTimestamps::On ? 1.0 : 0.0;
+    r.file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    // A thread that was mid-record() when the last recording stopped may have
+    // left an event behind; it doesn't belong in this file
+    {
+        std::lock_guard<std::mutex> ringsLock(r.ringsMutex);
+        for (const auto& ring : r.rings) {
+            ring->discard();
+        }
+    }
+    r.written.store(0, std::memory_order_relaxed);
+    r.dropped.store(0, std::memory_order_relaxed);
+    r.stopRequested = false;
+    r.drainer = std::thread([&r] { r.drainLoop(); });
+    timestampsOn.store(timestamps == LifecycleTimestamps::On, std::memory_order_relaxed);
+    recording_.store(true, std::memory_order_relaxed);
+}
+
+// Stops recording, then writes out what is left
+void LifecycleRecorder::stop() {
+    Recorder& r = recorder();
+    std::unique_lock<std::mutex> lock(r.controlMutex);
+    if (!r.drainer.joinable()) {
+        return;
+    }
+    recording_.store(false, std::memory_order_relaxed);
+    r.stopRequested = true;
+    lock.unlock();
+    r.wake.notify_one();
+    r.drainer.join();
+    lock.lock();
+    // The drainer has exited, so this thread is now the only consumer
+    r.drainAll();
+
+    // Now that the recording is over, measure how fast the clock ticked
+    const std::uint64_t endTicks = readTicks();
+    const std::uint64_t endNs = steadyNs();
+    FileHeader& header = r.header;
+    if (header.ticksPerNs > 0.0 && endNs > header.startNs && endTicks > header.startTicks) {
+        header.ticksPerNs = static_cast<double>(endTicks - header.startTicks) /
+                            static_cast<double>(endNs - header.startNs);
+    }
+    r.file.seekp(0);
+    r.file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    r.file.close();
+}
+
+namespace {
+
+// The calling thread's ring, registering it on first use (nullptr if that failed)
+EventRing* currentRing() noexcept {
+    EventRing* ring = threadRing;
+    return ring != nullptr ? ring : registerThread();
+}
+
+// Fills in everything but the text sizes and year
+void fillEvent(LifecycleEvent& event, LifecycleKind kind, LifecycleTag tag, const void* object, int id,
+               const void* bio, const void* source, const void* sourceBio, std::uint8_t flags) noexcept {
+    event.timestamp = timestampsOn.load(std::memory_order_relaxed) ? readTicks() : 0;
+    event.object = reinterpret_cast<std::uintptr_t>(object);
+    event.source = reinterpret_cast<std::uintptr_t>(source);
+    event.bio = reinterpret_cast<std::uintptr_t>(bio);
+    event.sourceBio = reinterpret_cast<std::uintptr_t>(sourceBio);
+    event.id = id;
+    event.kind = kind;
+    event.tag = tag;
+    event.flags = flags;
+}
+
+void countDropped() noexcept {
+    recorder().dropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace
+
+// Fast path: one thread-local load, one timestamp, one ring slot
+void LifecycleRecorder::record(LifecycleKind kind, LifecycleTag tag, const void* object, int id,
+                               const void* bio, const void* source, const void* sourceBio,
+                               std::uint8_t flags) noexcept {
+    EventRing* ring = currentRing();
+    if (ring == nullptr) {
+        return;
+    }
+    LifecycleEvent* event = ring->claim(1);
+    if (event == nullptr) {
+        countDropped();
+        return;
+    }
+    fillEvent(*event, kind, tag, object, id, bio, source, sourceBio, flags);
+    event->year = 0;
+    std::fill(std::begin(event->textSizes), std::end(event->textSizes), std::uint16_t{0});
+    ring->publish(1);
+}
+
+// The event, then its strings packed into as many records as they need
+void LifecycleRecorder::recordText(LifecycleKind kind, LifecycleTag tag, const void* object, int id,
+                                   const void* bio, std::uint8_t flags,
+                                   const std::string_view (&text)[kLifecycleTextCount], int year) noexcept {
+    EventRing* ring = currentRing();
+    if (ring == nullptr) {
+        return;
+    }
+    std::uint16_t sizes[kLifecycleTextCount];
+    for (std::size_t i = 0; i < kLifecycleTextCount; ++i) {
+        sizes[i] = static_cast<std::uint16_t>(std::min<std::size_t>(text[i].size(), 0xFFFF));
+    }
+    const std::size_t extraRecords = textRecords(sizes);
+    LifecycleEvent* event = ring->claim(1 + extraRecords);
+    if (event == nullptr) {
+        countDropped();
+        return;
+    }
+    fillEvent(*event, kind, tag, object, id, bio, nullptr, nullptr, flags);
+    event->year = year;
+    std::copy(std::begin(sizes), std::end(sizes), std::begin(event->textSizes));
+
+    // Copy the strings into the records after the event, one record at a time
+    // (the claimed records may wrap around the end of the ring)
+    std::size_t record = 1;
+    std::size_t used = 0; // bytes already written into the current record
+    for (std::size_t i = 0; i < kLifecycleTextCount; ++i) {
+        const char* bytes = text[i].data();
+        std::size_t left = sizes[i];
+        while (left > 0) {
+            const std::size_t count = std::min(left, sizeof(LifecycleEvent) - used);
+            auto* target = reinterpret_cast<unsigned char*>(&ring->claimed(record));
+            std::memcpy(target + used, bytes, count);
+            bytes += count;
+            left -= count;
+            used += count;
+            if (used == sizeof(LifecycleEvent)) {
+                ++record;
+                used = 0;
+            }
+        }
+    }
+    ring->publish(1 + extraRecords);
+}
+
+std::uint64_t LifecycleRecorder::writtenEvents() {
+    return recorder().written.load(std::memory_order_relaxed);
+}
+
+std::uint64_t LifecycleRecorder::droppedEvents() {
+    return recorder().dropped.load(std::memory_order_relaxed);
+}
+
+// ==================== Reading a recording back ====================
+
+// Checks the header, reads the records and puts them in time order
+std::vector<LifecycleRecord> readLifecycleRecords(std::istream& in) {
+    FileHeader header{};
+    if (!in.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) {
+        throw std::runtime_error("not a lifecycle recording");
+    }
+    if (header.version != kVersion || header.eventSize != sizeof(LifecycleEvent) || !(header.ticksPerNs >= 0.0)) {
+        throw std::runtime_error("unsupported lifecycle recording version");
+    }
+
+    std::vector<LifecycleRecord> records;
+    LifecycleRecord record;
+    LifecycleEvent& event = record.event;
+    std::string text;
+    while (in.read(reinterpret_cast<char*>(&event), sizeof(event))) {
+        // Ticks -> nanoseconds (signed: an event may be a hair before startTicks)
+        if (header.ticksPerNs > 0.0) {
+            const double ticks = static_cast<double>(static_cast<std::int64_t>(event.timestamp - header.startTicks));
+            event.timestamp = header.startNs + static_cast<std::uint64_t>(static_cast<std::int64_t>(ticks / header.ticksPerNs));
+        }
+
+        // The strings follow the event, padded out to whole records
+        text.resize(textRecords(event.textSizes) * sizeof(LifecycleEvent));
+        if (!in.read(text.data(), static_cast<std::streamsize>(text.size()))) {
+            throw std::runtime_error("lifecycle recording ends in the middle of an event");
+        }
+        std::string* const strings[kLifecycleTextCount] = {&record.company, &record.name, &record.title,
+                                                           &record.department};
+        std::size_t offset = 0;
+        for (std::size_t i = 0; i < kLifecycleTextCount; ++i) {
+            strings[i]->assign(text, offset, event.textSizes[i]);
+            offset += event.textSizes[i];
+        }
+        records.push_back(record);
+    }
+    // stable: events from one thread keep their recorded order on equal timestamps
+    // (without timestamps, all of them are equal and the file order stands)
+    std::stable_sort(records.begin(), records.end(), [](const LifecycleRecord& a, const LifecycleRecord& b) {
+        return a.event.timestamp < b.event.timestamp;
+    });
+    return records;
+}
+
+namespace {
+
+// Appends "HEAP 2a40" or "INLINE 1c90"
+void appendBioAt(std::string& out, std::uint64_t bio, bool isInline) {
+    out.append(isInline ? "INLINE " : "HEAP ");
+    out.append(shortAddrFromBits(static_cast<std::uintptr_t>(bio)).view());
+}
+
+// Appends "bio={Scott, Professor, Computer Science, 2010} (HEAP 2a40)"
+void appendBio(std::string& out, const LifecycleRecord& record) {
+    const LifecycleEvent& event = record.event;
+    out.append("bio={");
+    Bio{record.name, record.title, record.department, event.year}.appendTo(out);
+    out.append("} (");
+    appendBioAt(out, event.bio, (event.flags & kLifecycleBioInline) != 0);
+    out.push_back(')');
+}
+
+// NameTag only logs its constructor:
+//   Constructor: id=1, name="Waldo", company="Weber State University"
+void appendNameTagLine(std::string& out, const LifecycleRecord& record) {
+    out.append("Constructor: id=");
+    appendInt(out, record.event.id);
+    out.append(", name=\"");
+    out.append(record.name);
+    out.append("\", company=\"");
+    out.append(record.company);
+    out.append("\"\n");
+}
+
+} // namespace
+
+// Rebuilds the console line for one event (see NameTag.cpp, FancyNameTag.cpp
+// and InlineFancyNameTag.cpp)
+void appendLifecycleLine(std::string& out, const LifecycleRecord& record) {
+    const LifecycleEvent& event = record.event;
+    if (event.tag == LifecycleTag::NameTag) {
+        appendNameTagLine(out, record);
+        return;
+    }
+    const bool bioInline = (event.flags & kLifecycleBioInline) != 0;
+    const bool sourceBioInline = (event.flags & kLifecycleSourceBioInline) != 0;
+
+    switch (event.kind) {
+        case LifecycleKind::Construct: out.append("Constructor"); break;
+        case LifecycleKind::Copy: out.append("Copy Constructor"); break;
+        case LifecycleKind::Move: out.append("Move Constructor"); break;
+        case LifecycleKind::Destroy: out.append("Destructor"); break;
+        case LifecycleKind::CopyAssign: out.append("Copy Assignment"); break;
+        case LifecycleKind::MoveAssign: out.append("Move Assignment"); break;
+    }
+    out.append(" (STACK ");
+    out.append(shortAddrFromBits(static_cast<std::uintptr_t>(event.object)).view());
+    out.append("): id=");
+    appendInt(out, event.id);
+
+    switch (event.kind) {
+        case LifecycleKind::Construct:
+            out.append(", company=\"");
+            out.append(record.company);
+            out.append("\", ");
+            appendBio(out, record);
+            break;
+        case LifecycleKind::Copy:
+        case LifecycleKind::CopyAssign:
+            out.append(", copied bio from ");
+            appendBioAt(out, event.sourceBio, sourceBioInline);
+            out.append(" to ");
+            appendBioAt(out, event.bio, bioInline);
+            break;
+        case LifecycleKind::Move:
+        case LifecycleKind::MoveAssign:
+            // FancyNameTag always logs the pointer it took (even null);
+            // InlineFancyNameTag only when there was a Bio to take
+            if (event.tag == LifecycleTag::FancyNameTag || event.bio != 0) {
+                out.append(", took ownership of bio at ");
+                appendBioAt(out, event.bio, bioInline);
+            }
+            break;
+        case LifecycleKind::Destroy:
+            out.append(", ");
+            if (event.bio != 0) {
+                appendBio(out, record);
+            } else {
+                out.append("bio=(moved)");
+            }
+            break;
+    }
+    out.push_back('\n');
+}
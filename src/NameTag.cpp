@@ -2,22 +2,56 @@
 #include "NameTag.h"
 // Include the short address utility for readable output
 #include "AddrUtil.h"
+// Include the allocation-free formatting helpers used by appendTo
+#include "FormatUtil.h"
+// Include the hash-combining helpers for the cached hash
+#include "HashUtil.h"
+// Include the binary lifecycle event recorder
+#include "LifecycleRecorder.h"
+// Include the compile-time lifecycle tracing policy
+#include "Trace.h"
 // Include iomanip for std::setw and std::left (column alignment in print)
 #include <iomanip>
-
-// Constructor: initializes id_, name_, and company_ using the member initializer list
-NameTag::NameTag(int id, const std::string& name, const std::string& company)
+// utility for std::move
+#include <utility>
+
+// Constructor: initializes id_ and name_ using the member initializer list
+// (name is our own copy already, so it is moved into name_, not copied again).
+// company_ is set last, after every check has passed: interned names are never
+// freed, so a rejected tag must not leave its company in the table.
+NameTag::NameTag(int id, std::string name, std::string_view company)
     : id_(id),
-      name_(name),
-      company_(company) {
+      name_(std::move(name)) {
 
-    // TODO: Validate invariants — throw std::invalid_argument if:
-    //   - id_ <= 0           ("NameTag id must be positive")
-    //   - name_ is empty     ("NameTag name must not be empty")
-    //   - company_ is empty  ("NameTag company must not be empty")
+    // Validate invariants: id must be positive
+    if (id_ <= 0) {
+        throw std::invalid_argument("NameTag id must be positive");
+    }
+    // Validate invariants: name must not be empty
+    if (name_.empty()) {
+        throw std::invalid_argument("NameTag name must not be empty");
+    }
+    // Validate invariants: company must not be empty
+    if (company.empty()) {
+        throw std::invalid_argument("NameTag company must not be empty");
+    }
+    company_ = CompanyTable::intern(company);
+    rehash();
 
-    // TODO: Log which NameTag was constructed using std::cout
+    // Log which NameTag was constructed
     // Format: Constructor: id=1, name="Waldo", company="Weber State University"
+    // (if constexpr: with NAMETAG_TRACE=NONE this block isn't compiled at all)
+    if constexpr (kTraceEnabled) {
+        TraceLine() << "Constructor: id="
+                    << id_
+                    << ", name=\""
+                    << name_
+                    << "\", company=\""
+                    << company_.str()
+                    << "\"\n";
+    }
+    // Copies and moves aren't recorded: NameTag doesn't log them either
+    recordLifecycleWithName(LifecycleKind::Construct, this, id_, name_, company_.str());
 }
 
 // Prints the NameTag data with a descriptive label and optional state hint
@@ -50,7 +84,7 @@ void NameTag::print(const std::string& label, const std::string& state) const {
     // Column 5: company
 
               << "company=\""
-              << company_
+              << company_.str()
               << "\"";
 
     // Optional state hint on the right (e.g., "(unchanged)", "(modified)")
@@ -61,38 +95,140 @@ void NameTag::print(const std::string& label, const std::string& state) const {
     std::cout << "\n";
 }
 
-// TODO: Implement the three getters below
-// Each should return the corresponding private member
+// Same columns as print(), appended to a caller-owned buffer
+void NameTag::appendTo(std::string& out, std::string_view label, std::string_view state) const {
+    appendRight(out, label, 18);
+    out.append("  STACK ");
+    appendShortAddr(out, this);
+    out.append("  id=");
+    appendInt(out, id_, 6);
+    out.append("name=");
+    appendQuotedLeft(out, name_, 12);
+    out.append("company=\"");
+    out.append(company_.str());
+    out.append("\"");
+    if (!state.empty()) {
+        out.append("  (");
+        out.append(state);
+        out.append(")");
+    }
+    out.push_back('\n');
+}
+
 // getId() returns by value (int is cheap to copy)
 // getName() and getCompany() return by const reference (avoids copying strings)
 
 // Returns the id value
-int NameTag::getId() const { /* TODO */ return 0; }
+int NameTag::getId() const { return id_; }
 
 // Returns a const reference to the name string
-const std::string& NameTag::getName() const { /* TODO */ static std::string empty; return empty; }
+const std::string& NameTag::getName() const { return name_; }
 
 // Returns a const reference to the company string
-const std::string& NameTag::getCompany() const { /* TODO */ static std::string empty; return empty; }
+const std::string& NameTag::getCompany() const { return company_.str(); }
+
+// Returns the interned company handle (compare these instead of strings)
+CompanyId NameTag::getCompanyId() const { return company_; }
 
-// TODO: Implement the three setters below
-// Each should validate the input and throw std::invalid_argument if invalid,
-// then assign the new value to the private member
+// Each setter validates the input and throws std::invalid_argument if invalid,
+// then assigns the new value to the private member
 
 // Sets the id, enforcing the invariant that it must be positive
 void NameTag::setId(int id) {
-    // TODO: Validate that id > 0, throw std::invalid_argument("NameTag id must be positive") if not
-    // TODO: Assign id to id_
+    // Validate before modifying — this is the advantage of using a setter
+    // instead of making id_ public
+    if (id <= 0) {
+        throw std::invalid_argument("NameTag id must be positive");
+    }
+    id_ = id;
+    rehash();
 }
 
 // Sets the name, enforcing the invariant that it must not be empty
 void NameTag::setName(const std::string& name) {
-    // TODO: Validate that name is not empty, throw std::invalid_argument("NameTag name must not be empty") if not
-    // TODO: Assign name to name_
+    // Validate before modifying — this is the advantage of using a setter
+    // instead of making name_ public
+    if (name.empty()) {
+        throw std::invalid_argument("NameTag name must not be empty");
+    }
+    name_ = name;
+    rehash();
+}
+
+// Same, but takes over the caller's string buffer
+void NameTag::setName(std::string&& name) {
+    if (name.empty()) {
+        throw std::invalid_argument("NameTag name must not be empty");
+    }
+    name_ = std::move(name);
+    rehash();
 }
 
 // Sets the company name, enforcing the invariant that it must not be empty
-void NameTag::setCompany(const std::string& company) {
-    // TODO: Validate that company is not empty, throw std::invalid_argument("NameTag company must not be empty") if not
-    // TODO: Assign company to company_
+void NameTag::setCompany(std::string_view company) {
+    // Validate before modifying — this is the advantage of using a setter
+    // instead of making company_ public
+    if (company.empty()) {
+        throw std::invalid_argument("NameTag company must not be empty");
+    }
+    company_ = CompanyTable::intern(company);
+    rehash();
 }
+
+// ==================== Moves ====================
+
+// What "= default" would do, plus rehashing other: its name was moved out,
+// so the hash it cached no longer describes it
+NameTag::NameTag(NameTag&& other) noexcept
+    : id_(other.id_),
+      hash_(other.hash_),
+      name_(std::move(other.name_)),
+      company_(other.company_),
+      counted_(std::move(other.counted_)) {
+    other.rehash();
+}
+
+NameTag& NameTag::operator=(NameTag&& other) noexcept {
+    id_ = other.id_;
+    hash_ = other.hash_;
+    name_ = std::move(other.name_);
+    company_ = other.company_;
+    counted_ = std::move(other.counted_);
+    other.rehash(); // for a self-move, this is our own (unchanged) hash again
+    return *this;
+}
+
+// ==================== Equality, ordering and hashing ====================
+
+// The company is hashed by its CompanyId: equal names are always interned to
+// the same id, so that is as good as hashing the name, and much cheaper
+void NameTag::rehash() noexcept {
+    std::uint64_t seed = hashCombine(0, static_cast<std::uint64_t>(id_));
+    seed = hashCombine(seed, std::string_view(name_));
+    seed = hashCombine(seed, company_.value());
+    hash_ = foldHash(seed);
+}
+
+// Cheapest checks first: the hash and id are integers, and CompanyIds are
+// equal exactly when the company names are. Only then compare the name.
+bool NameTag::operator==(const NameTag& other) const {
+    return hash_ == other.hash_ && id_ == other.id_ && company_ == other.company_ && name_ == other.name_;
+}
+
+// Each "<=>" returns less, equal or greater; the first one that isn't
+// equal decides
+std::strong_ordering NameTag::operator<=>(const NameTag& other) const {
+    if (const auto order = id_ <=> other.id_; order != 0) {
+        return order;
+    }
+    if (const auto order = name_ <=> other.name_; order != 0) {
+        return order;
+    }
+    if (company_ == other.company_) {
+        return std::strong_ordering::equal;
+    }
+    return company_.str() <=> other.company_.str();
+}
+
+// Returns the hash cached by the last constructor or setter
+std::uint32_t NameTag::hash() const { return hash_; }
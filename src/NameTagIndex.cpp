@@ -0,0 +1,213 @@
+// Include the NameTagIndex class declaration
+#include "NameTagIndex.h"
+
+// algorithm for std::find
+#include <algorithm>
+// stdexcept for std::invalid_argument
+#include <stdexcept>
+// utility for std::move and std::pair
+#include <utility>
+
+namespace {
+
+using WriteLock = std::unique_lock<std::shared_mutex>;
+
+// Locks two shards of the same array for writing. Lower addresses (lower
+// shard numbers) are always locked first, so two writers can never each hold
+// the shard the other is waiting for. The same shard is only locked once.
+template <typename Shard>
+std::pair<WriteLock, WriteLock> lockBoth(Shard& a, Shard& b) {
+    if (&a == &b) {
+        return {WriteLock(a.mutex), WriteLock()};
+    }
+    Shard& first = &a < &b ? a : b;
+    Shard& second = &a < &b ? b : a;
+    WriteLock firstLock(first.mutex);
+    WriteLock secondLock(second.mutex);
+    return {std::move(firstLock), std::move(secondLock)};
+}
+
+[[noreturn]] void throwUnknownId() {
+    throw std::invalid_argument("NameTagIndex has no tag with this id");
+}
+
+} // namespace
+
+// Lock order everywhere below: id shards (lowest first), then name shards
+// (lowest first). Readers only ever hold one lock.
+
+void NameTagIndex::insert(NameTag tag) {
+    const int id = tag.getId();
+    IdShard& shard = idShard(id);
+    WriteLock idLock(shard.mutex);
+    if (shard.tags.count(id) != 0) {
+        throw std::invalid_argument("NameTagIndex already has a tag with this id");
+    }
+
+    const NameKeyView key{tag.getName(), tag.getCompanyId()};
+    NameShard& names = nameShard(key);
+    WriteLock nameLock(names.mutex);
+    auto entry = names.ids.find(key);
+    if (entry == names.ids.end()) {
+        entry = names.ids.emplace(NameKey{tag.getName(), tag.getCompanyId()}, std::vector<int>{}).first;
+    }
+    entry->second.push_back(id);
+    try {
+        shard.tags.emplace(id, std::move(tag));
+    } catch (...) {
+        entry->second.pop_back();
+        if (entry->second.empty()) {
+            names.ids.erase(entry);
+        }
+        throw;
+    }
+}
+
+bool NameTagIndex::erase(int id) {
+    IdShard& shard = idShard(id);
+    WriteLock idLock(shard.mutex);
+    const auto found = shard.tags.find(id);
+    if (found == shard.tags.end()) {
+        return false;
+    }
+
+    const NameKeyView key{found->second.getName(), found->second.getCompanyId()};
+    NameShard& names = nameShard(key);
+    WriteLock nameLock(names.mutex);
+    const auto entry = names.ids.find(key);
+    std::vector<int>& ids = entry->second;
+    ids.erase(std::find(ids.begin(), ids.end(), id));
+    if (ids.empty()) {
+        names.ids.erase(entry);
+    }
+    shard.tags.erase(found);
+    return true;
+}
+
+std::optional<NameTag> NameTagIndex::findById(int id) const {
+    std::optional<NameTag> copy;
+    visitById(id, [&copy](const NameTag& tag) { copy.emplace(tag); });
+    return copy;
+}
+
+bool NameTagIndex::contains(int id) const {
+    const IdShard& shard = idShard(id);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.tags.count(id) != 0;
+}
+
+std::vector<int> NameTagIndex::idsByName(std::string_view name, std::string_view company) const {
+    std::vector<int> ids;
+    forEachIdByName(name, company, [&ids](int id) { ids.push_back(id); });
+    return ids;
+}
+
+std::size_t NameTagIndex::countByName(std::string_view name, std::string_view company) const {
+    return forEachIdByName(name, company, [](int) {});
+}
+
+void NameTagIndex::setId(int id, int newId) {
+    IdShard& from = idShard(id);
+    IdShard& to = idShard(newId);
+    auto idLocks = lockBoth(from, to);
+
+    const auto found = from.tags.find(id);
+    if (found == from.tags.end()) {
+        throwUnknownId();
+    }
+    if (id == newId) {
+        return;
+    }
+    if (to.tags.count(newId) != 0) {
+        throw std::invalid_argument("NameTagIndex already has a tag with this id");
+    }
+    NameTag updated = found->second;
+    updated.setId(newId); // validates
+
+    const NameKeyView key{found->second.getName(), found->second.getCompanyId()};
+    NameShard& names = nameShard(key);
+    WriteLock nameLock(names.mutex);
+    to.tags.emplace(newId, std::move(updated)); // the only step that can throw
+    reidKey(key, id, newId);
+    // Erase by key, not through found: when both ids share a shard, the
+    // emplace above may have rehashed that map and invalidated found
+    // (the node itself, and so key, stays where it is)
+    from.tags.erase(id);
+}
+
+void NameTagIndex::setName(int id, std::string name) {
+    IdShard& shard = idShard(id);
+    WriteLock idLock(shard.mutex);
+    const auto found = shard.tags.find(id);
+    if (found == shard.tags.end()) {
+        throwUnknownId();
+    }
+    NameTag updated = found->second;
+    updated.setName(std::move(name)); // validates
+
+    const NameKeyView from{found->second.getName(), found->second.getCompanyId()};
+    const NameKeyView to{updated.getName(), updated.getCompanyId()};
+    auto nameLocks = lockBoth(nameShard(from), nameShard(to));
+    renameKey(id, from, to);
+    found->second = std::move(updated);
+}
+
+void NameTagIndex::setCompany(int id, std::string_view company) {
+    IdShard& shard = idShard(id);
+    WriteLock idLock(shard.mutex);
+    const auto found = shard.tags.find(id);
+    if (found == shard.tags.end()) {
+        throwUnknownId();
+    }
+    NameTag updated = found->second;
+    updated.setCompany(company); // validates and interns
+
+    const NameKeyView from{found->second.getName(), found->second.getCompanyId()};
+    const NameKeyView to{updated.getName(), updated.getCompanyId()};
+    auto nameLocks = lockBoth(nameShard(from), nameShard(to));
+    renameKey(id, from, to);
+    found->second = std::move(updated);
+}
+
+std::size_t NameTagIndex::size() const {
+    std::size_t total = 0;
+    for (const IdShard& shard : idShards_) {
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        total += shard.tags.size();
+    }
+    return total;
+}
+
+// Adds id under the new key first (the only step that can throw), then
+// removes it from the old one
+void NameTagIndex::renameKey(int id, const NameKeyView& from, const NameKeyView& to) {
+    if (NameKeyEqual{}(from, to)) {
+        return;
+    }
+    NameShard& toShard = nameShard(to);
+    auto entry = toShard.ids.find(to);
+    if (entry == toShard.ids.end()) {
+        entry = toShard.ids.emplace(NameKey{std::string(to.name), to.company}, std::vector<int>{}).first;
+    }
+    try {
+        entry->second.push_back(id);
+    } catch (...) {
+        if (entry->second.empty()) {
+            toShard.ids.erase(entry);
+        }
+        throw;
+    }
+
+    NameShard& fromShard = nameShard(from);
+    const auto old = fromShard.ids.find(from);
+    std::vector<int>& ids = old->second;
+    ids.erase(std::find(ids.begin(), ids.end(), id));
+    if (ids.empty()) {
+        fromShard.ids.erase(old);
+    }
+}
+
+void NameTagIndex::reidKey(const NameKeyView& key, int id, int newId) {
+    std::vector<int>& ids = nameShard(key).ids.find(key)->second;
+    *std::find(ids.begin(), ids.end(), id) = newId;
+}
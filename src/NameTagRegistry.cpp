@@ -0,0 +1,175 @@
+// Include the NameTagRegistry class declaration
+#include "NameTagRegistry.h"
+
+// stdexcept for std::invalid_argument and std::out_of_range
+#include <stdexcept>
+// string_view for the row checks
+#include <string_view>
+// utility for std::move
+#include <utility>
+
+// Builds an owning NameTag (runs NameTag's constructor, including its log line)
+NameTag NameTagView::toNameTag() const {
+    return NameTag(id, std::string(name), company);
+}
+
+namespace {
+
+// NameTag's rules, with NameTag's messages
+void validateRow(int id, std::string_view name, std::string_view company) {
+    if (id <= 0) {
+        throw std::invalid_argument("NameTag id must be positive");
+    }
+    if (name.empty()) {
+        throw std::invalid_argument("NameTag name must not be empty");
+    }
+    if (company.empty()) {
+        throw std::invalid_argument("NameTag company must not be empty");
+    }
+}
+
+// Makes room for one more element, growing geometrically like push_back would
+template <typename T>
+void reserveOneMore(std::vector<T>& column) {
+    if (column.size() == column.capacity()) {
+        column.reserve(column.empty() ? 8 : 2 * column.size());
+    }
+}
+
+} // namespace
+
+// Validates with NameTag's rules, then appends one value to every column
+std::size_t NameTagRegistry::add(int id, const std::string& name, const std::string& company) {
+    validateRow(id, name, company);
+    return appendRow(id, name, CompanyTable::intern(company));
+}
+
+// A moved-from NameTag has no name, so it is checked like any other row
+std::size_t NameTagRegistry::add(const NameTag& tag) {
+    validateRow(tag.getId(), tag.getName(), tag.getCompany());
+    return appendRow(tag.getId(), tag.getName(), tag.getCompanyId());
+}
+
+// Everything that can throw (copying the name, growing a column) happens
+// before the first push_back, so the columns never end up different lengths
+std::size_t NameTagRegistry::appendRow(int id, const std::string& name, CompanyId company) {
+    std::string nameCopy(name);
+    reserveOneMore(ids_);
+    reserveOneMore(names_);
+    reserveOneMore(companies_);
+    ids_.push_back(id);
+    names_.push_back(std::move(nameCopy));
+    companies_.push_back(company);
+    return ids_.size() - 1;
+}
+
+// Swap-and-pop: move the last row into the hole, then shrink every column
+void NameTagRegistry::removeAt(std::size_t row) {
+    if (row >= size()) {
+        throw std::out_of_range("NameTagRegistry row out of range");
+    }
+    const std::size_t last = size() - 1;
+    if (row != last) {
+        ids_[row] = ids_[last];
+        names_[row] = std::move(names_[last]);
+        companies_[row] = companies_[last];
+    }
+    ids_.pop_back();
+    names_.pop_back();
+    companies_.pop_back();
+}
+
+// Finds the row with a column scan, then removes it
+bool NameTagRegistry::removeById(int id) {
+    for (std::size_t row = 0; row < ids_.size(); ++row) {
+        if (ids_[row] == id) {
+            removeAt(row);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Only the id column is touched until a match is found
+std::optional<NameTagView> NameTagRegistry::findById(int id) const {
+    for (std::size_t row = 0; row < ids_.size(); ++row) {
+        if (ids_[row] == id) {
+            return at(row);
+        }
+    }
+    return std::nullopt;
+}
+
+// Gathers one row from every column
+NameTagView NameTagRegistry::at(std::size_t row) const {
+    return NameTagView{ids_[row], names_[row], companies_[row].str()};
+}
+
+// Number of rows
+std::size_t NameTagRegistry::size() const { return ids_.size(); }
+
+// True when there are no rows
+bool NameTagRegistry::empty() const { return ids_.empty(); }
+
+// Reserves room in every column
+void NameTagRegistry::reserve(std::size_t rows) {
+    ids_.reserve(rows);
+    names_.reserve(rows);
+    companies_.reserve(rows);
+}
+
+// Removes every row
+void NameTagRegistry::clear() {
+    ids_.clear();
+    names_.clear();
+    companies_.clear();
+}
+
+// Scans only the id column
+std::vector<std::size_t> NameTagRegistry::rowsWithIdInRange(int minId, int maxId) const {
+    std::vector<std::size_t> rows;
+    for (std::size_t row = 0; row < ids_.size(); ++row) {
+        if (ids_[row] >= minId && ids_[row] <= maxId) {
+            rows.push_back(row);
+        }
+    }
+    return rows;
+}
+
+// Branch-free count so the compiler can vectorize the loop
+std::size_t NameTagRegistry::countIdInRange(int minId, int maxId) const {
+    std::size_t count = 0;
+    for (int id : ids_) {
+        count += static_cast<std::size_t>(id >= minId && id <= maxId);
+    }
+    return count;
+}
+
+// One table lookup, then an integer scan of the company column
+std::vector<std::size_t> NameTagRegistry::rowsWithCompany(std::string_view company) const {
+    std::vector<std::size_t> rows;
+    // A company that was never interned can't be in any row
+    const std::optional<CompanyId> wanted = CompanyTable::find(company);
+    if (!wanted) {
+        return rows;
+    }
+    for (std::size_t row = 0; row < companies_.size(); ++row) {
+        if (companies_[row] == *wanted) {
+            rows.push_back(row);
+        }
+    }
+    return rows;
+}
+
+// Same as rowsWithCompany, but only counts
+std::size_t NameTagRegistry::countCompany(std::string_view company) const {
+    const std::optional<CompanyId> wanted = CompanyTable::find(company);
+    if (!wanted) {
+        return 0;
+    }
+    std::size_t count = 0;
+    for (CompanyId rowCompany : companies_) {
+        count += static_cast<std::size_t>(rowCompany == *wanted);
+    }
+    return count;
+}
@@ -0,0 +1,283 @@
+// Include the PMR tag declarations
+#include "PmrTags.h"
+// Include the allocation-free formatting helpers
+#include "FormatUtil.h"
+
+// iostream for std::cout in print()
+#include <iostream>
+// utility for std::exchange, std::forward and std::move
+#include <utility>
+
+// ==================== PmrBio ====================
+
+PmrBio::PmrBio(allocator_type alloc) : name(alloc), title(alloc), department(alloc) {}
+
+PmrBio::PmrBio(std::string_view name, std::string_view title, std::string_view department, int year,
+               allocator_type alloc)
+    : name(name, alloc),
+      title(title, alloc),
+      department(department, alloc),
+      year(year) {}
+
+PmrBio::PmrBio(const Bio& bio, allocator_type alloc)
+    : PmrBio(bio.name, bio.title, bio.department, bio.year, alloc) {}
+
+PmrBio::PmrBio(const PmrBio& other, allocator_type alloc)
+    : name(other.name, alloc),
+      title(other.title, alloc),
+      department(other.department, alloc),
+      year(other.year) {}
+
+// std::pmr::string's allocator-extended move steals the buffer when both
+// resources are the same and copies it otherwise
+PmrBio::PmrBio(PmrBio&& other, allocator_type alloc)
+    : name(std::move(other.name), alloc),
+      title(std::move(other.title), alloc),
+      department(std::move(other.department), alloc),
+      year(other.year) {}
+
+Bio PmrBio::toBio() const {
+    return Bio{std::string(name), std::string(title), std::string(department), year};
+}
+
+// Same format as Bio::print(): name, title, department, year
+void PmrBio::print() const {
+    std::cout << name
+              << ", "
+              << title
+              << ", "
+              << department
+              << ", "
+              << year;
+}
+
+// Same text as print(), appended to a caller-owned buffer
+void PmrBio::appendTo(std::string& out) const {
+    out.append(name);
+    out.append(", ");
+    out.append(title);
+    out.append(", ");
+    out.append(department);
+    out.append(", ");
+    appendInt(out, year);
+}
+
+// ==================== PmrNameTag ====================
+
+// The company is interned last, like NameTag's: a rejected tag must not
+// leave a name in the never-freed CompanyTable
+PmrNameTag::PmrNameTag(int id, std::string_view name, std::string_view company, allocator_type alloc)
+    : id_(id),
+      name_(name, alloc) {
+    if (id_ <= 0) {
+        throw std::invalid_argument("PmrNameTag id must be positive");
+    }
+    if (name_.empty()) {
+        throw std::invalid_argument("PmrNameTag name must not be empty");
+    }
+    if (company.empty()) {
+        throw std::invalid_argument("PmrNameTag company must not be empty");
+    }
+    company_ = CompanyTable::intern(company);
+}
+
+PmrNameTag::PmrNameTag(const PmrNameTag& other, allocator_type alloc)
+    : id_(other.id_),
+      name_(other.name_, alloc),
+      company_(other.company_) {}
+
+PmrNameTag::PmrNameTag(PmrNameTag&& other, allocator_type alloc)
+    : id_(other.id_),
+      name_(std::move(other.name_), alloc),
+      company_(other.company_) {}
+
+void PmrNameTag::setId(int id) {
+    if (id <= 0) {
+        throw std::invalid_argument("PmrNameTag id must be positive");
+    }
+    id_ = id;
+}
+
+// Assigning reuses name_'s buffer (and resource) when it is big enough
+void PmrNameTag::setName(std::string_view name) {
+    if (name.empty()) {
+        throw std::invalid_argument("PmrNameTag name must not be empty");
+    }
+    name_ = name;
+}
+
+void PmrNameTag::setCompany(std::string_view company) {
+    if (company.empty()) {
+        throw std::invalid_argument("PmrNameTag company must not be empty");
+    }
+    company_ = CompanyTable::intern(company);
+}
+
+// ==================== PmrFancyNameTag ====================
+
+namespace {
+
+// The FancyNameTag Bio rules, for Bio and PmrBio alike
+template <typename AnyBio>
+void validateBio(const AnyBio& bio) {
+    if (bio.name.empty()) {
+        throw std::invalid_argument("PmrFancyNameTag bio name must not be empty");
+    }
+    if (bio.title.empty()) {
+        throw std::invalid_argument("PmrFancyNameTag bio title must not be empty");
+    }
+    if (bio.year <= 0) {
+        throw std::invalid_argument("PmrFancyNameTag bio year must be positive");
+    }
+}
+
+} // namespace
+
+PmrFancyNameTag::PmrFancyNameTag(int id, std::string_view company, const Bio& bio, allocator_type alloc)
+    : id_(id),
+      alloc_(alloc) {
+    construct(company, bio);
+}
+
+PmrFancyNameTag::PmrFancyNameTag(int id, std::string_view company, const PmrBio& bio, allocator_type alloc)
+    : id_(id),
+      alloc_(alloc) {
+    construct(company, bio);
+}
+
+PmrFancyNameTag::PmrFancyNameTag(int id, std::string_view company, PmrBio&& bio, allocator_type alloc)
+    : id_(id),
+      alloc_(alloc) {
+    construct(company, std::move(bio));
+}
+
+// Validates everything before interning the company (never freed) or
+// allocating the Bio.
+// new_object() allocates room for a PmrBio from the resource and constructs
+// it there with the allocator passed along as the last argument, so the
+// Bio's strings come from the same resource as the Bio itself
+template <typename BioArg>
+void PmrFancyNameTag::construct(std::string_view company, BioArg&& bio) {
+    if (id_ <= 0) {
+        throw std::invalid_argument("PmrFancyNameTag id must be positive");
+    }
+    if (company.empty()) {
+        throw std::invalid_argument("PmrFancyNameTag company must not be empty");
+    }
+    validateBio(bio);
+    company_ = CompanyTable::intern(company);
+    bio_ = alloc_.new_object<PmrBio>(std::forward<BioArg>(bio));
+}
+
+PmrBio* PmrFancyNameTag::copyBio(const PmrBio* bio) const {
+    if (!bio) {
+        return nullptr;
+    }
+    // new_object() isn't const, but the allocator is only a resource pointer,
+    // so a copy of it allocates from the same place
+    allocator_type alloc = alloc_;
+    return alloc.new_object<PmrBio>(*bio);
+}
+
+void PmrFancyNameTag::destroyBio() noexcept {
+    if (bio_) {
+        alloc_.delete_object(std::exchange(bio_, nullptr));
+    }
+}
+
+PmrFancyNameTag::~PmrFancyNameTag() {
+    destroyBio();
+}
+
+// Copy: the Bio is copied into alloc's resource (the default resource
+// unless one is given), never shared with other
+PmrFancyNameTag::PmrFancyNameTag(const PmrFancyNameTag& other, allocator_type alloc)
+    : id_(other.id_),
+      company_(other.company_),
+      alloc_(alloc) {
+    bio_ = copyBio(other.bio_);
+}
+
+// Move: same resource, so the Bio pointer is simply taken over
+PmrFancyNameTag::PmrFancyNameTag(PmrFancyNameTag&& other) noexcept
+    : id_(other.id_),
+      company_(other.company_),
+      bio_(std::exchange(other.bio_, nullptr)),
+      alloc_(other.alloc_) {}
+
+// Move into a given resource: a Bio from another resource can't be taken
+// over (it would be freed to the wrong one), so it is copied instead
+PmrFancyNameTag::PmrFancyNameTag(PmrFancyNameTag&& other, allocator_type alloc)
+    : id_(other.id_),
+      company_(other.company_),
+      alloc_(alloc) {
+    if (alloc_ == other.alloc_) {
+        bio_ = std::exchange(other.bio_, nullptr);
+    } else {
+        bio_ = copyBio(other.bio_);
+    }
+}
+
+// Copy the Bio into OUR resource first, so a failed allocation changes nothing
+PmrFancyNameTag& PmrFancyNameTag::operator=(const PmrFancyNameTag& other) {
+    if (this != &other) {
+        PmrBio* replacement = copyBio(other.bio_);
+        destroyBio();
+        bio_ = replacement;
+        id_ = other.id_;
+        company_ = other.company_;
+    }
+    return *this;
+}
+
+// Take the pointer over only when both tags use the same resource
+PmrFancyNameTag& PmrFancyNameTag::operator=(PmrFancyNameTag&& other) {
+    if (this != &other) {
+        PmrBio* replacement = alloc_ == other.alloc_ ? std::exchange(other.bio_, nullptr) : copyBio(other.bio_);
+        destroyBio();
+        bio_ = replacement;
+        id_ = other.id_;
+        company_ = other.company_;
+    }
+    return *this;
+}
+
+const PmrBio& PmrFancyNameTag::getBio() const {
+    if (!bio_) {
+        throw std::logic_error("PmrFancyNameTag has no bio (it was moved from)");
+    }
+    return *bio_;
+}
+
+void PmrFancyNameTag::setId(int id) {
+    if (id <= 0) {
+        throw std::invalid_argument("PmrFancyNameTag id must be positive");
+    }
+    id_ = id;
+}
+
+void PmrFancyNameTag::setCompany(std::string_view company) {
+    if (company.empty()) {
+        throw std::invalid_argument("PmrFancyNameTag company must not be empty");
+    }
+    company_ = CompanyTable::intern(company);
+}
+
+// Builds the new Bio (in our resource) before freeing the old one
+void PmrFancyNameTag::setBio(const Bio& bio) {
+    validateBio(bio);
+    PmrBio* replacement = alloc_.new_object<PmrBio>(bio);
+    destroyBio();
+    bio_ = replacement;
+}
+
+// The title's new characters come from the Bio's (our) resource
+void PmrFancyNameTag::setBioTitle(std::string_view title) {
+    if (title.empty()) {
+        throw std::invalid_argument("PmrFancyNameTag bio title must not be empty");
+    }
+    if (!bio_) {
+        throw std::logic_error("PmrFancyNameTag has no bio (it was moved from)");
+    }
+    bio_->title = title;
+}
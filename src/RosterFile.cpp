@@ -0,0 +1,328 @@
+// Include the roster file declarations
+#include "RosterFile.h"
+
+// bit for std::endian (the format is little-endian)
+#include <bit>
+// cstring for std::memcpy and std::memcmp
+#include <cstring>
+// fstream for writing the file (and reading it where mmap isn't available)
+#include <fstream>
+// limits for the 32-bit string table limit
+#include <limits>
+// stdexcept for std::runtime_error
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define NAMETAG_HAVE_MMAP 1
+// POSIX headers for open/fstat/mmap
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define NAMETAG_HAVE_MMAP 0
+#endif
+
+// Records and lengths are written in memory order, which is only the file's
+// byte order on little-endian machines (x86-64, ARM64)
+static_assert(std::endian::native == std::endian::little, "roster files are little-endian");
+
+namespace {
+
+constexpr char kMagic[8] = {'N', 'T', 'R', 'O', 'S', 'T', 'E', 'R'};
+
+// Rounds up to the next multiple of 8 (section alignment)
+std::uint64_t align8(std::uint64_t offset) {
+    return (offset + 7) & ~std::uint64_t{7};
+}
+
+// Reads a T stored at p. The file gives no alignment guarantee for the
+// string table, and memcpy compiles down to a plain load either way.
+template <typename T>
+T load(const char* p) {
+    T value;
+    std::memcpy(&value, p, sizeof(T));
+    return value;
+}
+
+} // namespace
+
+// ==================== Views ====================
+
+// Copies the viewed strings into an owning Bio
+Bio FancyNameTagView::toBio() const {
+    return Bio{std::string(name), std::string(title), std::string(department), year};
+}
+
+// The Bio is built once and moved in (FancyNameTag's Bio&& constructor)
+FancyNameTag FancyNameTagView::toFancyNameTag(BioAlloc alloc) const {
+    return FancyNameTag(id, company, toBio(), alloc);
+}
+
+// ==================== Writer ====================
+
+// Stores one NameTag: its name is appended, its company de-duplicated
+void RosterWriter::add(const NameTag& tag) {
+    nameTags_.push_back(NameTagRecord{tag.getId(), appendString(tag.getName()), internString(tag.getCompany())});
+}
+
+void RosterWriter::add(const NameTagView& tag) {
+    nameTags_.push_back(NameTagRecord{tag.id, appendString(tag.name), internString(tag.company)});
+}
+
+// Stores one FancyNameTag. A moved-from tag has no Bio to store.
+void RosterWriter::add(const FancyNameTag& tag) {
+    if (tag.getBioUseCount() == 0) {
+        throw std::invalid_argument("RosterWriter can't store a moved-from FancyNameTag");
+    }
+    const Bio& bio = tag.getBio();
+    add(FancyNameTagView{tag.getId(), tag.getCompany(), bio.name, bio.title, bio.department, bio.year});
+}
+
+void RosterWriter::add(const FancyNameTagView& tag) {
+    FancyNameTagRecord record{};
+    record.id = tag.id;
+    record.company = internString(tag.company);
+    record.name = appendString(tag.name);
+    record.title = internString(tag.title);
+    record.department = internString(tag.department);
+    record.year = tag.year;
+    fancy_.push_back(record);
+}
+
+// Appends [u32 length][bytes] and returns where it starts
+std::uint32_t RosterWriter::appendString(std::string_view s) {
+    const std::size_t offset = strings_.size();
+    if (offset + sizeof(std::uint32_t) + s.size() > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::length_error("RosterWriter string table is full (4 GiB)");
+    }
+    const auto length = static_cast<std::uint32_t>(s.size());
+    const char* lengthBytes = reinterpret_cast<const char*>(&length);
+    strings_.insert(strings_.end(), lengthBytes, lengthBytes + sizeof(length));
+    strings_.insert(strings_.end(), s.begin(), s.end());
+    return static_cast<std::uint32_t>(offset);
+}
+
+// Looks s up before appending it, so repeated strings are stored once
+std::uint32_t RosterWriter::internString(std::string_view s) {
+    const auto found = interned_.find(std::string(s));
+    if (found != interned_.end()) {
+        return found->second;
+    }
+    const std::uint32_t offset = appendString(s);
+    interned_.emplace(std::string(s), offset);
+    return offset;
+}
+
+// Header, padding, both record arrays, padding, string table
+void RosterWriter::write(const std::string& path) const {
+    RosterHeader header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kRosterVersion;
+    header.headerSize = sizeof(RosterHeader);
+    header.nameTagCount = nameTags_.size();
+    header.fancyCount = fancy_.size();
+    header.nameTagOffset = sizeof(RosterHeader);
+    header.fancyOffset = align8(header.nameTagOffset + nameTags_.size() * sizeof(NameTagRecord));
+    header.stringsOffset = align8(header.fancyOffset + fancy_.size() * sizeof(FancyNameTagRecord));
+    header.stringsSize = strings_.size();
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("RosterWriter could not open " + path);
+    }
+    const auto writeBytes = [&out](const void* data, std::size_t bytes) {
+        out.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+    };
+    const auto padTo = [&out, &writeBytes](std::uint64_t offset) {
+        static constexpr char kZeros[8] = {};
+        writeBytes(kZeros, offset - static_cast<std::uint64_t>(out.tellp()));
+    };
+    writeBytes(&header, sizeof(header));
+    writeBytes(nameTags_.data(), nameTags_.size() * sizeof(NameTagRecord));
+    padTo(header.fancyOffset);
+    writeBytes(fancy_.data(), fancy_.size() * sizeof(FancyNameTagRecord));
+    padTo(header.stringsOffset);
+    writeBytes(strings_.data(), strings_.size());
+    if (!out.flush()) {
+        throw std::runtime_error("RosterWriter could not write " + path);
+    }
+}
+
+// Adds every tag to a writer and writes the file
+void writeRoster(const std::string& path,
+                 std::span<const NameTag> nameTags,
+                 std::span<const FancyNameTag> fancyTags) {
+    RosterWriter writer;
+    for (const NameTag& tag : nameTags) {
+        writer.add(tag);
+    }
+    for (const FancyNameTag& tag : fancyTags) {
+        writer.add(tag);
+    }
+    writer.write(path);
+}
+
+// ==================== Loader ====================
+
+// Maps the file, then checks the header and section bounds
+RosterFile::RosterFile(const std::string& path) {
+#if NAMETAG_HAVE_MMAP
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("RosterFile could not open " + path);
+    }
+    struct stat info {};
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        throw std::runtime_error("RosterFile could not read the size of " + path);
+    }
+    size_ = static_cast<std::size_t>(info.st_size);
+    if (size_ > 0) {
+        void* mapping = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            ::close(fd);
+            throw std::runtime_error("RosterFile could not map " + path);
+        }
+        data_ = static_cast<const char*>(mapping);
+        mapped_ = true;
+    }
+    // The mapping stays valid after the descriptor is closed
+    ::close(fd);
+#else
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+        throw std::runtime_error("RosterFile could not open " + path);
+    }
+    size_ = static_cast<std::size_t>(in.tellg());
+    char* copy = new char[size_ > 0 ? size_ : 1];
+    in.seekg(0);
+    in.read(copy, static_cast<std::streamsize>(size_));
+    data_ = copy;
+#endif
+
+    try {
+        if (size_ < sizeof(RosterHeader)) {
+            throw std::runtime_error("not a roster file (too short): " + path);
+        }
+        const auto header = load<RosterHeader>(data_);
+        if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) {
+            throw std::runtime_error("not a roster file: " + path);
+        }
+        if (header.version != kRosterVersion || header.headerSize != sizeof(RosterHeader)) {
+            throw std::runtime_error("unsupported roster file version: " + path);
+        }
+        // Every section must fit in the file. Sizes are checked by dividing
+        // (not multiplying) so a huge count can't overflow.
+        const auto fits = [this](std::uint64_t offset, std::uint64_t count, std::uint64_t itemSize) {
+            return offset <= size_ && count <= (size_ - offset) / itemSize;
+        };
+        if (!fits(header.nameTagOffset, header.nameTagCount, sizeof(NameTagRecord)) ||
+            !fits(header.fancyOffset, header.fancyCount, sizeof(FancyNameTagRecord)) ||
+            !fits(header.stringsOffset, header.stringsSize, 1)) {
+            throw std::runtime_error("truncated roster file: " + path);
+        }
+        nameTagCount_ = static_cast<std::size_t>(header.nameTagCount);
+        fancyCount_ = static_cast<std::size_t>(header.fancyCount);
+        nameTags_ = data_ + header.nameTagOffset;
+        fancy_ = data_ + header.fancyOffset;
+        strings_ = data_ + header.stringsOffset;
+        stringsSize_ = static_cast<std::size_t>(header.stringsSize);
+    } catch (...) {
+        unmap();
+        throw;
+    }
+}
+
+RosterFile::~RosterFile() {
+    unmap();
+}
+
+// Takes over other's mapping; other is left empty
+RosterFile::RosterFile(RosterFile&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      mapped_(std::exchange(other.mapped_, false)),
+      nameTagCount_(std::exchange(other.nameTagCount_, 0)),
+      fancyCount_(std::exchange(other.fancyCount_, 0)),
+      nameTags_(std::exchange(other.nameTags_, nullptr)),
+      fancy_(std::exchange(other.fancy_, nullptr)),
+      strings_(std::exchange(other.strings_, nullptr)),
+      stringsSize_(std::exchange(other.stringsSize_, 0)) {}
+
+RosterFile& RosterFile::operator=(RosterFile&& other) noexcept {
+    if (this != &other) {
+        unmap();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        mapped_ = std::exchange(other.mapped_, false);
+        nameTagCount_ = std::exchange(other.nameTagCount_, 0);
+        fancyCount_ = std::exchange(other.fancyCount_, 0);
+        nameTags_ = std::exchange(other.nameTags_, nullptr);
+        fancy_ = std::exchange(other.fancy_, nullptr);
+        strings_ = std::exchange(other.strings_, nullptr);
+        stringsSize_ = std::exchange(other.stringsSize_, 0);
+    }
+    return *this;
+}
+
+// Releases the mapping (or the heap copy)
+void RosterFile::unmap() noexcept {
+    if (data_ == nullptr) {
+        return;
+    }
+#if NAMETAG_HAVE_MMAP
+    if (mapped_) {
+        ::munmap(const_cast<char*>(data_), size_);
+    }
+#else
+    delete[] data_;
+#endif
+    data_ = nullptr;
+    size_ = 0;
+    mapped_ = false;
+}
+
+// Resolves a string reference, checking it against the string table
+std::string_view RosterFile::stringAt(std::uint32_t offset) const {
+    if (offset > stringsSize_ || stringsSize_ - offset < sizeof(std::uint32_t)) {
+        throw std::runtime_error("roster string reference out of range");
+    }
+    const auto length = load<std::uint32_t>(strings_ + offset);
+    if (length > stringsSize_ - offset - sizeof(std::uint32_t)) {
+        throw std::runtime_error("roster string reference out of range");
+    }
+    return std::string_view(strings_ + offset + sizeof(std::uint32_t), length);
+}
+
+NameTagView RosterFile::nameTag(std::size_t index) const {
+    const auto record = load<NameTagRecord>(nameTags_ + index * sizeof(NameTagRecord));
+    return NameTagView{record.id, stringAt(record.name), stringAt(record.company)};
+}
+
+FancyNameTagView RosterFile::fancyNameTag(std::size_t index) const {
+    const auto record = load<FancyNameTagRecord>(fancy_ + index * sizeof(FancyNameTagRecord));
+    return FancyNameTagView{record.id,
+                            stringAt(record.company),
+                            stringAt(record.name),
+                            stringAt(record.title),
+                            stringAt(record.department),
+                            record.year};
+}
+
+// ==================== Lazy tags ====================
+
+// Builds the owning tag from the view the first time it's needed
+FancyNameTag& LazyFancyNameTag::promote(BioAlloc alloc) {
+    if (!tag_) {
+        tag_.emplace(view_.id, view_.company, view_.toBio(), alloc);
+    }
+    return *tag_;
+}
+
+NameTag& LazyNameTag::promote() {
+    if (!tag_) {
+        tag_.emplace(view_.id, std::string(view_.name), view_.company);
+    }
+    return *tag_;
+}
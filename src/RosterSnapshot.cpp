@@ -0,0 +1,106 @@
+// Include the snapshot declarations
+#include "RosterSnapshot.h"
+
+// algorithm for std::max
+#include <algorithm>
+// memory for std::allocator and std::destroy
+#include <memory>
+// mutex for the list of blocks
+#include <mutex>
+// new for placement new
+#include <new>
+// stdexcept for std::logic_error
+#include <stdexcept>
+// utility for std::exchange
+#include <utility>
+
+const Bio& SnapshotTag::getBio() const {
+    if (!bio) {
+        throw std::logic_error("SnapshotTag has no bio (the original was moved from)");
+    }
+    return *bio;
+}
+
+FancyNameTag SnapshotTag::toFancyNameTag(BioAlloc alloc) const {
+    return FancyNameTag(id, company.str(), getBio(), alloc);
+}
+
+FancyNameTagSnapshot::~FancyNameTagSnapshot() {
+    release();
+}
+
+FancyNameTagSnapshot::FancyNameTagSnapshot(FancyNameTagSnapshot&& other) noexcept
+    : tags_(std::exchange(other.tags_, {})),
+      blocks_(std::exchange(other.blocks_, {})) {}
+
+FancyNameTagSnapshot& FancyNameTagSnapshot::operator=(FancyNameTagSnapshot&& other) noexcept {
+    if (this != &other) {
+        release();
+        tags_ = std::exchange(other.tags_, {});
+        blocks_ = std::exchange(other.blocks_, {});
+    }
+    return *this;
+}
+
+void FancyNameTagSnapshot::release() noexcept {
+    std::allocator<Bio> storage;
+    for (const BioBlock& block : blocks_) {
+        std::destroy(block.bios, block.bios + block.count);
+        storage.deallocate(block.bios, block.count);
+    }
+    blocks_.clear();
+    tags_.clear();
+}
+
+FancyNameTagSnapshot parallelSnapshot(std::span<const FancyNameTag> tags, WorkStealingPool& pool,
+                                      std::size_t grain) {
+    FancyNameTagSnapshot snapshot;
+    if (tags.empty()) {
+        return snapshot;
+    }
+    if (grain == 0) {
+        grain = std::max<std::size_t>(tags.size() / (pool.size() * 4), 1);
+    }
+
+    // Every range writes only its own entries, so they can be filled in any order
+    snapshot.tags_.resize(tags.size());
+    // Halving never leaves a range shorter than grain / 2, so this is enough
+    // room for every block and push_back below can't throw
+    snapshot.blocks_.reserve((tags.size() / grain + 1) * 2);
+    std::mutex blocksMutex;
+
+    // If a range throws, the blocks already handed over are freed by the
+    // snapshot's destructor on the way out
+    pool.parallelFor(tags.size(), grain, [&](std::size_t begin, std::size_t end) {
+        // Moved-from tags have no Bio to copy
+        std::size_t count = 0;
+        for (std::size_t i = begin; i < end; ++i) {
+            count += tags[i].getBioUseCount() != 0 ? 1 : 0;
+        }
+
+        std::allocator<Bio> storage;
+        Bio* bios = count > 0 ? storage.allocate(count) : nullptr;
+        std::size_t built = 0;
+        try {
+            for (std::size_t i = begin; i < end; ++i) {
+                const FancyNameTag& tag = tags[i];
+                const Bio* copy = nullptr;
+                if (tag.getBioUseCount() != 0) {
+                    copy = new (bios + built) Bio(tag.getBio());
+                    ++built;
+                }
+                snapshot.tags_[i] = SnapshotTag{tag.getId(), tag.getCompanyId(), copy};
+            }
+        } catch (...) {
+            std::destroy(bios, bios + built);
+            storage.deallocate(bios, count);
+            throw;
+        }
+
+        if (bios) {
+            std::lock_guard<std::mutex> lock(blocksMutex);
+            snapshot.blocks_.push_back({bios, count});
+        }
+    });
+    return snapshot;
+}
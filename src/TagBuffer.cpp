@@ -0,0 +1,230 @@
+// Include the flat-buffer serialization declarations
+#include "TagBuffer.h"
+
+// array for the fields of one record
+#include <array>
+// bit for std::endian (the format is little-endian)
+#include <bit>
+// cstring for std::memcpy
+#include <cstring>
+// stdexcept for std::invalid_argument, std::length_error and std::runtime_error
+#include <stdexcept>
+// string for the error messages
+#include <string>
+
+// Integers are copied in memory order, which is only the format's byte order
+// on little-endian machines (x86-64, ARM64)
+static_assert(std::endian::native == std::endian::little, "tag buffers are little-endian");
+
+namespace {
+
+// u32 size, u16 kind, u16 version
+constexpr std::size_t kHeaderSize = 8;
+
+// Rounds up to the next multiple of 4 (every record's size is one)
+std::size_t align4(std::size_t size) {
+    return (size + 3) & ~std::size_t{3};
+}
+
+// Reads a T stored at p. A shared-memory buffer can start anywhere, so
+// nothing is assumed about alignment; memcpy compiles down to a plain load.
+template <typename T>
+T load(const char* p) {
+    T value;
+    std::memcpy(&value, p, sizeof(T));
+    return value;
+}
+
+template <typename T>
+void store(char* p, T value) {
+    std::memcpy(p, &value, sizeof(T));
+}
+
+[[noreturn]] void corrupt(const char* what) {
+    throw std::runtime_error(std::string("TagBuffer: ") + what);
+}
+
+// Size of a record with these fields
+template <std::size_t Ints, std::size_t Strings>
+std::size_t recordSize(const std::array<std::string_view, Strings>& strings) {
+    std::size_t size = kHeaderSize + 4 * (Ints + Strings);
+    for (std::string_view s : strings) {
+        size += s.size();
+    }
+    return align4(size);
+}
+
+// Appends one record: header, integers, lengths, string bytes, padding.
+// The vector grows once, then everything is copied straight into it.
+template <std::size_t Ints, std::size_t Strings>
+void appendRecord(std::vector<char>& out, TagRecordKind kind, const std::array<std::int32_t, Ints>& ints,
+                  const std::array<std::string_view, Strings>& strings) {
+    const std::size_t size = recordSize<Ints>(strings);
+    if (size > UINT32_MAX) {
+        throw std::length_error("TagBuffer record is larger than 4 GB");
+    }
+    const std::size_t start = out.size();
+    out.resize(start + size);
+    char* p = out.data() + start;
+    store(p, static_cast<std::uint32_t>(size));
+    store(p + 4, static_cast<std::uint16_t>(kind));
+    store(p + 6, kTagBufferVersion);
+    p += kHeaderSize;
+    for (std::int32_t value : ints) {
+        store(p, value);
+        p += 4;
+    }
+    for (std::string_view s : strings) {
+        store(p, static_cast<std::uint32_t>(s.size()));
+        p += 4;
+    }
+    for (std::string_view s : strings) {
+        std::memcpy(p, s.data(), s.size());
+        p += s.size();
+    }
+    std::memset(p, 0, static_cast<std::size_t>(out.data() + out.size() - p)); // padding
+}
+
+std::array<std::string_view, 3> bioStrings(const Bio& bio) {
+    return {bio.name, bio.title, bio.department};
+}
+
+std::array<std::string_view, 2> nameTagStrings(const NameTag& tag) {
+    return {tag.getName(), tag.getCompany()};
+}
+
+// Throws for a moved-from tag, which has no Bio to write
+std::array<std::string_view, 4> fancyStrings(const FancyNameTag& tag) {
+    if (tag.getBioUseCount() == 0) {
+        throw std::invalid_argument("can't serialize a moved-from FancyNameTag");
+    }
+    const Bio& bio = tag.getBio();
+    return {tag.getCompany(), bio.name, bio.title, bio.department};
+}
+
+} // namespace
+
+// ==================== Views ====================
+
+// Copies the viewed strings into an owning Bio
+Bio BioView::toBio() const {
+    return Bio{std::string(name), std::string(title), std::string(department), year};
+}
+
+// ==================== Writing ====================
+
+// Bio:          year | name, title, department
+std::size_t serializedSize(const Bio& bio) {
+    return recordSize<1>(bioStrings(bio));
+}
+
+void serialize(const Bio& bio, std::vector<char>& out) {
+    appendRecord<1>(out, TagRecordKind::Bio, {bio.year}, bioStrings(bio));
+}
+
+// NameTag:      id | name, company
+std::size_t serializedSize(const NameTag& tag) {
+    return recordSize<1>(nameTagStrings(tag));
+}
+
+void serialize(const NameTag& tag, std::vector<char>& out) {
+    appendRecord<1>(out, TagRecordKind::NameTag, {tag.getId()}, nameTagStrings(tag));
+}
+
+// FancyNameTag: id, year | company, name, title, department
+std::size_t serializedSize(const FancyNameTag& tag) {
+    return recordSize<2>(fancyStrings(tag));
+}
+
+void serialize(const FancyNameTag& tag, std::vector<char>& out) {
+    const auto strings = fancyStrings(tag); // first: it checks that there is a Bio
+    appendRecord<2>(out, TagRecordKind::FancyNameTag, {tag.getId(), tag.getBio().year}, strings);
+}
+
+// ==================== Reading ====================
+
+TagRecordKind TagBufferReader::nextKind() const {
+    if (buffer_.size() - position_ < kHeaderSize) {
+        corrupt(atEnd() ? "no more records" : "truncated record header");
+    }
+    return static_cast<TagRecordKind>(load<std::uint16_t>(buffer_.data() + position_ + 4));
+}
+
+// Every check happens before any string_view is made, and each one compares
+// against what is left of the record, so no sum can overflow
+std::size_t TagBufferReader::readRecord(TagRecordKind kind, std::span<std::int32_t> ints,
+                                        std::span<std::string_view> strings) const {
+    if (nextKind() != kind) {
+        corrupt("record is of a different kind");
+    }
+    const char* record = buffer_.data() + position_;
+    const std::size_t size = load<std::uint32_t>(record);
+    if (load<std::uint16_t>(record + 6) != kTagBufferVersion) {
+        corrupt("unsupported record version");
+    }
+    const std::size_t fixed = kHeaderSize + 4 * (ints.size() + strings.size());
+    if (size < fixed || size > buffer_.size() - position_) {
+        corrupt("record size out of range");
+    }
+    const char* p = record + kHeaderSize;
+    for (std::int32_t& value : ints) {
+        value = load<std::int32_t>(p);
+        p += 4;
+    }
+    const char* text = record + fixed;
+    std::size_t textLeft = size - fixed;
+    for (std::string_view& s : strings) {
+        const std::size_t length = load<std::uint32_t>(p);
+        p += 4;
+        if (length > textLeft) {
+            corrupt("string length out of range");
+        }
+        s = std::string_view(text, length);
+        text += length;
+        textLeft -= length;
+    }
+    return size;
+}
+
+BioView TagBufferReader::readBio() {
+    std::array<std::int32_t, 1> ints;
+    std::array<std::string_view, 3> strings;
+    position_ += readRecord(TagRecordKind::Bio, ints, strings);
+    return BioView{strings[0], strings[1], strings[2], ints[0]};
+}
+
+NameTagView TagBufferReader::readNameTag() {
+    std::array<std::int32_t, 1> ints;
+    std::array<std::string_view, 2> strings;
+    position_ += readRecord(TagRecordKind::NameTag, ints, strings);
+    return NameTagView{ints[0], strings[0], strings[1]};
+}
+
+FancyNameTagView TagBufferReader::readFancyNameTag() {
+    std::array<std::int32_t, 2> ints;
+    std::array<std::string_view, 4> strings;
+    position_ += readRecord(TagRecordKind::FancyNameTag, ints, strings);
+    return FancyNameTagView{ints[0], strings[0], strings[1], strings[2], strings[3], ints[1]};
+}
+
+// Only the size is needed, but it is checked the same way
+void TagBufferReader::skip() {
+    nextKind();
+    const std::size_t size = load<std::uint32_t>(buffer_.data() + position_);
+    if (size < kHeaderSize || size > buffer_.size() - position_) {
+        corrupt("record size out of range");
+    }
+    position_ += size;
+}
+
+BioView deserializeBio(std::span<const char> buffer) {
+    return TagBufferReader(buffer).readBio();
+}
+
+NameTagView deserializeNameTag(std::span<const char> buffer) {
+    return TagBufferReader(buffer).readNameTag();
+}
+
+FancyNameTagView deserializeFancyNameTag(std::span<const char> buffer) {
+    return TagBufferReader(buffer).readFancyNameTag();
+}
@@ -0,0 +1,299 @@
+// Include the TagSearch class declaration
+#include "TagSearch.h"
+
+// algorithm for std::upper_bound
+#include <algorithm>
+// cstring for std::memcmp
+#include <cstring>
+// stdexcept for std::invalid_argument and std::length_error
+#include <stdexcept>
+
+// The SIMD kernels use GCC/Clang per-function target attributes, so the rest
+// of the program doesn't need -mavx2 and still runs on CPUs without it.
+// Other compilers (or other CPUs) get the scalar kernel only.
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define NAMETAG_HAS_X86_KERNELS 1
+#endif
+
+namespace {
+
+constexpr std::size_t kNotFound = std::string_view::npos;
+constexpr std::uint32_t kUnseenCompany = UINT32_MAX;
+
+// ASCII-only lower-casing, the same for the packed text and the search text
+char foldCase(char c) {
+    return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+std::string foldCase(std::string_view text) {
+    std::string folded(text);
+    for (char& c : folded) {
+        c = foldCase(c);
+    }
+    return folded;
+}
+
+// Every kernel: position of the first needle in text[0, size), or kNotFound.
+// needle is at least one character long.
+using FindFn = std::size_t (*)(const char* text, std::size_t size, std::string_view needle);
+
+std::size_t findScalar(const char* text, std::size_t size, std::string_view needle) {
+    return std::string_view(text, size).find(needle);
+}
+
+#if defined(NAMETAG_HAS_X86_KERNELS)
+
+// Both SIMD kernels: compare a block of positions i..i+W-1 against the
+// needle's first character, and the block starting needle.size()-1 later
+// against its last. A position where both match is a candidate, checked with
+// memcmp. Real text rarely has both, so almost every block is two loads, two
+// compares and an AND. The last few positions (too few for a whole block
+// without reading past the end) are left to findScalar.
+
+__attribute__((target("sse2")))
+std::size_t findSse2(const char* text, std::size_t size, std::string_view needle) {
+    const std::size_t last = needle.size() - 1;
+    const __m128i firstChar = _mm_set1_epi8(needle.front());
+    const __m128i lastChar = _mm_set1_epi8(needle.back());
+    std::size_t i = 0;
+    for (; i + last + 16 <= size; i += 16) {
+        const __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+        const __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i + last));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(blockFirst, firstChar), _mm_cmpeq_epi8(blockLast, lastChar))));
+        while (mask != 0) {
+            const std::size_t candidate = i + static_cast<std::size_t>(__builtin_ctz(mask));
+            if (std::memcmp(text + candidate, needle.data(), needle.size()) == 0) {
+                return candidate;
+            }
+            mask &= mask - 1;
+        }
+    }
+    const std::size_t rest = findScalar(text + i, size - i, needle);
+    return rest == kNotFound ? kNotFound : i + rest;
+}
+
+__attribute__((target("avx2")))
+std::size_t findAvx2(const char* text, std::size_t size, std::string_view needle) {
+    const std::size_t last = needle.size() - 1;
+    const __m256i firstChar = _mm256_set1_epi8(needle.front());
+    const __m256i lastChar = _mm256_set1_epi8(needle.back());
+    std::size_t i = 0;
+    for (; i + last + 32 <= size; i += 32) {
+        const __m256i blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i));
+        const __m256i blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i + last));
+        unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(blockFirst, firstChar), _mm256_cmpeq_epi8(blockLast, lastChar))));
+        while (mask != 0) {
+            const std::size_t candidate = i + static_cast<std::size_t>(__builtin_ctz(mask));
+            if (std::memcmp(text + candidate, needle.data(), needle.size()) == 0) {
+                return candidate;
+            }
+            mask &= mask - 1;
+        }
+    }
+    const std::size_t rest = findScalar(text + i, size - i, needle);
+    return rest == kNotFound ? kNotFound : i + rest;
+}
+
+#endif
+
+FindFn findFunction(SearchKernel kernel) {
+    switch (kernel) {
+#if defined(NAMETAG_HAS_X86_KERNELS)
+        case SearchKernel::Sse2: return findSse2;
+        case SearchKernel::Avx2: return findAvx2;
+#endif
+        default: return findScalar;
+    }
+}
+
+} // namespace
+
+// ==================== Kernel selection ====================
+
+bool TagSearch::isSupported(SearchKernel kernel) {
+    switch (kernel) {
+        case SearchKernel::Scalar: return true;
+#if defined(NAMETAG_HAS_X86_KERNELS)
+        case SearchKernel::Sse2: return __builtin_cpu_supports("sse2");
+        case SearchKernel::Avx2: return __builtin_cpu_supports("avx2");
+#endif
+        default: return false;
+    }
+}
+
+SearchKernel TagSearch::bestKernel() {
+    static const SearchKernel best = [] {
+        if (isSupported(SearchKernel::Avx2)) {
+            return SearchKernel::Avx2;
+        }
+        if (isSupported(SearchKernel::Sse2)) {
+            return SearchKernel::Sse2;
+        }
+        return SearchKernel::Scalar;
+    }();
+    return best;
+}
+
+void TagSearch::setKernel(SearchKernel kernel) {
+    if (!isSupported(kernel)) {
+        throw std::invalid_argument("TagSearch kernel is not supported on this CPU");
+    }
+    kernel_ = kernel;
+}
+
+// ==================== Building ====================
+
+void TagSearch::PackedText::add(std::string_view value) {
+    if (text.size() + value.size() + 1 > UINT32_MAX) {
+        throw std::length_error("TagSearch text is larger than 4 GB");
+    }
+    starts.push_back(static_cast<std::uint32_t>(text.size()));
+    for (char c : value) {
+        text.push_back(foldCase(c));
+    }
+    // A separator no (folded) search text can match across: a match can never
+    // start in one string and end in the next
+    text.push_back('\0');
+}
+
+// Names go in tag order; a company is packed the first time a tag uses it.
+// companyIndex maps CompanyId::value() (a small dense number) to its place
+// in companies_, or kUnseenCompany.
+void TagSearch::add(std::string_view name, CompanyId company, std::vector<std::uint32_t>& companyIndex) {
+    if (company.value() >= companyIndex.size()) {
+        companyIndex.resize(company.value() + 1, kUnseenCompany); // interned after we started
+    }
+    std::uint32_t& index = companyIndex[company.value()];
+    if (index == kUnseenCompany) {
+        index = static_cast<std::uint32_t>(companies_.starts.size());
+        companies_.add(company.str());
+    }
+    companyOfTag_.push_back(index);
+    names_.add(name);
+}
+
+// Closes both texts with their end offset, so string i is always
+// [starts[i], starts[i + 1] - 1)
+void TagSearch::finish() {
+    names_.starts.push_back(static_cast<std::uint32_t>(names_.text.size()));
+    companies_.starts.push_back(static_cast<std::uint32_t>(companies_.text.size()));
+}
+
+TagSearch::TagSearch(std::span<const NameTag> tags) {
+    std::size_t nameBytes = 0;
+    for (const NameTag& tag : tags) {
+        nameBytes += tag.getName().size() + 1;
+    }
+    names_.text.reserve(nameBytes);
+    names_.starts.reserve(tags.size() + 1);
+    companyOfTag_.reserve(tags.size());
+
+    std::vector<std::uint32_t> companyIndex(CompanyTable::size(), kUnseenCompany);
+    for (const NameTag& tag : tags) {
+        add(tag.getName(), tag.getCompanyId(), companyIndex);
+    }
+    finish();
+}
+
+// A moved-from FancyNameTag has no Bio (getBioUseCount() is 0), so no name
+TagSearch::TagSearch(std::span<const FancyNameTag> tags) {
+    auto nameOf = [](const FancyNameTag& tag) -> std::string_view {
+        return tag.getBioUseCount() > 0 ? std::string_view(tag.getBio().name) : std::string_view();
+    };
+    std::size_t nameBytes = 0;
+    for (const FancyNameTag& tag : tags) {
+        nameBytes += nameOf(tag).size() + 1;
+    }
+    names_.text.reserve(nameBytes);
+    names_.starts.reserve(tags.size() + 1);
+    companyOfTag_.reserve(tags.size());
+
+    std::vector<std::uint32_t> companyIndex(CompanyTable::size(), kUnseenCompany);
+    for (const FancyNameTag& tag : tags) {
+        add(nameOf(tag), tag.getCompanyId(), companyIndex);
+    }
+    finish();
+}
+
+// ==================== Searching ====================
+
+// Finds the first match at or after from, maps it to the string it is in
+// (the last start at or before it), reports that string, and carries on from
+// the start of the next one: each string is reported at most once.
+template <typename Hit>
+void TagSearch::PackedText::forEachMatch(std::string_view needle, SearchKernel kernel, Hit hit) const {
+    const std::size_t strings = starts.size() - 1;
+    if (needle.empty()) {
+        for (std::size_t i = 0; i < strings; ++i) {
+            hit(i);
+        }
+        return;
+    }
+    const FindFn find = findFunction(kernel);
+    std::size_t from = 0;
+    while (from < text.size()) {
+        const std::size_t found = find(text.data() + from, text.size() - from, needle);
+        if (found == kNotFound) {
+            return;
+        }
+        const std::size_t position = from + found;
+        const auto next = std::upper_bound(starts.begin(), starts.end(), static_cast<std::uint32_t>(position));
+        const std::size_t string = static_cast<std::size_t>(next - starts.begin()) - 1;
+        hit(string);
+        from = *next;
+    }
+}
+
+void TagSearch::mark(std::string_view text, SearchField field, std::vector<unsigned char>& hits) const {
+    const std::string needle = foldCase(text);
+    // '\0' separates the packed strings, so it never matches inside one
+    if (needle.find('\0') != std::string::npos) {
+        return;
+    }
+    if (field != SearchField::Company) {
+        names_.forEachMatch(needle, kernel_, [&hits](std::size_t tag) { hits[tag] = 1; });
+    }
+    if (field != SearchField::Name) {
+        std::vector<unsigned char> companyMatched(companies_.starts.size() - 1, 0);
+        bool any = false;
+        companies_.forEachMatch(needle, kernel_, [&](std::size_t company) {
+            companyMatched[company] = 1;
+            any = true;
+        });
+        if (any) {
+            for (std::size_t tag = 0; tag < companyOfTag_.size(); ++tag) {
+                hits[tag] |= companyMatched[companyOfTag_[tag]];
+            }
+        }
+    }
+}
+
+std::vector<std::size_t> TagSearch::find(std::string_view text, SearchField field) const {
+    std::vector<unsigned char> hits(size(), 0);
+    mark(text, field, hits);
+    std::vector<std::size_t> tags;
+    for (std::size_t tag = 0; tag < hits.size(); ++tag) {
+        if (hits[tag]) {
+            tags.push_back(tag);
+        }
+    }
+    return tags;
+}
+
+std::size_t TagSearch::count(std::string_view text, SearchField field) const {
+    std::vector<unsigned char> hits(size(), 0);
+    mark(text, field, hits);
+    return static_cast<std::size_t>(std::count(hits.begin(), hits.end(), 1));
+}
+
+std::size_t TagSearch::packedBytes(SearchField field) const {
+    switch (field) {
+        case SearchField::Name: return names_.text.size();
+        case SearchField::Company: return companies_.text.size();
+        case SearchField::Either: break;
+    }
+    return names_.text.size() + companies_.text.size();
+}
@@ -0,0 +1,74 @@
+// Include the tracing policies
+#include "Trace.h"
+
+// mutex so blocks from different threads don't interleave mid-line
+#include <mutex>
+
+namespace {
+
+// Write to std::cout once this much text has been collected
+constexpr std::size_t kFlushBytes = 64 * 1024;
+
+// One buffer per thread. Its destructor runs when the thread exits,
+// so nothing collected on a worker thread is ever lost.
+// Set once this thread's buffer has been destroyed. A plain bool has no
+// destructor, so it can still be read by tags destroyed after that point
+// (e.g. during static destruction); their lines are written straight out.
+thread_local bool bufferGone = false;
+
+struct TraceBuffer {
+    std::string text;
+
+    // Room for a full block plus the line that crosses kFlushBytes, so
+    // appending never reallocates (the buffer is cleared, not freed, after
+    // each write)
+    TraceBuffer() { text.reserve(kFlushBytes + 4096); }
+
+    ~TraceBuffer() {
+        writeOut();
+        bufferGone = true;
+    }
+
+    void writeOut() {
+        if (text.empty()) {
+            return;
+        }
+        writeBlock(text);
+        text.clear();
+    }
+
+    // One lock per block (not per line), and whole lines only
+    static void writeBlock(std::string_view block) {
+        static std::mutex coutMutex;
+        std::lock_guard<std::mutex> lock(coutMutex);
+        std::cout.write(block.data(), static_cast<std::streamsize>(block.size()));
+        std::cout.flush();
+    }
+};
+
+TraceBuffer& threadBuffer() {
+    thread_local TraceBuffer buffer;
+    return buffer;
+}
+
+} // namespace
+
+// Appends a line to this thread's buffer, writing the buffer out when it is full
+void Tracer<TraceLevel::Buffered>::emit(std::string_view line) {
+    if (bufferGone) {
+        TraceBuffer::writeBlock(line);
+        return;
+    }
+    TraceBuffer& buffer = threadBuffer();
+    buffer.text.append(line);
+    if (buffer.text.size() >= kFlushBytes) {
+        buffer.writeOut();
+    }
+}
+
+// Writes out whatever this thread has collected so far
+void Tracer<TraceLevel::Buffered>::flush() {
+    if (!bufferGone) {
+        threadBuffer().writeOut();
+    }
+}
@@ -0,0 +1,196 @@
+// Include the work-stealing pool declarations
+#include "WorkStealingPool.h"
+
+// algorithm for std::max
+#include <algorithm>
+// exception for std::exception_ptr (a body's exception, rethrown by the caller)
+#include <exception>
+// utility for std::move
+#include <utility>
+
+namespace {
+
+// Which pool (and which of its workers) the current thread belongs to
+thread_local const WorkStealingPool* t_pool = nullptr;
+thread_local std::size_t t_worker = 0;
+
+} // namespace
+
+// Creates one deque per worker before starting any thread, so a worker can
+// steal from any index the moment it starts
+WorkStealingPool::WorkStealingPool(std::size_t threads) {
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    workers_.reserve(threads);
+    for (std::size_t i = 0; i < threads; ++i) {
+        workers_.push_back(std::make_unique<Worker>());
+    }
+    threads_.reserve(threads);
+    for (std::size_t i = 0; i < threads; ++i) {
+        threads_.emplace_back([this, i] { work(i); });
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread& thread : threads_) {
+        thread.join();
+    }
+}
+
+std::size_t WorkStealingPool::currentWorker() const {
+    return t_pool == this ? t_worker : size();
+}
+
+void WorkStealingPool::submit(std::function<void()> task) {
+    const std::size_t self = currentWorker();
+    const std::size_t target = self < size() ? self
+                                             : nextWorker_.fetch_add(1, std::memory_order_relaxed) % size();
+    push(target, std::move(task));
+}
+
+// Adds to the back of one worker's deque and wakes a sleeping worker.
+// Taking sleepMutex_ before notifying closes the gap between a worker
+// finding every deque empty and going to sleep.
+void WorkStealingPool::push(std::size_t worker, std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(workers_[worker]->mutex);
+        workers_[worker]->tasks.push_back(std::move(task));
+    }
+    pending_.fetch_add(1, std::memory_order_release);
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+    }
+    wake_.notify_one();
+}
+
+// Owner: newest task first (back of its own deque)
+bool WorkStealingPool::popLocal(std::size_t worker, std::function<void()>& task) {
+    Worker& own = *workers_[worker];
+    std::lock_guard<std::mutex> lock(own.mutex);
+    if (own.tasks.empty()) {
+        return false;
+    }
+    task = std::move(own.tasks.back());
+    own.tasks.pop_back();
+    pending_.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+// Thief: oldest task first (front of someone else's deque), trying each
+// victim once starting just after ourselves so thieves spread out
+bool WorkStealingPool::steal(std::size_t thief, std::function<void()>& task) {
+    const std::size_t count = size();
+    for (std::size_t offset = 1; offset <= count; ++offset) {
+        const std::size_t victim = (thief + offset) % count;
+        if (victim == thief) {
+            continue;
+        }
+        Worker& other = *workers_[victim];
+        std::lock_guard<std::mutex> lock(other.mutex);
+        if (!other.tasks.empty()) {
+            task = std::move(other.tasks.front());
+            other.tasks.pop_front();
+            pending_.fetch_sub(1, std::memory_order_relaxed);
+            steals_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool WorkStealingPool::runOne(std::size_t worker) {
+    std::function<void()> task;
+    if (popLocal(worker, task) || steal(worker, task)) {
+        task();
+        return true;
+    }
+    return false;
+}
+
+// Run tasks while there are any; sleep when every deque is empty
+void WorkStealingPool::work(std::size_t worker) {
+    t_pool = this;
+    t_worker = worker;
+    while (true) {
+        if (runOne(worker)) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleepMutex_);
+        wake_.wait(lock, [this] { return stopping_ || pending_.load(std::memory_order_acquire) > 0; });
+        if (stopping_ && pending_.load(std::memory_order_acquire) == 0) {
+            return;
+        }
+    }
+}
+
+void WorkStealingPool::parallelFor(std::size_t count, std::size_t grain,
+                                   const std::function<void(std::size_t, std::size_t)>& body) {
+    if (count == 0) {
+        return;
+    }
+    grain = std::max<std::size_t>(grain, 1);
+
+    // Shared by every piece of this loop; lives on the caller's stack, which
+    // is safe because the caller doesn't return until outstanding hits 0
+    struct Loop {
+        const std::function<void(std::size_t, std::size_t)>& body;
+        std::size_t grain;
+        std::atomic<std::size_t> outstanding{1};
+        std::mutex mutex{};
+        std::condition_variable done{};
+        std::exception_ptr error{};
+    } loop{body, grain}; // the "{}"s above mark the rest as default on purpose (-Wextra)
+
+    // Runs [begin, end): split off the upper half as a new task until the
+    // piece is small enough, then run the rest here
+    std::function<void(std::size_t, std::size_t)> run;
+    run = [this, &loop, &run](std::size_t begin, std::size_t end) {
+        try {
+            while (end - begin > loop.grain) {
+                const std::size_t middle = begin + (end - begin) / 2;
+                loop.outstanding.fetch_add(1, std::memory_order_relaxed);
+                submit([&run, middle, end] { run(middle, end); });
+                end = middle;
+            }
+            loop.body(begin, end);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(loop.mutex);
+            if (!loop.error) {
+                loop.error = std::current_exception();
+            }
+        }
+        // Decrement under the mutex: once the caller can take it and see 0,
+        // no piece touches loop again
+        std::lock_guard<std::mutex> lock(loop.mutex);
+        if (loop.outstanding.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            loop.done.notify_all();
+        }
+    };
+
+    const std::size_t self = currentWorker();
+    if (self < size()) {
+        // Inside a task: run the first piece here, then help with the rest
+        // (blocking would take a worker away from the very loop it waits for)
+        run(0, count);
+        while (loop.outstanding.load(std::memory_order_acquire) > 0) {
+            if (!runOne(self)) {
+                std::this_thread::yield();
+            }
+        }
+        std::lock_guard<std::mutex> lock(loop.mutex);
+    } else {
+        submit([&run, count] { run(0, count); });
+        std::unique_lock<std::mutex> lock(loop.mutex);
+        loop.done.wait(lock, [&loop] { return loop.outstanding.load(std::memory_order_acquire) == 0; });
+    }
+
+    if (loop.error) {
+        std::rethrow_exception(loop.error);
+    }
+}
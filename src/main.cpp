@@ -1,12 +1,24 @@
 // Include the FancyNameTag class (which also brings in Bio)
 #include "FancyNameTag.h"
+#include "LifecycleRecorder.h"
 #include "NameTag.h"
 
 
 #include <iostream>
+#include <optional>
+#include <string>
 #include <utility>
 
-int main() {
+int main(int argc, char* argv[]) {
+    // Optional: ./CopyAndMoveConstructor --record events.bin
+    // also writes every NameTag and FancyNameTag lifecycle event to events.bin;
+    // ./lifecycle_decode events.bin prints them back as text.
+    // Declared first, so it is destroyed last — after every tag's destructor.
+    std::optional<LifecycleRecording> recording;
+    if (argc == 3 && std::string(argv[1]) == "--record") {
+        recording.emplace(argv[2]);
+    }
+
     // -------------------------------------------------------
     // Part 1: NameTag (stack-only members, default copy/move)
     // The compiler generates correct copy/move for us.
@@ -84,9 +96,11 @@ int main() {
     // Notice what happened to each member:
     //   - id_ (int): still has its value. Primitive types are just copied — there's
     //     nothing to "steal," so the original keeps its value.
-    //   - name_ and company_ (std::string): likely empty now. std::string stores its
+    //   - name_ (std::string): likely empty now. std::string stores its
     //     characters on the heap internally. Moving a string transfers (steals) that
     //     heap buffer to the new string, leaving the source empty.
+    //   - company_ (CompanyId): still has its value. It's a small handle into the
+    //     shared CompanyTable, so like an int it is just copied.
     // This is why move matters: it avoids copying heap data by transferring ownership.
 
     original.print("original", "after move");
@@ -101,7 +115,8 @@ int main() {
     //   - Destructor (to free heap memory)
     //   - Copy constructor (deep copy to avoid shallow copy danger)
     //   - Move constructor (transfer ownership efficiently)
-    // We've deleted the assignment operators to keep this example focused.
+    //   - Copy and move assignment (same ideas, for an existing tag)
+    // This demo focuses on the constructors.
     // In modern C++, you'd use std::unique_ptr<Bio> instead of Bio*
     // and get all this behavior automatically — we'll cover that next.
     // -------------------------------------------------------
@@ -114,7 +129,9 @@ int main() {
 
     std::cout << "--- Construct ---\n";
 
-    // Create original with a Bio struct using aggregate initialization
+    // Create original with a Bio struct using aggregate initialization.
+    // The braced Bio is a temporary, so the Bio&& constructor is chosen and
+    // its strings are moved into the heap Bio instead of copied.
 
     FancyNameTag fOriginal(1, "Weber State University", {"Scott", "Professor", "Computer Science", 2010});
 
@@ -0,0 +1,47 @@
+// Include the allocation counter declarations
+#include "AllocationCounter.h"
+
+// cstdlib for std::malloc and std::free
+#include <cstdlib>
+// new for std::bad_alloc
+#include <new>
+
+// The replacements live in their own translation unit on purpose: callers
+// can't inline them, so the compiler never pairs a "new" at a call site with
+// the free() below (-Wmismatched-new-delete).
+
+namespace {
+
+thread_local std::size_t t_allocations = 0;
+thread_local std::size_t t_failAt = 0; // t_allocations value that throws (0: none)
+
+} // namespace
+
+std::size_t allocationsOnThisThread() {
+    return t_allocations;
+}
+
+void failAllocationOnThisThread(std::size_t n) {
+    t_failAt = n == 0 ? 0 : t_allocations + n;
+}
+
+// new[] and delete[] forward to these by default, so arrays are counted too
+void* operator new(std::size_t bytes) {
+    ++t_allocations;
+    if (t_allocations == t_failAt) {
+        t_failAt = 0;
+        throw std::bad_alloc();
+    }
+    if (void* memory = std::malloc(bytes == 0 ? 1 : bytes)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
@@ -0,0 +1,30 @@
+// Header guard - prevents this file from being included more than once
+#pragma once
+
+// cstddef for std::size_t
+#include <cstddef>
+
+// Counts calls to the global operator new on the current thread.
+//
+// AllocationCounter.cpp replaces the global operator new/delete, and a
+// replacement applies to the WHOLE binary it is linked into. Only run_tests
+// links it; never add it to run_benchmarks, where the extra work would be
+// timed in every benchmark.
+//
+// The counter is per thread, and tests only look at the difference across a
+// few lines, so other tests are unaffected.
+
+// Allocations made on this thread so far
+std::size_t allocationsOnThisThread();
+
+// Makes the n-th allocation from now on this thread (1 = the next one) throw
+// std::bad_alloc, to test what a class does when new fails. 0 cancels.
+void failAllocationOnThisThread(std::size_t n);
+
+// Allocations made on this thread by calling fn()
+template <typename Fn>
+std::size_t allocationsDuring(Fn&& fn) {
+    const std::size_t before = allocationsOnThisThread();
+    fn();
+    return allocationsOnThisThread() - before;
+}
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "AddrUtil.h"
+
+// ==================== shortAddr ====================
+
+namespace {
+
+// The original implementation: stream the pointer, keep the last 5 characters.
+// This is the reference every platform's output must match.
+std::string referenceShortAddr(const void* ptr) {
+    std::ostringstream oss;
+    oss << ptr;
+    std::string full = oss.str();
+    const std::size_t len = 5;
+    if (full.size() <= len) {
+        return full;
+    }
+    return full.substr(full.size() - len);
+}
+
+const void* fromBits(std::uintptr_t bits) {
+    return reinterpret_cast<const void*>(bits);
+}
+
+} // namespace
+
+TEST(AddrUtilTest, MatchesStreamForNullptr) {
+    EXPECT_EQ(shortAddr(nullptr).str(), referenceShortAddr(nullptr));
+}
+
+TEST(AddrUtilTest, MatchesStreamForSmallValues) {
+    // Short addresses exercise the "whole string is shorter than 5" path
+    for (std::uintptr_t bits : {0x1u, 0xFu, 0x10u, 0xABCu, 0xFFFu, 0x1234u, 0xFFFFu, 0x10000u}) {
+        EXPECT_EQ(shortAddr(fromBits(bits)).str(), referenceShortAddr(fromBits(bits)))
+            << "bits = " << bits;
+    }
+}
+
+TEST(AddrUtilTest, MatchesStreamForRealAddresses) {
+    int onStack = 0;
+    auto onHeap = std::make_unique<int>(0);
+    static int inStaticStorage = 0;
+    for (const void* ptr : {static_cast<const void*>(&onStack),
+                            static_cast<const void*>(onHeap.get()),
+                            static_cast<const void*>(&inStaticStorage)}) {
+        EXPECT_EQ(shortAddr(ptr).str(), referenceShortAddr(ptr));
+    }
+}
+
+TEST(AddrUtilTest, MatchesStreamAcrossBitPatterns) {
+    // Walk a single set bit and an all-ones prefix across every position
+    for (std::size_t bit = 0; bit < 8 * sizeof(std::uintptr_t); ++bit) {
+        const std::uintptr_t single = std::uintptr_t{1} << bit;
+        const std::uintptr_t ones = ~std::uintptr_t{0} >> bit;
+        EXPECT_EQ(shortAddr(fromBits(single)).str(), referenceShortAddr(fromBits(single)));
+        EXPECT_EQ(shortAddr(fromBits(ones)).str(), referenceShortAddr(fromBits(ones)));
+    }
+}
+
+TEST(AddrUtilTest, StreamsAndAppends) {
+    int value = 0;
+    const std::string expected = referenceShortAddr(&value);
+
+    std::ostringstream streamed;
+    streamed << shortAddr(&value);
+    EXPECT_EQ(streamed.str(), expected);
+
+    std::string out = "STACK ";
+    appendShortAddr(out, &value);
+    EXPECT_EQ(out, "STACK " + expected);
+
+    char buffer[ShortAddr::kMaxChars];
+    char* end = appendShortAddr(buffer, &value);
+    EXPECT_EQ(std::string(buffer, end), expected);
+}
+
+TEST(AddrUtilTest, WorksAtCompileTime) {
+    constexpr ShortAddr addr = shortAddrFromBits(0x7FFD3A2B1C80);
+    static_assert(addr.size == 5, "shortAddr always keeps 5 characters of a long address");
+    EXPECT_EQ(addr.view(), referenceShortAddr(fromBits(0x7FFD3A2B1C80)));
+}
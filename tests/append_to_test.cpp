@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <iostream>
+#include <string>
+#include <utility>
+#include "Bio.h"
+#include "FancyNameTag.h"
+#include "InlineFancyNameTag.h"
+#include "NameTag.h"
+
+// ==================== appendTo() matches print() byte for byte ====================
+
+namespace {
+
+// Runs a function with std::cout redirected and returns what it printed
+template <typename Function>
+std::string captureCout(Function function) {
+    std::stringstream buffer;
+    std::streambuf* oldCout = std::cout.rdbuf(buffer.rdbuf());
+    function();
+    std::cout.rdbuf(oldCout);
+    return buffer.str();
+}
+
+} // namespace
+
+TEST(AppendToTest, BioMatchesPrint) {
+    Bio bio{"Scott", "Professor", "Computer Science", 2010};
+    std::string appended;
+    bio.appendTo(appended);
+    EXPECT_EQ(appended, captureCout([&] { bio.print(); }));
+}
+
+TEST(AppendToTest, NameTagMatchesPrint) {
+    std::string printed;
+    std::string appended;
+    captureCout([&] {
+        NameTag tag(7, "Waldo", "Weber State University");
+        printed = captureCout([&] { tag.print("original", "unchanged"); });
+        tag.appendTo(appended, "original", "unchanged");
+    });
+    EXPECT_EQ(appended, printed);
+}
+
+TEST(AppendToTest, NameTagLongFieldsAreNotTruncated) {
+    std::string printed;
+    std::string appended;
+    captureCout([&] {
+        // Longer than every column width — setw pads but never cuts
+        NameTag tag(1234567, "Maximilian Alexander", "Weber State University");
+        printed = captureCout([&] { tag.print("a-label-longer-than-eighteen"); });
+        tag.appendTo(appended, "a-label-longer-than-eighteen");
+    });
+    EXPECT_EQ(appended, printed);
+}
+
+TEST(AppendToTest, FancyNameTagMatchesPrint) {
+    std::string printed;
+    std::string appended;
+    captureCout([&] {
+        FancyNameTag tag(1, "Weber State University", Bio{"Scott", "Professor", "Computer Science", 2010});
+        printed = captureCout([&] { tag.print("fOriginal", "unchanged"); });
+        tag.appendTo(appended, "fOriginal", "unchanged");
+    });
+    EXPECT_EQ(appended, printed);
+}
+
+TEST(AppendToTest, MovedFromFancyNameTagMatchesPrint) {
+    std::string printed;
+    std::string appended;
+    captureCout([&] {
+        FancyNameTag tag(1, "Weber State University", Bio{"Scott", "Professor", "Computer Science", 2010});
+        FancyNameTag moved(std::move(tag));
+        printed = captureCout([&] { tag.print("fOriginal", "after move"); });
+        tag.appendTo(appended, "fOriginal", "after move");
+    });
+    EXPECT_EQ(appended, printed);
+    EXPECT_NE(appended.find("(moved)"), std::string::npos);
+}
+
+TEST(AppendToTest, InlineFancyNameTagMatchesPrint) {
+    std::string printed;
+    std::string appended;
+    captureCout([&] {
+        InlineFancyNameTag tag(1, "Weber State University", Bio{"Scott", "Professor", "Computing", 2010});
+        printed = captureCout([&] { tag.print("inlineTag"); });
+        tag.appendTo(appended, "inlineTag");
+    });
+    EXPECT_EQ(appended, printed);
+}
+
+TEST(AppendToTest, AppendsWithoutClearing) {
+    Bio bio{"Scott", "Professor", "Computer Science", 2010};
+    std::string out = "bio=";
+    bio.appendTo(out);
+    EXPECT_EQ(out, "bio=Scott, Professor, Computer Science, 2010");
+}
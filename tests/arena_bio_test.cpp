@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include "AllocationCounter.h"
+#include "ArenaBio.h"
+#include "Bio.h"
+#include "InstanceCounters.h"
+
+// ==================== ArenaBio ====================
+
+namespace {
+
+// Runs a function with std::cout redirected and returns what it printed
+template <typename Function>
+std::string captureCout(Function function) {
+    std::stringstream buffer;
+    std::streambuf* oldCout = std::cout.rdbuf(buffer.rdbuf());
+    function();
+    std::cout.rdbuf(oldCout);
+    return buffer.str();
+}
+
+const Bio kLongBio{"Scott Hermanson the Third", "Distinguished Professor", "School of Computing Science", 2010};
+
+} // namespace
+
+TEST(ArenaBioTest, ConvertsToAndFromBio) {
+    const ArenaBio arena(kLongBio);
+    EXPECT_EQ(arena.name(), kLongBio.name);
+    EXPECT_EQ(arena.title(), kLongBio.title);
+    EXPECT_EQ(arena.department(), kLongBio.department);
+    EXPECT_EQ(arena.year(), 2010);
+    EXPECT_EQ(arena.toBio(), kLongBio);
+    EXPECT_EQ(arena, ArenaBio(kLongBio.name, kLongBio.title, kLongBio.department, 2010));
+}
+
+TEST(ArenaBioTest, StringsShareOneBlock) {
+    const ArenaBio arena(kLongBio);
+    EXPECT_EQ(arena.heapBytes(), kLongBio.name.size() + kLongBio.title.size() + kLongBio.department.size());
+    EXPECT_EQ(arena.name().data() + arena.name().size(), arena.title().data()) << "title follows name";
+    EXPECT_EQ(arena.title().data() + arena.title().size(), arena.department().data()) << "department follows title";
+    EXPECT_LT(sizeof(ArenaBio), sizeof(Bio));
+}
+
+TEST(ArenaBioTest, PrintMatchesBio) {
+    const ArenaBio arena(kLongBio);
+    EXPECT_EQ(captureCout([&] { arena.print(); }), captureCout([&] { kLongBio.print(); }));
+    std::string fromArena;
+    std::string fromBio;
+    arena.appendTo(fromArena);
+    kLongBio.appendTo(fromBio);
+    EXPECT_EQ(fromArena, fromBio);
+}
+
+TEST(ArenaBioTest, EmptyStringsNeedNoBlock) {
+    const ArenaBio arena("", "", "", 1999);
+    EXPECT_EQ(arena.heapBytes(), 0u);
+    EXPECT_TRUE(arena.name().empty());
+    EXPECT_TRUE(arena.department().empty());
+    EXPECT_EQ(arena.toBio(), (Bio{"", "", "", 1999}));
+
+    const ArenaBio titleOnly("", "Intern", "", 2024);
+    EXPECT_EQ(titleOnly.title(), "Intern");
+    EXPECT_EQ(ArenaBio(titleOnly), titleOnly);
+}
+
+TEST(ArenaBioTest, CopyIsOneBlockAndIndependent) {
+    ArenaBio original(kLongBio);
+    const InstanceCounts before = InstanceCounter<ArenaBio>::snapshot();
+    const ArenaBio copy(original);
+    const InstanceCounts delta = InstanceCounter<ArenaBio>::snapshot() - before;
+
+    EXPECT_EQ(copy, original);
+    EXPECT_NE(copy.name().data(), original.name().data()) << "a deep copy has its own block";
+    if constexpr (kCountersEnabled) {
+        EXPECT_EQ(delta.copies, 1u);
+        EXPECT_EQ(delta.heapBytes, original.heapBytes());
+    }
+
+    original = ArenaBio("Ann", "Lecturer", "Mathematics", 2015);
+    EXPECT_EQ(copy.toBio(), kLongBio);
+}
+
+TEST(ArenaBioTest, CopyAssignmentReplacesTheBlock) {
+    ArenaBio target("Ann", "Lecturer", "Mathematics", 2015);
+    const ArenaBio source(kLongBio);
+    target = source;
+    EXPECT_EQ(target, source);
+    target = target;
+    EXPECT_EQ(target.toBio(), kLongBio);
+}
+
+TEST(ArenaBioTest, MoveStealsTheBlockAndEmptiesTheSource) {
+    ArenaBio source(kLongBio);
+    const char* block = source.name().data();
+
+    ArenaBio moved(std::move(source));
+    EXPECT_EQ(moved.name().data(), block) << "a move allocates nothing";
+    EXPECT_EQ(moved.toBio(), kLongBio);
+    EXPECT_TRUE(source.name().empty());
+    EXPECT_TRUE(source.title().empty());
+    EXPECT_TRUE(source.department().empty());
+    EXPECT_EQ(source.heapBytes(), 0u);
+
+    ArenaBio target("Ann", "Lecturer", "Mathematics", 2015);
+    target = std::move(moved);
+    EXPECT_EQ(target.name().data(), block);
+    EXPECT_TRUE(moved.title().empty());
+}
+
+TEST(ArenaBioTest, OrdersLikeBio) {
+    const Bio a{"Ann", "Lecturer", "Mathematics", 2015};
+    const Bio b{"Ann", "Lecturer", "Physics", 2015};
+    const Bio c{"Ann", "Lecturer", "Physics", 2016};
+    EXPECT_LT(ArenaBio(a), ArenaBio(b));
+    EXPECT_LT(ArenaBio(b), ArenaBio(c));
+    EXPECT_EQ(ArenaBio(a) <=> ArenaBio(c), a <=> c);
+    // Same bytes, split differently, are different Bios
+    EXPECT_NE(ArenaBio("ab", "c", "", 1), ArenaBio("a", "bc", "", 1));
+}
+
+// The numbers arena_bio_bench.cpp reports as heap_blocks, checked against
+// real operator new calls
+TEST(ArenaBioTest, OneAllocationPerBioWhateverTheStrings) {
+    const Bio shortBio{"Scott", "Professor", "Math", 2010};
+
+    EXPECT_EQ(allocationsDuring([&] { ArenaBio arena(kLongBio); }), 1u);
+    EXPECT_EQ(allocationsDuring([&] { Bio copy(kLongBio); }), 3u) << "one per string";
+    EXPECT_EQ(allocationsDuring([&] { ArenaBio arena(shortBio); }), 1u);
+    EXPECT_EQ(allocationsDuring([&] { Bio copy(shortBio); }), 0u) << "all three fit the small buffer";
+
+    const ArenaBio original(kLongBio);
+    EXPECT_EQ(allocationsDuring([&] { ArenaBio copy(original); }), 1u);
+    EXPECT_EQ(allocationsDuring([&] { ArenaBio("", "", "", 1999); }), 0u);
+}
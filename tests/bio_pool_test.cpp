@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include "BioPool.h"
+#include "FancyNameTag.h"
+
+// ==================== BioPool ====================
+
+TEST(BioPoolTest, FreedSlotIsReused) {
+    void* first = BioPool::allocate(sizeof(Bio));
+    BioPool::deallocate(first, sizeof(Bio));
+
+    // The free list is LIFO, so the next allocation gets the same slot back
+    void* second = BioPool::allocate(sizeof(Bio));
+    EXPECT_EQ(first, second);
+    BioPool::deallocate(second, sizeof(Bio));
+}
+
+TEST(BioPoolTest, ReserveFillsFreeList) {
+    BioPool::reserve(BioPool::freeSlots() + 10);
+    const std::size_t before = BioPool::freeSlots();
+    void* slot = BioPool::allocate(sizeof(Bio));
+    EXPECT_EQ(BioPool::freeSlots(), before - 1);
+    BioPool::deallocate(slot, sizeof(Bio));
+    EXPECT_EQ(BioPool::freeSlots(), before);
+}
+
+TEST(BioPoolTest, ZeroBytesUseTheSmallestClass) {
+    BioPool::reserve(BioPool::freeSlots(1) + 1, 0);
+    EXPECT_EQ(BioPool::freeSlots(0), BioPool::freeSlots(1));
+    const std::size_t before = BioPool::freeSlots(0);
+
+    void* slot = BioPool::allocate(0);
+    ASSERT_NE(slot, nullptr);
+    EXPECT_EQ(BioPool::freeSlots(BioPool::kGranularity), before - 1);
+    BioPool::deallocate(slot, 0);
+    EXPECT_EQ(BioPool::freeSlots(0), before);
+}
+
+TEST(BioPoolTest, FreeListsArePerThread) {
+    BioPool::reserve(1);
+    std::size_t otherThreadSlots = 1;
+    std::thread worker([&] { otherThreadSlots = BioPool::freeSlots(); });
+    worker.join();
+    EXPECT_EQ(otherThreadSlots, 0u)
+        << "a new thread starts with an empty free list";
+}
+
+// ==================== FancyNameTag with BioAlloc::Pool ====================
+
+TEST(BioPoolTest, PooledTagDeepCopiesBio) {
+    Bio bio{"Scott", "Professor", "Computer Science", 2010};
+    FancyNameTag original(1, "Weber State Univ.", bio, BioAlloc::Pool);
+    FancyNameTag copied(original);
+
+    EXPECT_EQ(copied.getBioAlloc(), BioAlloc::Pool);
+    EXPECT_EQ(copied.getBio().name, "Scott");
+    EXPECT_NE(&original.getBio(), &copied.getBio());
+}
+
+TEST(BioPoolTest, PooledTagReturnsSlotOnDestroy) {
+    Bio bio{"Scott", "Professor", "Computer Science", 2010};
+    const Bio* bioAddr = nullptr;
+    {
+        FancyNameTag tag(1, "Weber State Univ.", bio, BioAlloc::Pool);
+        bioAddr = &tag.getBio();
+    }
+    // The destroyed tag's slot is the first one handed out again
+    FancyNameTag next(2, "Weber State Univ.", bio, BioAlloc::Pool);
+    EXPECT_EQ(&next.getBio(), bioAddr);
+}
+
+TEST(BioPoolTest, DefaultStrategyAppliesToNewTags) {
+    Bio bio{"Scott", "Professor", "Computer Science", 2010};
+    setDefaultBioAlloc(BioAlloc::Pool);
+    FancyNameTag pooled(1, "Weber State Univ.", bio);
+    setDefaultBioAlloc(BioAlloc::Heap);
+    FancyNameTag heap(2, "Weber State Univ.", bio);
+
+    EXPECT_EQ(pooled.getBioAlloc(), BioAlloc::Pool);
+    EXPECT_EQ(heap.getBioAlloc(), BioAlloc::Heap);
+}
@@ -0,0 +1,190 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "BioSlab.h"
+#include "CompactFancyNameTag.h"
+#include "FancyNameTag.h"
+
+// ==================== BioSlab ====================
+
+TEST(BioSlabTest, DestroyMakesTheHandleStale) {
+    const BioHandle handle = BioSlab::create(Bio{"Scott", "Professor", "Computing", 2010});
+    EXPECT_TRUE(BioSlab::isLive(handle));
+    EXPECT_EQ(BioSlab::get(handle).name, "Scott");
+
+    BioSlab::destroy(handle);
+    EXPECT_FALSE(BioSlab::isLive(handle));
+    EXPECT_THROW(BioSlab::get(handle), std::logic_error);
+    BioSlab::destroy(handle); // a second destroy is ignored
+}
+
+TEST(BioSlabTest, ReusedSlotGetsANewGeneration) {
+    const BioHandle first = BioSlab::create(Bio{"Ann", "TA", "CS", 2020});
+    BioSlab::destroy(first);
+    const BioHandle second = BioSlab::create(Bio{"Bob", "TA", "CS", 2021});
+
+    EXPECT_EQ(second.index, first.index) << "the freed slot is reused first";
+    EXPECT_NE(second.generation, first.generation);
+    EXPECT_THROW(BioSlab::get(first), std::logic_error)
+        << "the old handle must not see the new Bio";
+    EXPECT_EQ(BioSlab::get(second).name, "Bob");
+    BioSlab::destroy(second);
+}
+
+// The documented limit of an 8-bit generation: after 128 more lives in the
+// same slot, a stale handle's generation comes around again
+TEST(BioSlabTest, GenerationWrapsAfter128Lives) {
+    const BioHandle first = BioSlab::create(Bio{"Ann", "TA", "CS", 2020});
+    BioSlab::destroy(first);
+    for (int life = 1; life < 128; ++life) {
+        const BioHandle again = BioSlab::create(Bio{"Bob", "TA", "CS", 2021});
+        ASSERT_EQ(again.index, first.index);
+        ASSERT_NE(again.generation, first.generation) << "life " << life;
+        BioSlab::destroy(again);
+    }
+    const BioHandle wrapped = BioSlab::create(Bio{"Cy", "TA", "CS", 2022});
+    EXPECT_EQ(wrapped.index, first.index);
+    EXPECT_EQ(wrapped.generation, first.generation);
+    BioSlab::destroy(wrapped);
+}
+
+TEST(BioSlabTest, EmptyHandleIsNeverLive) {
+    EXPECT_FALSE(BioSlab::isLive(BioHandle{}));
+    EXPECT_THROW(BioSlab::get(BioHandle{}), std::logic_error);
+}
+
+TEST(BioSlabTest, BiosKeepTheirAddressWhileTheSlabGrows) {
+    const BioHandle first = BioSlab::create(Bio{"Scott", "Professor", "Computing", 2010});
+    const Bio* address = &BioSlab::get(first);
+
+    std::vector<BioHandle> more;
+    for (std::size_t i = 0; i < 3 * BioSlab::kSlotsPerChunk; ++i) {
+        more.push_back(BioSlab::create(Bio{"Person", "TA", "CS", 2020}));
+    }
+    EXPECT_EQ(&BioSlab::get(first), address);
+
+    const std::size_t live = BioSlab::liveCount();
+    for (BioHandle handle : more) {
+        BioSlab::destroy(handle);
+    }
+    EXPECT_EQ(BioSlab::liveCount(), live - more.size());
+    BioSlab::destroy(first);
+}
+
+// ==================== CompactFancyNameTag ====================
+
+TEST(CompactFancyNameTagTest, IsSmallerThanFancyNameTag) {
+    EXPECT_EQ(sizeof(CompactFancyNameTag), 12u);
+    EXPECT_EQ(sizeof(BioHandle), 4u);
+    EXPECT_LT(sizeof(BioHandle), sizeof(Bio*));
+    EXPECT_LT(sizeof(CompactFancyNameTag), sizeof(FancyNameTag));
+}
+
+TEST(CompactFancyNameTagTest, ConstructorValidatesLikeFancyNameTag) {
+    const Bio bio{"Scott", "Professor", "Computing", 2010};
+    EXPECT_THROW(CompactFancyNameTag(0, "Weber State Univ.", bio), std::invalid_argument);
+    EXPECT_THROW(CompactFancyNameTag(1, "", bio), std::invalid_argument);
+    EXPECT_THROW(CompactFancyNameTag(1, "Weber State Univ.", Bio{"", "Professor", "Computing", 2010}),
+                 std::invalid_argument);
+}
+
+TEST(CompactFancyNameTagTest, CopyGetsItsOwnSlot) {
+    CompactFancyNameTag original(1, "Weber State Univ.", Bio{"Scott", "Professor", "Computing", 2010});
+    CompactFancyNameTag copied(original);
+
+    EXPECT_EQ(copied.getBio().name, "Scott");
+    EXPECT_NE(&copied.getBio(), &original.getBio());
+    EXPECT_NE(copied.getBioHandle().index, original.getBioHandle().index);
+}
+
+TEST(CompactFancyNameTagTest, MoveTakesTheHandleAndLeavesSourceMoved) {
+    CompactFancyNameTag original(1, "Weber State Univ.", Bio{"Scott", "Professor", "Computing", 2010});
+    const Bio* bio = &original.getBio();
+
+    CompactFancyNameTag moved(std::move(original));
+    EXPECT_EQ(&moved.getBio(), bio) << "the Bio stays in its slot; only the handle moves";
+    EXPECT_FALSE(original.hasBio());
+    EXPECT_THROW(original.getBio(), std::logic_error);
+    EXPECT_THROW(original.setBioTitle("Dean"), std::logic_error);
+
+    std::string line;
+    original.appendTo(line, "original");
+    EXPECT_NE(line.find("bio=(moved)"), std::string::npos) << line;
+}
+
+TEST(CompactFancyNameTagTest, DestroyedTagsHandleIsStale) {
+    BioHandle handle;
+    {
+        CompactFancyNameTag tag(1, "Weber State Univ.", Bio{"Scott", "Professor", "Computing", 2010});
+        handle = tag.getBioHandle();
+        EXPECT_TRUE(BioSlab::isLive(handle));
+    }
+    EXPECT_FALSE(BioSlab::isLive(handle)) << "a use after free is detected, not read";
+    EXPECT_THROW(BioSlab::get(handle), std::logic_error);
+}
+
+TEST(CompactFancyNameTagTest, AssignmentsFreeTheOldSlot) {
+    CompactFancyNameTag a(1, "Weber State Univ.", Bio{"Ann", "TA", "CS", 2020});
+    CompactFancyNameTag b(2, "Weber State Univ.", Bio{"Bob", "TA", "CS", 2021});
+    const BioHandle aBio = a.getBioHandle();
+    const BioHandle bBio = b.getBioHandle();
+
+    a = b;
+    EXPECT_FALSE(BioSlab::isLive(aBio));
+    EXPECT_EQ(a.getId(), 2);
+    EXPECT_EQ(a.getBio().name, "Bob");
+    EXPECT_NE(&a.getBio(), &b.getBio());
+
+    const BioHandle copyBio = a.getBioHandle();
+    a = std::move(b);
+    EXPECT_FALSE(BioSlab::isLive(copyBio));
+    EXPECT_EQ(a.getBioHandle().index, bBio.index);
+    EXPECT_FALSE(b.hasBio());
+}
+
+TEST(CompactFancyNameTagTest, SetBioTitleChangesTheBioInPlace) {
+    CompactFancyNameTag tag(1, "Weber State Univ.", Bio{"Scott", "Professor", "Computing", 2010});
+    const BioHandle handle = tag.getBioHandle();
+
+    tag.setBioTitle("Dean");
+    EXPECT_EQ(tag.getBio().title, "Dean");
+    EXPECT_TRUE(BioSlab::isLive(handle));
+
+    tag.setBio(Bio{"Scott", "Provost", "Computing", 2010});
+    EXPECT_EQ(tag.getBio().title, "Provost");
+    EXPECT_FALSE(BioSlab::isLive(handle)) << "setBio() gives the tag a fresh slot";
+}
+
+TEST(CompactFancyNameTagTest, AppendToMatchesFancyNameTagColumns) {
+    const Bio bio{"Scott", "Professor", "Computing", 2010};
+    CompactFancyNameTag compact(1, "Weber State Univ.", bio);
+    FancyNameTag fancy(1, "Weber State Univ.", bio);
+
+    std::string compactLine;
+    std::string fancyLine;
+    compact.appendTo(compactLine, "tag");
+    fancy.appendTo(fancyLine, "tag");
+
+    // Same columns from the id to the end of the Bio; only the addresses and
+    // the Bio's location differ
+    const std::size_t idBegin = fancyLine.find("  id=");
+    const std::size_t bioEnd = fancyLine.find("} ") + 2;
+    EXPECT_EQ(compactLine.substr(idBegin, bioEnd - idBegin), fancyLine.substr(idBegin, bioEnd - idBegin));
+    EXPECT_EQ(compactLine.compare(bioEnd, 5, "SLAB "), 0) << compactLine;
+}
+
+TEST(CompactFancyNameTagTest, SortMovesHandlesAround) {
+    std::vector<CompactFancyNameTag> tags;
+    for (int id : {3, 1, 2}) {
+        tags.emplace_back(id, "Weber State Univ.", Bio{"Person " + std::to_string(id), "TA", "CS", 2020});
+    }
+    std::sort(tags.begin(), tags.end(),
+              [](const CompactFancyNameTag& a, const CompactFancyNameTag& b) { return a.getId() < b.getId(); });
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(tags[i].getId(), i + 1);
+        EXPECT_EQ(tags[i].getBio().name, "Person " + std::to_string(i + 1));
+    }
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "CompactFancyNameTag.h"
+#include "CompanyTable.h"
+#include "FancyNameTag.h"
+#include "InlineFancyNameTag.h"
+#include "NameTag.h"
+
+// ==================== CompanyTable ====================
+
+TEST(CompanyTableTest, SameNameGivesSameId) {
+    CompanyId first = CompanyTable::intern("Weber State University");
+    CompanyId second = CompanyTable::intern(std::string("Weber State ") + "University");
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(&first.str(), &second.str()) << "the name is stored only once";
+}
+
+TEST(CompanyTableTest, DifferentNamesGiveDifferentIds) {
+    EXPECT_NE(CompanyTable::intern("Weber State University"), CompanyTable::intern("Acme"));
+}
+
+TEST(CompanyTableTest, DefaultIdIsEmpty) {
+    CompanyId none;
+    EXPECT_TRUE(none.empty());
+    EXPECT_EQ(none.str(), "");
+    EXPECT_EQ(CompanyTable::intern(""), none);
+}
+
+TEST(CompanyTableTest, FindDoesNotIntern) {
+    const std::size_t before = CompanyTable::size();
+    EXPECT_FALSE(CompanyTable::find("Never Interned Company 7f3a").has_value());
+    EXPECT_EQ(CompanyTable::size(), before);
+}
+
+TEST(CompanyTableTest, ConcurrentInternAgrees) {
+    std::vector<CompanyId> ids(4);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < ids.size(); ++t) {
+        threads.emplace_back([&ids, t] {
+            for (int i = 0; i < 200; ++i) {
+                CompanyTable::intern("Concurrent Company " + std::to_string(i));
+            }
+            ids[t] = CompanyTable::intern("Concurrent Company 123");
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    for (CompanyId id : ids) {
+        EXPECT_EQ(id, ids[0]);
+    }
+    EXPECT_EQ(ids[0].str(), "Concurrent Company 123");
+}
+
+// ==================== Interned companies in tags ====================
+
+TEST(CompanyTableTest, TagsShareCompanyHandle) {
+    std::stringstream buffer;
+    std::streambuf* oldCout = std::cout.rdbuf(buffer.rdbuf());
+    NameTag tag(1, "Waldo", "Weber State University");
+    FancyNameTag fancy(2, "Weber State University", Bio{"Scott", "Professor", "Computer Science", 2010});
+    std::cout.rdbuf(oldCout);
+
+    EXPECT_EQ(tag.getCompanyId(), fancy.getCompanyId());
+    EXPECT_EQ(&tag.getCompany(), &fancy.getCompany());
+}
+
+TEST(CompanyTableTest, SetCompanyReinterns) {
+    std::stringstream buffer;
+    std::streambuf* oldCout = std::cout.rdbuf(buffer.rdbuf());
+    NameTag tag(1, "Waldo", "Weber State University");
+    std::cout.rdbuf(oldCout);
+
+    tag.setCompany("The School of Computing");
+    EXPECT_EQ(tag.getCompany(), "The School of Computing");
+    EXPECT_EQ(tag.getCompanyId(), CompanyTable::intern("The School of Computing"));
+    EXPECT_THROW(tag.setCompany(""), std::invalid_argument);
+}
+
+// The table never frees a name, so a constructor that throws must not have
+// interned its company first (or bad input could fill the table)
+TEST(CompanyTableTest, RejectedTagsInternNothing) {
+    const Bio goodBio{"Scott", "Professor", "Computer Science", 2010};
+    const Bio noTitle{"Scott", "", "Computer Science", 2010};
+
+    EXPECT_THROW(NameTag(0, "Waldo", "Rejected NameTag Co"), std::invalid_argument);
+    EXPECT_THROW(NameTag(1, "", "Rejected NameTag Co"), std::invalid_argument);
+    EXPECT_THROW(FancyNameTag(0, "Rejected FancyNameTag Co", goodBio), std::invalid_argument);
+    EXPECT_THROW(FancyNameTag(1, "Rejected FancyNameTag Co", Bio(noTitle)), std::invalid_argument);
+    EXPECT_THROW(InlineFancyNameTag(1, "Rejected InlineFancyNameTag Co", noTitle), std::invalid_argument);
+    EXPECT_THROW(CompactFancyNameTag(0, "Rejected CompactFancyNameTag Co", goodBio), std::invalid_argument);
+
+    EXPECT_FALSE(CompanyTable::find("Rejected NameTag Co").has_value());
+    EXPECT_FALSE(CompanyTable::find("Rejected FancyNameTag Co").has_value());
+    EXPECT_FALSE(CompanyTable::find("Rejected InlineFancyNameTag Co").has_value());
+    EXPECT_FALSE(CompanyTable::find("Rejected CompactFancyNameTag Co").has_value());
+}
@@ -2,7 +2,12 @@
 #include <sstream>
 #include <iostream>
 #include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
 #include "Bio.h"
+#include "BioPool.h"
+#include "InstanceCounters.h"
 #include "NameTag.h"
 #include "FancyNameTag.h"
 
@@ -170,6 +175,19 @@ TEST(FancyNameTagTest, CopyConstructorIsIndependent) {
         << "Modifying the original should not affect the copy";
 }
 
+TEST(FancyNameTagTest, CopyOfMovedFromTagHasNoBio) {
+    Bio bio{"Scott", "Professor", "Computer Science", 2010};
+    for (BioAlloc alloc : {BioAlloc::Heap, BioAlloc::Pool, BioAlloc::Shared}) {
+        FancyNameTag original(1, "Weber State Univ.", bio, alloc);
+        FancyNameTag moved(std::move(original));
+        FancyNameTag copied(original);
+
+        EXPECT_EQ(copied.getId(), 1);
+        EXPECT_EQ(copied.getBioUseCount(), 0u);
+        EXPECT_THROW(copied.setBioTitle("Dean"), std::logic_error);
+    }
+}
+
 // ==================== Setter Validation (4 points) ====================
 
 TEST(FancyNameTagTest, SetIdRejectsZero) {
@@ -183,3 +201,122 @@ TEST(FancyNameTagTest, SetCompanyRejectsEmpty) {
     FancyNameTag tag(1, "Weber State Univ.", bio);
     EXPECT_THROW(tag.setCompany(""), std::invalid_argument);
 }
+
+// ==================== Instance Counters (copy/move accounting) ====================
+// These use snapshot differences, so they don't depend on what other tests did.
+
+#define SKIP_IF_COUNTERS_OFF()                                             \
+    if constexpr (!kCountersEnabled) {                                     \
+        GTEST_SKIP() << "counters are compiled out (NAMETAG_COUNTERS=OFF)"; \
+    }
+
+TEST(InstanceCounterTest, CountedMemberTakesNoSpace) {
+    struct NameTagWithoutCounter {
+        int id;
+        std::string name;
+        CompanyId company;
+    };
+    EXPECT_EQ(sizeof(NameTag), sizeof(NameTagWithoutCounter));
+}
+
+TEST(InstanceCounterTest, NameTagDefaultCopyAndMoveAreCounted) {
+    SKIP_IF_COUNTERS_OFF();
+    const InstanceCounts before = InstanceCounter<NameTag>::snapshot();
+    {
+        NameTag original(1, "Waldo", "Weber State Univ.");
+        NameTag copied(original);
+        NameTag moved(std::move(copied));
+        const InstanceCounts during = InstanceCounter<NameTag>::snapshot() - before;
+        EXPECT_EQ(during.live, 3);
+    }
+    const InstanceCounts delta = InstanceCounter<NameTag>::snapshot() - before;
+    EXPECT_EQ(delta.created, 1u);
+    EXPECT_EQ(delta.copies, 1u);
+    EXPECT_EQ(delta.moves, 1u);
+    EXPECT_EQ(delta.destroyed, 3u);
+    EXPECT_EQ(delta.live, 0);
+}
+
+TEST(InstanceCounterTest, FancyNameTagMoveMakesZeroDeepCopies) {
+    SKIP_IF_COUNTERS_OFF();
+    FancyNameTag original(1, "Weber State Univ.", Bio{"Scott", "Professor", "Computer Science", 2010});
+    const InstanceCounts tagsBefore = InstanceCounter<FancyNameTag>::snapshot();
+    const InstanceCounts biosBefore = InstanceCounter<Bio>::snapshot();
+
+    FancyNameTag moved(std::move(original));
+
+    const InstanceCounts tags = InstanceCounter<FancyNameTag>::snapshot() - tagsBefore;
+    const InstanceCounts bios = InstanceCounter<Bio>::snapshot() - biosBefore;
+    EXPECT_EQ(tags.moves, 1u);
+    EXPECT_EQ(tags.copies, 0u);
+    EXPECT_EQ(tags.heapBytes, 0u) << "a move must not allocate a Bio";
+    EXPECT_EQ(bios.copies, 0u);
+    EXPECT_EQ(bios.live, 0);
+}
+
+TEST(InstanceCounterTest, FancyNameTagCopyIsOneDeepCopy) {
+    SKIP_IF_COUNTERS_OFF();
+    FancyNameTag original(1, "Weber State Univ.", Bio{"Scott", "Professor", "Computer Science", 2010},
+                          BioAlloc::Heap);
+    const InstanceCounts tagsBefore = InstanceCounter<FancyNameTag>::snapshot();
+    const InstanceCounts biosBefore = InstanceCounter<Bio>::snapshot();
+
+    FancyNameTag copied(original);
+
+    const InstanceCounts tags = InstanceCounter<FancyNameTag>::snapshot() - tagsBefore;
+    const InstanceCounts bios = InstanceCounter<Bio>::snapshot() - biosBefore;
+    EXPECT_EQ(tags.copies, 1u);
+    EXPECT_EQ(tags.heapBytes, bioAllocationBytes(BioAlloc::Heap));
+    EXPECT_EQ(bios.copies, 1u);
+    EXPECT_EQ(bios.live, 1);
+}
+
+TEST(InstanceCounterTest, SharedBioCopyAllocatesNothing) {
+    SKIP_IF_COUNTERS_OFF();
+    FancyNameTag original(1, "Weber State Univ.", Bio{"Scott", "Professor", "Computer Science", 2010},
+                          BioAlloc::Shared);
+    const InstanceCounts tagsBefore = InstanceCounter<FancyNameTag>::snapshot();
+    const InstanceCounts biosBefore = InstanceCounter<Bio>::snapshot();
+
+    FancyNameTag copied(original);
+    EXPECT_EQ((InstanceCounter<FancyNameTag>::snapshot() - tagsBefore).heapBytes, 0u);
+    EXPECT_EQ((InstanceCounter<Bio>::snapshot() - biosBefore).copies, 0u);
+
+    // Writing through the copy clones the shared Bio: now it allocates
+    copied.setBioTitle("Dean");
+    EXPECT_EQ((InstanceCounter<FancyNameTag>::snapshot() - tagsBefore).heapBytes,
+              bioAllocationBytes(BioAlloc::Shared));
+    EXPECT_EQ((InstanceCounter<Bio>::snapshot() - biosBefore).copies, 1u);
+}
+
+TEST(InstanceCounterTest, VectorGrowthMovesInsteadOfCopying) {
+    SKIP_IF_COUNTERS_OFF();
+    std::vector<FancyNameTag> tags;
+    const InstanceCounts before = InstanceCounter<FancyNameTag>::snapshot();
+    // No reserve(): every reallocation relocates the existing tags, which
+    // moves them only because the move constructor is noexcept
+    for (int id = 1; id <= 100; ++id) {
+        tags.emplace_back(id, "Weber State Univ.", Bio{"Scott", "Professor", "Computer Science", 2010});
+    }
+    const InstanceCounts delta = InstanceCounter<FancyNameTag>::snapshot() - before;
+    EXPECT_EQ(delta.created, 100u);
+    EXPECT_EQ(delta.copies, 0u);
+    EXPECT_GT(delta.moves, 0u);
+    EXPECT_EQ(delta.live, 100);
+}
+
+TEST(InstanceCounterTest, ResetClearsTotalsButKeepsLive) {
+    SKIP_IF_COUNTERS_OFF();
+    NameTag tag(1, "Waldo", "Weber State Univ.");
+    NameTag copied(tag);
+    const std::int64_t live = InstanceCounter<NameTag>::snapshot().live;
+
+    InstanceCounter<NameTag>::reset();
+
+    const InstanceCounts counts = InstanceCounter<NameTag>::snapshot();
+    EXPECT_EQ(counts.created, 0u);
+    EXPECT_EQ(counts.copies, 0u);
+    EXPECT_EQ(counts.moves, 0u);
+    EXPECT_EQ(counts.destroyed, 0u);
+    EXPECT_EQ(counts.live, live);
+}
@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "AllocationCounter.h"
+#include "BioPool.h"
+#include "FancyNameTag.h"
+#include "FancyNameTagBatch.h"
+#include "InstanceCounters.h"
+
+namespace {
+
+// Columns for count valid rows with ids 1..count
+struct Columns {
+    std::vector<int> ids;
+    std::vector<std::string> companies;
+    std::vector<Bio> bios;
+};
+
+Columns validColumns(int count) {
+    Columns columns;
+    for (int id = 1; id <= count; ++id) {
+        columns.ids.push_back(id);
+        columns.companies.push_back(id % 2 == 0 ? "Weber State University" : "Utah Tech");
+        columns.bios.push_back(Bio{"Person " + std::to_string(id), "Professor", "Computer Science", 2000 + id});
+    }
+    return columns;
+}
+
+} // namespace
+
+// ==================== Valid input ====================
+
+TEST(FancyNameTagBatchTest, BuildsEveryValidRowInOrder) {
+    const Columns columns = validColumns(5);
+
+    const FancyNameTagBatch batch = makeFancyNameTags(columns.ids, columns.companies, columns.bios);
+
+    ASSERT_EQ(batch.tags.size(), 5u);
+    EXPECT_TRUE(batch.errors.empty());
+    for (std::size_t i = 0; i < batch.tags.size(); ++i) {
+        EXPECT_EQ(batch.rows[i], i);
+        EXPECT_EQ(batch.tags[i].getId(), columns.ids[i]);
+        EXPECT_EQ(batch.tags[i].getCompany(), columns.companies[i]);
+        EXPECT_EQ(batch.tags[i].getBio().name, columns.bios[i].name);
+        EXPECT_EQ(batch.tags[i].getBioAlloc(), BioAlloc::Pool);
+    }
+}
+
+TEST(FancyNameTagBatchTest, TagsMatchTheRegularConstructor) {
+    const Columns columns = validColumns(3);
+    const FancyNameTagBatch batch = makeFancyNameTags(columns.ids, columns.companies, columns.bios, BioAlloc::Heap);
+
+    const FancyNameTag single(2, "Weber State University", columns.bios[1], BioAlloc::Heap);
+    EXPECT_EQ(batch.tags[1].getCompanyId(), single.getCompanyId());
+    EXPECT_EQ(batch.tags[1].getBio().year, single.getBio().year);
+    EXPECT_EQ(batch.tags[1].getBioAlloc(), BioAlloc::Heap);
+}
+
+TEST(FancyNameTagBatchTest, BatchTagsCopyAndDestroyLikeAnyOther) {
+    const Columns columns = validColumns(2);
+    FancyNameTagBatch batch = makeFancyNameTags(columns.ids, columns.companies, columns.bios, BioAlloc::Shared);
+
+    FancyNameTag copy = batch.tags[0];
+    EXPECT_EQ(batch.tags[0].getBioUseCount(), 2u);
+    batch.tags.clear();
+    EXPECT_EQ(copy.getBio().name, "Person 1");
+}
+
+TEST(FancyNameTagBatchTest, EmptyInputBuildsNothing) {
+    const FancyNameTagBatch batch = makeFancyNameTags({}, {}, std::span<const Bio>{});
+    EXPECT_TRUE(batch.tags.empty());
+    EXPECT_TRUE(batch.errors.empty());
+}
+
+// ==================== Per-row errors ====================
+
+TEST(FancyNameTagBatchTest, BadRowsAreReportedNotThrown) {
+    Columns columns = validColumns(6);
+    columns.ids[1] = 0;
+    columns.companies[3] = "";
+    columns.bios[4].title = "";
+    columns.bios[4].year = -1;
+
+    const FancyNameTagBatch batch = makeFancyNameTags(columns.ids, columns.companies, columns.bios);
+
+    ASSERT_EQ(batch.tags.size(), 3u);
+    EXPECT_EQ(batch.rows, (std::vector<std::size_t>{0, 2, 5}));
+    EXPECT_EQ(batch.tags[1].getId(), 3);
+
+    ASSERT_EQ(batch.errors.size(), 3u);
+    EXPECT_EQ(batch.errors[0].row, 1u);
+    EXPECT_TRUE(batch.errors[0].has(BatchProblem::BadId));
+    EXPECT_EQ(batch.errors[1].row, 3u);
+    EXPECT_TRUE(batch.errors[1].has(BatchProblem::EmptyCompany));
+    EXPECT_FALSE(batch.errors[1].has(BatchProblem::BadId));
+}
+
+TEST(FancyNameTagBatchTest, RowWithSeveralProblemsReportsAllOfThem) {
+    Columns columns = validColumns(1);
+    columns.bios[0].name = "";
+    columns.bios[0].title = "";
+    columns.bios[0].year = 0;
+
+    const FancyNameTagBatch batch = makeFancyNameTags(columns.ids, columns.companies, columns.bios);
+
+    ASSERT_EQ(batch.errors.size(), 1u);
+    EXPECT_TRUE(batch.errors[0].has(BatchProblem::EmptyBioName));
+    EXPECT_TRUE(batch.errors[0].has(BatchProblem::EmptyBioTitle));
+    EXPECT_TRUE(batch.errors[0].has(BatchProblem::BadBioYear));
+    EXPECT_EQ(batch.errors[0].describe(),
+              "row 0: bio name must not be empty; bio title must not be empty; bio year must be positive");
+}
+
+TEST(FancyNameTagBatchTest, MismatchedColumnsThrow) {
+    Columns columns = validColumns(3);
+    columns.companies.pop_back();
+    EXPECT_THROW(makeFancyNameTags(columns.ids, columns.companies, columns.bios), std::invalid_argument);
+}
+
+// ==================== Allocation ====================
+
+TEST(FancyNameTagBatchTest, MovedBiosAreNotCopied) {
+    if constexpr (!kCountersEnabled) {
+        GTEST_SKIP() << "counters are compiled out (NAMETAG_COUNTERS=OFF)";
+    }
+    Columns columns = validColumns(4);
+    columns.ids[2] = -3;
+    const InstanceCounts before = InstanceCounter<Bio>::snapshot();
+
+    const FancyNameTagBatch batch = makeFancyNameTags(columns.ids, columns.companies, std::move(columns.bios));
+
+    const InstanceCounts delta = InstanceCounter<Bio>::snapshot() - before;
+    EXPECT_EQ(batch.tags.size(), 3u);
+    EXPECT_EQ(delta.copies, 0u);
+    EXPECT_EQ(delta.moves, 3u) << "only the valid rows are moved from";
+    EXPECT_EQ(columns.bios[2].name, "Person 3") << "a rejected row's Bio is left alone";
+}
+
+TEST(FancyNameTagBatchTest, FailedAllocationLeaksNoBio) {
+    if constexpr (!kCountersEnabled) {
+        GTEST_SKIP() << "counters are compiled out (NAMETAG_COUNTERS=OFF)";
+    }
+    const Columns columns = validColumns(4);
+    // Fail the 1st allocation, then the 2nd, ... until the whole batch fits
+    for (std::size_t n = 1;; ++n) {
+        const std::int64_t liveBefore = InstanceCounter<Bio>::snapshot().live;
+        bool failed = false;
+        failAllocationOnThisThread(n);
+        try {
+            const FancyNameTagBatch batch =
+                makeFancyNameTags(columns.ids, columns.companies, columns.bios, BioAlloc::Heap);
+        } catch (const std::bad_alloc&) {
+            failed = true;
+        }
+        failAllocationOnThisThread(0);
+        EXPECT_EQ(InstanceCounter<Bio>::snapshot().live, liveBefore) << "allocation " << n << " failed";
+        if (!failed) {
+            break;
+        }
+    }
+}
+
+TEST(FancyNameTagBatchTest, PoolSlotsAreReservedInOneChunk) {
+    const std::size_t spare = BioPool::freeSlots();
+    const Columns columns = validColumns(static_cast<int>(spare) + 40);
+
+    const FancyNameTagBatch batch = makeFancyNameTags(columns.ids, columns.companies, columns.bios);
+
+    // reserve() allocated exactly the shortfall, and every slot went to a tag
+    EXPECT_EQ(BioPool::freeSlots(), 0u);
+    EXPECT_EQ(batch.tags.size(), spare + 40);
+}
+
+TEST(FancyNameTagBatchTest, CountsOneCreationAndAllocationPerTag) {
+    if constexpr (!kCountersEnabled) {
+        GTEST_SKIP() << "counters are compiled out (NAMETAG_COUNTERS=OFF)";
+    }
+    const Columns columns = validColumns(10);
+    const InstanceCounts before = InstanceCounter<FancyNameTag>::snapshot();
+
+    const FancyNameTagBatch batch = makeFancyNameTags(columns.ids, columns.companies, columns.bios);
+
+    const InstanceCounts delta = InstanceCounter<FancyNameTag>::snapshot() - before;
+    EXPECT_EQ(delta.created, 10u);
+    EXPECT_EQ(delta.moves + delta.copies, 0u) << "tags are built in place";
+    EXPECT_EQ(delta.heapBytes, 10 * bioAllocationBytes(BioAlloc::Pool));
+}
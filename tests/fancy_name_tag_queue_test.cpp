@@ -0,0 +1,235 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include "FancyNameTag.h"
+#include "FancyNameTagQueue.h"
+#include "InstanceCounters.h"
+
+// ==================== FancyNameTagQueue ====================
+
+namespace {
+
+FancyNameTag makeTag(int id) {
+    return FancyNameTag(id, "Weber State University",
+                        Bio{"Person " + std::to_string(id), "Professor", "Computer Science", 2010});
+}
+
+} // namespace
+
+TEST(FancyNameTagQueueTest, CapacityIsRoundedUpToAPowerOfTwo) {
+    EXPECT_EQ(FancyNameTagQueue(5).capacity(), 8u);
+    EXPECT_EQ(FancyNameTagQueue(64).capacity(), 64u);
+    EXPECT_EQ(FancyNameTagQueue(0).capacity(), 2u);
+}
+
+TEST(FancyNameTagQueueTest, FirstInFirstOut) {
+    FancyNameTagQueue queue(4);
+    for (int id = 1; id <= 3; ++id) {
+        ASSERT_TRUE(queue.tryPush(makeTag(id)));
+    }
+    EXPECT_EQ(queue.sizeApprox(), 3u);
+    for (int id = 1; id <= 3; ++id) {
+        const std::optional<FancyNameTag> tag = queue.tryPop();
+        ASSERT_TRUE(tag.has_value());
+        EXPECT_EQ(tag->getId(), id);
+        EXPECT_EQ(tag->getBio().name, "Person " + std::to_string(id));
+    }
+    EXPECT_FALSE(queue.tryPop().has_value());
+}
+
+TEST(FancyNameTagQueueTest, FullQueueLeavesTheTagAlone) {
+    FancyNameTagQueue queue(2);
+    ASSERT_TRUE(queue.tryPush(makeTag(1)));
+    ASSERT_TRUE(queue.tryPush(makeTag(2)));
+
+    FancyNameTag extra = makeTag(3);
+    const Bio* bio = &extra.getBio();
+    EXPECT_FALSE(queue.tryPush(std::move(extra)));
+    EXPECT_EQ(&extra.getBio(), bio) << "a failed push doesn't move from the tag";
+}
+
+TEST(FancyNameTagQueueTest, HandoffMovesTheBioAndNeverCopies) {
+    if constexpr (!kCountersEnabled) {
+        GTEST_SKIP() << "counters are compiled out (NAMETAG_COUNTERS=OFF)";
+    }
+    FancyNameTagQueue queue(8);
+    FancyNameTag tag = makeTag(1);
+    const Bio* bio = &tag.getBio();
+
+    const InstanceCounts tagsBefore = InstanceCounter<FancyNameTag>::snapshot();
+    const InstanceCounts biosBefore = InstanceCounter<Bio>::snapshot();
+    ASSERT_TRUE(queue.tryPush(std::move(tag)));
+    std::optional<FancyNameTag> out = queue.tryPop();
+    const InstanceCounts tags = InstanceCounter<FancyNameTag>::snapshot() - tagsBefore;
+    const InstanceCounts bios = InstanceCounter<Bio>::snapshot() - biosBefore;
+
+    ASSERT_TRUE(out.has_value());
+    EXPECT_EQ(&out->getBio(), bio) << "the same Bio came out the other side";
+    EXPECT_EQ(tags.copies, 0u);
+    EXPECT_EQ(bios.copies, 0u);
+    EXPECT_EQ(tags.moves, 2u) << "one move in, one move out";
+}
+
+TEST(FancyNameTagQueueTest, BatchPushTakesWhatFits) {
+    FancyNameTagQueue queue(4);
+    ASSERT_TRUE(queue.tryPush(makeTag(1)));
+
+    std::vector<FancyNameTag> batch;
+    for (int id = 2; id <= 6; ++id) {
+        batch.push_back(makeTag(id));
+    }
+    EXPECT_EQ(queue.tryPushBatch(batch), 3u);
+    EXPECT_EQ(batch[3].getBioUseCount(), 1u) << "tags that didn't fit are untouched";
+    EXPECT_EQ(batch[0].getBioUseCount(), 0u) << "tags that did were moved from";
+
+    std::vector<FancyNameTag> out;
+    EXPECT_EQ(queue.tryPopBatch(out, 10), 4u);
+    ASSERT_EQ(out.size(), 4u);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(out[i].getId(), i + 1);
+    }
+    EXPECT_EQ(queue.tryPopBatch(out, 10), 0u);
+}
+
+TEST(FancyNameTagQueueTest, WrapsAroundManyTimes) {
+    FancyNameTagQueue queue(4);
+    std::vector<FancyNameTag> out;
+    int next = 1;
+    int expected = 1;
+    for (int round = 0; round < 100; ++round) {
+        std::vector<FancyNameTag> batch;
+        batch.push_back(makeTag(next++));
+        batch.push_back(makeTag(next++));
+        batch.push_back(makeTag(next++));
+        ASSERT_EQ(queue.tryPushBatch(batch), 3u);
+        out.clear();
+        ASSERT_EQ(queue.tryPopBatch(out, 2), 2u);
+        ASSERT_EQ(out[0].getId(), expected++);
+        ASSERT_EQ(out[1].getId(), expected++);
+        ASSERT_EQ(queue.tryPop()->getId(), expected++);
+    }
+}
+
+TEST(FancyNameTagQueueTest, DestructorFreesLeftoverTags) {
+    if constexpr (!kCountersEnabled) {
+        GTEST_SKIP() << "counters are compiled out (NAMETAG_COUNTERS=OFF)";
+    }
+    const std::int64_t liveBefore = InstanceCounter<FancyNameTag>::snapshot().live;
+    {
+        FancyNameTagQueue queue(8);
+        queue.tryPush(makeTag(1));
+        queue.tryPush(makeTag(2));
+        EXPECT_EQ(InstanceCounter<FancyNameTag>::snapshot().live, liveBefore + 2);
+    }
+    EXPECT_EQ(InstanceCounter<FancyNameTag>::snapshot().live, liveBefore);
+}
+
+TEST(FancyNameTagQueueTest, CloseStopsPushesAndDrainsPops) {
+    FancyNameTagQueue queue(4);
+    ASSERT_TRUE(queue.push(makeTag(1)));
+    queue.close();
+
+    EXPECT_FALSE(queue.push(makeTag(2)));
+    EXPECT_FALSE(queue.tryPush(makeTag(3)));
+    ASSERT_TRUE(queue.pop().has_value()) << "what was queued before close() still comes out";
+    EXPECT_FALSE(queue.pop().has_value()) << "then pop() stops waiting";
+}
+
+TEST(FancyNameTagQueueTest, CloseWakesABlockedConsumer) {
+    FancyNameTagQueue queue(4, QueueWait::Block);
+    std::thread consumer([&] { EXPECT_FALSE(queue.pop().has_value()); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    queue.close();
+    consumer.join();
+}
+
+// ==================== Many producers, many consumers ====================
+
+namespace {
+
+// 3 producers mixing push() and pushBatch(), 3 consumers mixing pop() and
+// popBatch(), through a queue much smaller than the traffic
+void expectEveryTagArrivesOnce(QueueWait wait) {
+    constexpr int kProducers = 3;
+    constexpr int kConsumers = 3;
+    constexpr int kPerProducer = 2000;
+    FancyNameTagQueue queue(16, wait);
+
+    std::vector<std::vector<int>> received(kConsumers);
+    std::vector<std::thread> threads;
+    for (int p = 0; p < kProducers; ++p) {
+        threads.emplace_back([&queue, p] {
+            std::vector<FancyNameTag> batch;
+            for (int i = 0; i < kPerProducer; ++i) {
+                const int id = p * kPerProducer + i + 1;
+                if (i % 3 == 0) {
+                    ASSERT_TRUE(queue.push(makeTag(id)));
+                } else {
+                    batch.push_back(makeTag(id));
+                    if (batch.size() == 8) {
+                        ASSERT_EQ(queue.pushBatch(batch), 8u);
+                        batch.clear();
+                    }
+                }
+            }
+            ASSERT_EQ(queue.pushBatch(batch), batch.size());
+        });
+    }
+    std::atomic<int> finishedConsumers{0};
+    for (int c = 0; c < kConsumers; ++c) {
+        threads.emplace_back([&, c] {
+            std::vector<FancyNameTag> batch;
+            while (true) {
+                if (c == 0) {
+                    std::optional<FancyNameTag> tag = queue.pop();
+                    if (!tag) {
+                        break;
+                    }
+                    received[c].push_back(tag->getId());
+                } else {
+                    batch.clear();
+                    if (queue.popBatch(batch, 5) == 0) {
+                        break;
+                    }
+                    for (const FancyNameTag& tag : batch) {
+                        received[c].push_back(tag.getId());
+                    }
+                }
+            }
+            finishedConsumers.fetch_add(1);
+        });
+    }
+
+    for (int p = 0; p < kProducers; ++p) {
+        threads[p].join();
+    }
+    queue.close();
+    for (std::size_t t = kProducers; t < threads.size(); ++t) {
+        threads[t].join();
+    }
+
+    std::vector<int> all;
+    for (const std::vector<int>& ids : received) {
+        all.insert(all.end(), ids.begin(), ids.end());
+    }
+    std::sort(all.begin(), all.end());
+    ASSERT_EQ(all.size(), static_cast<std::size_t>(kProducers * kPerProducer));
+    for (std::size_t i = 0; i < all.size(); ++i) {
+        ASSERT_EQ(all[i], static_cast<int>(i + 1));
+    }
+    EXPECT_EQ(finishedConsumers.load(), kConsumers);
+}
+
+} // namespace
+
+TEST(FancyNameTagQueueTest, EveryTagArrivesOnceWhenSpinning) {
+    expectEveryTagArrivesOnce(QueueWait::Spin);
+}
+
+TEST(FancyNameTagQueueTest, EveryTagArrivesOnceWhenBlocking) {
+    expectEveryTagArrivesOnce(QueueWait::Block);
+}
@@ -0,0 +1,251 @@
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "CompanyTable.h"
+#include "FancyNameTag.h"
+#include "FancyNameTagReader.h"
+
+// ==================== FancyNameTagReader ====================
+
+namespace {
+
+// Everything the reader produced, with the chunks glued back together
+struct Ingested {
+    std::vector<FancyNameTag> tags;
+    std::vector<std::size_t> lines;
+    std::vector<IngestError> errors;
+    std::size_t chunks = 0;
+};
+
+Ingested ingest(const std::string& text, IngestOptions options = {}) {
+    std::istringstream in(text);
+    FancyNameTagReader reader(in, options);
+    Ingested all;
+    FancyNameTagChunk chunk;
+    while (reader.next(chunk)) {
+        ++all.chunks;
+        for (std::size_t i = 0; i < chunk.tags.size(); ++i) {
+            all.tags.push_back(std::move(chunk.tags[i]));
+            all.lines.push_back(chunk.lines[i]);
+        }
+        all.errors.insert(all.errors.end(), chunk.errors.begin(), chunk.errors.end());
+    }
+    return all;
+}
+
+std::string csvRows(int count) {
+    std::string text;
+    for (int id = 1; id <= count; ++id) {
+        text += std::to_string(id) + ",Weber State University,Person " + std::to_string(id) +
+                ",Professor,Computer Science," + std::to_string(2000 + id % 20) + "\n";
+    }
+    return text;
+}
+
+} // namespace
+
+TEST(FancyNameTagReaderTest, ReadsCsvRows) {
+    const Ingested result = ingest("1,Weber State University,Scott,Professor,Computer Science,2010\n"
+                                   "2,Utah Tech,Ann,Lecturer,Mathematics,2015\n");
+
+    ASSERT_EQ(result.tags.size(), 2u);
+    EXPECT_TRUE(result.errors.empty());
+    EXPECT_EQ(result.tags[0].getId(), 1);
+    EXPECT_EQ(result.tags[0].getCompany(), "Weber State University");
+    EXPECT_EQ(result.tags[0].getBio().name, "Scott");
+    EXPECT_EQ(result.tags[1].getBio().department, "Mathematics");
+    EXPECT_EQ(result.tags[1].getBio().year, 2015);
+    EXPECT_EQ(result.lines, (std::vector<std::size_t>{1, 2}));
+}
+
+TEST(FancyNameTagReaderTest, QuotedCsvFieldsMayContainCommasAndQuotes) {
+    const Ingested result = ingest("1,\"Acme, Inc.\",\"Scott \"\"Scotty\"\" Hermanson\",Professor,CS,2010\r\n");
+
+    ASSERT_EQ(result.tags.size(), 1u);
+    EXPECT_EQ(result.tags[0].getCompany(), "Acme, Inc.");
+    EXPECT_EQ(result.tags[0].getBio().name, "Scott \"Scotty\" Hermanson");
+    EXPECT_EQ(result.tags[0].getBio().year, 2010) << "the \\r of a CRLF line ending is dropped";
+}
+
+TEST(FancyNameTagReaderTest, SkipsHeaderAndBlankLines) {
+    IngestOptions options;
+    options.skipHeader = true;
+    const Ingested result = ingest("id,company,name,title,department,year\n"
+                                   "\n"
+                                   "7,WSU,Scott,Professor,CS,2010\n",
+                                   options);
+
+    ASSERT_EQ(result.tags.size(), 1u);
+    EXPECT_TRUE(result.errors.empty());
+    EXPECT_EQ(result.lines[0], 3u);
+}
+
+TEST(FancyNameTagReaderTest, BadLinesAreReportedAndTheStreamContinues) {
+    const Ingested result = ingest("1,WSU,Scott,Professor,CS,2010\n"
+                                   "0,WSU,Ann,Professor,CS,2010\n"      // id rule
+                                   "3,WSU,Bo,Professor,CS\n"            // 5 fields
+                                   "x,WSU,Cy,Professor,CS,2010\n"       // not a number
+                                   "5,,Di,,CS,-1\n"                     // three rules at once
+                                   "6,WSU,Ed,Professor,CS,2010\n");
+
+    ASSERT_EQ(result.tags.size(), 2u);
+    EXPECT_EQ(result.lines, (std::vector<std::size_t>{1, 6}));
+
+    ASSERT_EQ(result.errors.size(), 4u);
+    EXPECT_EQ(result.errors[0].line, 2u);
+    EXPECT_EQ(result.errors[0].message, "id must be positive");
+    EXPECT_EQ(result.errors[1].line, 3u);
+    EXPECT_EQ(result.errors[1].message, "expected 6 fields, got 5");
+    EXPECT_EQ(result.errors[2].line, 4u);
+    EXPECT_EQ(result.errors[2].message, "id is not a whole number: \"x\"");
+    EXPECT_EQ(result.errors[3].line, 5u);
+    EXPECT_EQ(result.errors[3].message,
+              "company must not be empty; bio title must not be empty; bio year must be positive");
+}
+
+TEST(FancyNameTagReaderTest, OutputKeepsInputOrderAcrossChunksAndWorkers) {
+    IngestOptions options;
+    options.chunkLines = 7;
+    options.workers = 4;
+    options.maxChunksInFlight = 3;
+    const Ingested result = ingest(csvRows(1000), options);
+
+    ASSERT_EQ(result.tags.size(), 1000u);
+    EXPECT_EQ(result.chunks, 143u); // ceil(1000 / 7)
+    for (std::size_t i = 0; i < result.tags.size(); ++i) {
+        ASSERT_EQ(result.tags[i].getId(), static_cast<int>(i + 1));
+        ASSERT_EQ(result.lines[i], i + 1);
+    }
+}
+
+TEST(FancyNameTagReaderTest, ReadsAheadOnlyAFewChunks) {
+    std::istringstream in(csvRows(1000));
+    IngestOptions options;
+    options.chunkLines = 10;
+    options.workers = 2;
+    options.maxChunksInFlight = 3;
+    FancyNameTagReader reader(in, options);
+
+    FancyNameTagChunk chunk;
+    ASSERT_TRUE(reader.next(chunk));
+    EXPECT_EQ(chunk.tags.size(), 10u);
+    EXPECT_EQ(reader.linesRead(), 30u) << "3 chunks read, 1 returned, 2 still in flight";
+}
+
+TEST(FancyNameTagReaderTest, StoppingEarlyIsSafe) {
+    std::istringstream in(csvRows(500));
+    IngestOptions options;
+    options.chunkLines = 5;
+    {
+        FancyNameTagReader reader(in, options);
+        FancyNameTagChunk chunk;
+        ASSERT_TRUE(reader.next(chunk));
+    }
+    SUCCEED() << "the destructor discarded the chunks in flight";
+}
+
+TEST(FancyNameTagReaderTest, EmptyInput) {
+    const Ingested result = ingest("");
+    EXPECT_TRUE(result.tags.empty());
+    EXPECT_EQ(result.chunks, 0u);
+}
+
+// ==================== JSON Lines ====================
+
+TEST(FancyNameTagReaderTest, ReadsJsonLines) {
+    IngestOptions options;
+    options.format = IngestFormat::JsonLines;
+    const Ingested result = ingest(
+        R"({"id": 1, "company": "WSU", "name": "Scott", "title": "Professor", "department": "CS", "year": 2010})"
+        "\n"
+        R"({"year":2015,"department":"Math","title":"Lecturer","name":"René \"R\"","company":"UT","id":2,"active":true})"
+        "\n",
+        options);
+
+    ASSERT_EQ(result.tags.size(), 2u) << (result.errors.empty() ? "" : result.errors[0].message);
+    EXPECT_EQ(result.tags[0].getBio().title, "Professor");
+    EXPECT_EQ(result.tags[1].getBio().name, "Ren\xC3\xA9 \"R\"") << "keys in any order, escapes decoded";
+    EXPECT_EQ(result.tags[1].getId(), 2);
+}
+
+TEST(FancyNameTagReaderTest, BadJsonLinesAreReported) {
+    IngestOptions options;
+    options.format = IngestFormat::JsonLines;
+    const Ingested result = ingest(
+        R"({"id": 1, "company": "WSU", "name": "Scott", "title": "Professor", "department": "CS"})" "\n"
+        R"({"id": 2.5, "company": "WSU", "name": "Scott", "title": "Professor", "department": "CS", "year": 1})" "\n"
+        R"({"id": 3, "company": "WSU", "name": "Scott", "title": "Professor")" "\n"
+        R"({"id": 4, "company": "WSU", "name": "", "title": "Professor", "department": "CS", "year": 1})" "\n",
+        options);
+
+    EXPECT_TRUE(result.tags.empty());
+    ASSERT_EQ(result.errors.size(), 4u);
+    EXPECT_EQ(result.errors[0].message, "missing \"year\"");
+    EXPECT_EQ(result.errors[1].message, "id is not a whole number: \"2.5\"");
+    EXPECT_EQ(result.errors[2].message, "expected ',' or '}'");
+    EXPECT_EQ(result.errors[3].message, "bio name must not be empty");
+}
+
+TEST(FancyNameTagReaderTest, OverLongLinesAreReportedAndSkipped) {
+    IngestOptions options;
+    options.maxLineBytes = 64;
+    const Ingested result = ingest("1,WSU,Scott,Professor,CS,2010\n" +
+                                   std::string(1000, 'x') + "\n"
+                                   "3,WSU,Ann,Lecturer,Math,2015\n" +
+                                   std::string(100, 'y'), // last line, no newline
+                                   options);
+
+    ASSERT_EQ(result.tags.size(), 2u);
+    EXPECT_EQ(result.lines, (std::vector<std::size_t>{1, 3}));
+    ASSERT_EQ(result.errors.size(), 2u);
+    EXPECT_EQ(result.errors[0].line, 2u);
+    EXPECT_EQ(result.errors[0].message, "line is longer than 64 bytes");
+    EXPECT_EQ(result.errors[1].line, 4u);
+}
+
+namespace {
+
+// Runs in a child process (see below): fills the CompanyTable, then reads rows
+// whose companies are half known, half new. Exits 0 if only the new ones failed.
+void ingestWithFullCompanyTable() {
+    CompanyTable::intern("Weber State University");
+    try {
+        for (int i = 0;; ++i) {
+            CompanyTable::intern("Filler " + std::to_string(i));
+        }
+    } catch (const std::length_error&) {
+        // full
+    }
+
+    IngestOptions options;
+    options.chunkLines = 2;
+    options.workers = 2;
+    std::string text;
+    for (int id = 1; id <= 8; ++id) {
+        const std::string company = id % 2 == 1 ? "Weber State University" : "New Company " + std::to_string(id);
+        text += std::to_string(id) + "," + company + ",Scott,Professor,CS,2010\n";
+    }
+    const Ingested result = ingest(text, options);
+
+    bool ok = result.lines == std::vector<std::size_t>{1, 3, 5, 7} && result.errors.size() == 4;
+    for (std::size_t i = 0; ok && i < result.errors.size(); ++i) {
+        ok = result.errors[i].line == 2 * (i + 1) &&
+             result.errors[i].message == "company table is full (too many distinct companies)";
+    }
+    if (!ok) {
+        std::cerr << "expected lines 2, 4, 6 and 8 to be rejected for a full company table\n";
+    }
+    std::exit(ok ? 0 : 1);
+}
+
+} // namespace
+
+TEST(FancyNameTagReaderTest, CompaniesBeyondTheTableLimitAreReportedPerLine) {
+    // A full CompanyTable can't be emptied again, so fill it in a child process
+    GTEST_FLAG_SET(death_test_style, "threadsafe");
+    EXPECT_EXIT(ingestWithFullCompanyTable(), ::testing::ExitedWithCode(0), "");
+}
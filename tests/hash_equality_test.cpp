@@ -0,0 +1,204 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <functional>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include "Bio.h"
+#include "FancyNameTag.h"
+#include "NameTag.h"
+
+// ==================== Bio ====================
+
+TEST(BioEqualityTest, ComparesContentsNotAddresses) {
+    const Bio a{"Scott", "Professor", "Computer Science", 2010};
+    const Bio b{"Scott", "Professor", "Computer Science", 2010};
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(std::hash<Bio>{}(a), std::hash<Bio>{}(b));
+
+    Bio later = a;
+    later.year = 2011;
+    EXPECT_NE(a, later);
+    EXPECT_LT(a, later) << "same name, title and department: the year decides";
+    EXPECT_LT(Bio({"Alice", "Zookeeper", "Z", 2020}), a) << "the name is compared first";
+}
+
+// ==================== NameTag ====================
+
+TEST(NameTagEqualityTest, EqualTagsHashTheSame) {
+    const NameTag a(1, "Waldo", "Weber State University");
+    const NameTag b(1, std::string("Wal") + "do", std::string("Weber State ") + "University");
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a.hash(), b.hash());
+    EXPECT_EQ(std::hash<NameTag>{}(a), a.hash());
+
+    EXPECT_NE(a, NameTag(2, "Waldo", "Weber State University"));
+    EXPECT_NE(a, NameTag(1, "Wally", "Weber State University"));
+    EXPECT_NE(a, NameTag(1, "Waldo", "Utah State University"));
+}
+
+TEST(NameTagEqualityTest, OrdersByIdThenNameThenCompanyName) {
+    // "Zulu Ordering Co" is interned first, so its CompanyId is smaller — but
+    // the order must follow the names, not the ids
+    const NameTag zulu(1, "Ann", "Zulu Ordering Co");
+    const NameTag alpha(1, "Ann", "Alpha Ordering Co");
+    ASSERT_LT(zulu.getCompanyId().value(), alpha.getCompanyId().value());
+    EXPECT_LT(alpha, zulu);
+    EXPECT_LT(NameTag(1, "Bob", "Alpha Corp"), NameTag(2, "Ann", "Alpha Corp"));
+    EXPECT_LT(NameTag(1, "Ann", "Zeta Corp"), NameTag(1, "Bob", "Alpha Corp"));
+    EXPECT_EQ(alpha <=> NameTag(1, "Ann", "Alpha Ordering Co"), std::strong_ordering::equal);
+}
+
+// Every setter must leave the cached hash equal to that of a freshly built tag
+TEST(NameTagEqualityTest, SettersUpdateTheCachedHash) {
+    NameTag tag(1, "Waldo", "Weber State University");
+    const std::uint32_t original = tag.hash();
+
+    tag.setId(7);
+    EXPECT_EQ(tag.hash(), NameTag(7, "Waldo", "Weber State University").hash());
+    tag.setName("Wenda");
+    EXPECT_EQ(tag.hash(), NameTag(7, "Wenda", "Weber State University").hash());
+    tag.setName(std::string("Odlaw"));
+    EXPECT_EQ(tag.hash(), NameTag(7, "Odlaw", "Weber State University").hash());
+    tag.setCompany("Acme");
+    EXPECT_EQ(tag, NameTag(7, "Odlaw", "Acme"));
+    EXPECT_EQ(tag.hash(), NameTag(7, "Odlaw", "Acme").hash());
+
+    tag.setId(1);
+    tag.setName("Waldo");
+    tag.setCompany("Weber State University");
+    EXPECT_EQ(tag.hash(), original);
+}
+
+TEST(NameTagEqualityTest, FailedSetterKeepsHash) {
+    NameTag tag(1, "Waldo", "WSU");
+    const std::uint32_t before = tag.hash();
+    EXPECT_THROW(tag.setName(""), std::invalid_argument);
+    EXPECT_THROW(tag.setId(0), std::invalid_argument);
+    EXPECT_EQ(tag.hash(), before);
+}
+
+TEST(NameTagEqualityTest, CopiesAreEqualAndAssignmentCarriesTheHash) {
+    const NameTag original(1, "Waldo", "WSU");
+    NameTag copy(original);
+    EXPECT_EQ(copy, original);
+
+    NameTag other(2, "Wenda", "Acme");
+    other = original;
+    EXPECT_EQ(other, original);
+    EXPECT_EQ(other.hash(), original.hash());
+
+    NameTag moved(3, "Odlaw", "Acme");
+    moved = std::move(copy);
+    EXPECT_EQ(moved, original);
+}
+
+// Like FancyNameTagEqualityTest.MovedFromTagsHaveNoBio: a moved-from tag's
+// cached hash describes what it holds after the move, not before
+TEST(NameTagEqualityTest, MovedFromTagsHashWhatTheyHold) {
+    NameTag a(1, "Waldo Wenceslas Whereabouts", "WSU");
+    NameTag b(1, "Wenda Wilhelmina Whereabouts", "WSU");
+    NameTag takenA(std::move(a));
+    NameTag takenB(2, "Odlaw", "Acme");
+    takenB = std::move(b);
+
+    ASSERT_EQ(a.getName(), b.getName()) << "both names were moved out the same way";
+    EXPECT_EQ(a, b) << "same id, company and (moved-out) name";
+    EXPECT_EQ(a.hash(), b.hash());
+    EXPECT_NE(a, takenA);
+    EXPECT_EQ(takenA.hash(), NameTag(1, "Waldo Wenceslas Whereabouts", "WSU").hash());
+}
+
+TEST(NameTagEqualityTest, DedupesInUnorderedSet) {
+    std::vector<NameTag> tags;
+    for (int i = 0; i < 300; ++i) {
+        tags.emplace_back(i % 100 + 1, "Person " + std::to_string(i % 100), i % 2 == 0 ? "WSU" : "Acme");
+    }
+    std::unordered_set<NameTag> unique(tags.begin(), tags.end());
+    EXPECT_EQ(unique.size(), 100u) << "i and i + 100 are the same tag (i % 100 has the same parity)";
+    EXPECT_EQ(unique.count(NameTag(5, "Person 4", "WSU")), 1u);
+    EXPECT_EQ(unique.count(NameTag(5, "Person 4", "Acme")), 0u);
+
+    // The ordering agrees with ==: sort + unique finds the same tags
+    std::sort(tags.begin(), tags.end());
+    tags.erase(std::unique(tags.begin(), tags.end()), tags.end());
+    EXPECT_EQ(tags.size(), unique.size());
+}
+
+// ==================== FancyNameTag ====================
+
+TEST(FancyNameTagEqualityTest, ComparesBioContentsNotPointers) {
+    const Bio bio{"Scott", "Professor", "Computer Science", 2010};
+    const FancyNameTag a(1, "WSU", bio);
+    const FancyNameTag b(1, "WSU", bio);
+    ASSERT_NE(&a.getBio(), &b.getBio());
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a.hash(), b.hash());
+    EXPECT_EQ(std::hash<FancyNameTag>{}(a), a.hash());
+
+    const FancyNameTag copy(a);
+    EXPECT_EQ(copy, a);
+    EXPECT_EQ(FancyNameTag(1, "WSU", bio, BioAlloc::Pool), a) << "how the Bio was allocated doesn't matter";
+
+    EXPECT_NE(a, FancyNameTag(2, "WSU", bio));
+    EXPECT_NE(a, FancyNameTag(1, "Acme", bio));
+    EXPECT_NE(a, FancyNameTag(1, "WSU", Bio{"Scott", "Dean", "Computer Science", 2010}));
+}
+
+TEST(FancyNameTagEqualityTest, SharedCopiesAreEqual) {
+    const FancyNameTag original(1, "WSU", Bio{"Scott", "Professor", "CS", 2010}, BioAlloc::Shared);
+    FancyNameTag copy(original);
+    EXPECT_EQ(copy, original);
+
+    copy.setBioTitle("Dean"); // copy-on-write: the copy gets its own Bio
+    EXPECT_NE(copy, original);
+    EXPECT_EQ(copy.hash(), FancyNameTag(1, "WSU", Bio{"Scott", "Dean", "CS", 2010}).hash());
+    EXPECT_EQ(original.hash(), FancyNameTag(1, "WSU", Bio{"Scott", "Professor", "CS", 2010}).hash());
+}
+
+TEST(FancyNameTagEqualityTest, SettersUpdateTheCachedHash) {
+    const Bio bio{"Scott", "Professor", "CS", 2010};
+    FancyNameTag tag(1, "WSU", bio);
+
+    tag.setId(2);
+    EXPECT_EQ(tag.hash(), FancyNameTag(2, "WSU", bio).hash());
+    tag.setCompany("Acme");
+    EXPECT_EQ(tag.hash(), FancyNameTag(2, "Acme", bio).hash());
+    tag.setBioTitle("Dean");
+    EXPECT_EQ(tag.hash(), FancyNameTag(2, "Acme", Bio{"Scott", "Dean", "CS", 2010}).hash());
+    tag.setBio(Bio{"Alice", "Engineer", "R&D", 2015});
+    EXPECT_EQ(tag, FancyNameTag(2, "Acme", Bio{"Alice", "Engineer", "R&D", 2015}));
+    EXPECT_EQ(tag.hash(), FancyNameTag(2, "Acme", Bio{"Alice", "Engineer", "R&D", 2015}).hash());
+}
+
+TEST(FancyNameTagEqualityTest, MovedFromTagsHaveNoBio) {
+    const Bio bio{"Scott", "Professor", "CS", 2010};
+    FancyNameTag a(1, "WSU", bio);
+    FancyNameTag b(1, "WSU", bio);
+    FancyNameTag takenA(std::move(a));
+    FancyNameTag takenB(2, "Acme", bio);
+    takenB = std::move(b);
+
+    EXPECT_EQ(takenA, takenB);
+    EXPECT_EQ(a, b) << "same id and company, and neither has a Bio";
+    EXPECT_EQ(a.hash(), b.hash());
+    EXPECT_NE(a, takenA);
+    EXPECT_LT(a, takenA) << "a tag without a Bio comes first";
+}
+
+TEST(FancyNameTagEqualityTest, OrdersByIdThenCompanyThenBio) {
+    const Bio ann{"Ann", "Engineer", "R&D", 2015};
+    const Bio bob{"Bob", "Engineer", "R&D", 2015};
+    EXPECT_LT(FancyNameTag(1, "Zeta Corp", bob), FancyNameTag(2, "Alpha Corp", ann));
+    EXPECT_LT(FancyNameTag(1, "Alpha Corp", bob), FancyNameTag(1, "Zeta Corp", ann));
+    EXPECT_LT(FancyNameTag(1, "Alpha Corp", ann), FancyNameTag(1, "Alpha Corp", bob));
+}
+
+TEST(FancyNameTagEqualityTest, DedupesInUnorderedSet) {
+    std::unordered_set<FancyNameTag> unique;
+    for (int i = 0; i < 200; ++i) {
+        unique.emplace(i % 50 + 1, "WSU", Bio{"Person " + std::to_string(i % 50), "Staff", "Ops", 2000});
+    }
+    EXPECT_EQ(unique.size(), 50u);
+    EXPECT_TRUE(unique.contains(FancyNameTag(3, "WSU", Bio{"Person 2", "Staff", "Ops", 2000})));
+}
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "AllocationCounter.h"
+#include "InlineFancyNameTag.h"
+
+// ==================== InlineFancyNameTag ====================
+
+TEST(InlineFancyNameTagTest, ShortBioIsStoredInline) {
+    Bio bio{"Scott", "Professor", "Computer Science", 2010};
+    InlineFancyNameTag tag(1, "Weber State Univ.", bio);
+
+    EXPECT_TRUE(tag.isBioInline());
+    EXPECT_EQ(tag.getBio().name, "Scott");
+
+    // The Bio's address is inside the tag object itself
+    const auto* begin = reinterpret_cast<const unsigned char*>(&tag);
+    const auto* bioAddr = reinterpret_cast<const unsigned char*>(&tag.getBio());
+    EXPECT_TRUE(bioAddr >= begin && bioAddr < begin + sizeof(tag));
+}
+
+TEST(InlineFancyNameTagTest, InlineLimitIsKMaxInlineChars) {
+    const std::string longest(InlineFancyNameTag::kMaxInlineChars, 'x');
+    EXPECT_TRUE(InlineFancyNameTag(1, "WSU", Bio{"Scott", "Professor", longest, 2010}).isBioInline());
+    EXPECT_FALSE(InlineFancyNameTag(1, "WSU", Bio{"Scott", "Professor", longest + "x", 2010}).isBioInline());
+}
+
+TEST(InlineFancyNameTagTest, LargeBioFallsBackToHeap) {
+    Bio bio{"Scott", "Professor", "School of Computing and Engineering", 2010};
+    InlineFancyNameTag tag(1, "Weber State Univ.", bio);
+    EXPECT_FALSE(tag.isBioInline());
+    EXPECT_EQ(tag.getBio().department, "School of Computing and Engineering");
+}
+
+TEST(InlineFancyNameTagTest, CopyConstructorDeepCopiesBio) {
+    Bio bio{"Scott", "Professor", "Computer Science", 2010};
+    InlineFancyNameTag original(1, "Weber State Univ.", bio);
+    InlineFancyNameTag copied(original);
+
+    EXPECT_EQ(copied.getBio().name, "Scott");
+    EXPECT_NE(&original.getBio(), &copied.getBio());
+    EXPECT_TRUE(copied.isBioInline());
+}
+
+TEST(InlineFancyNameTagTest, MoveConstructorLeavesSourceWithoutBio) {
+    Bio bio{"Scott", "Professor", "Computer Science", 2010};
+    InlineFancyNameTag original(1, "Weber State Univ.", bio);
+    InlineFancyNameTag moved(std::move(original));
+
+    EXPECT_EQ(moved.getBio().name, "Scott");
+    EXPECT_TRUE(moved.isBioInline());
+    EXPECT_FALSE(original.hasBio())
+        << "A moved-from tag must not keep a Bio (same as FancyNameTag's bio_ == nullptr)";
+}
+
+TEST(InlineFancyNameTagTest, MoveConstructorStealsHeapBio) {
+    Bio bio{"Scott", "Professor", "School of Computing and Engineering", 2010};
+    InlineFancyNameTag original(1, "Weber State Univ.", bio);
+    const Bio* originalBioAddr = &original.getBio();
+
+    InlineFancyNameTag moved(std::move(original));
+
+    EXPECT_EQ(&moved.getBio(), originalBioAddr)
+        << "A heap Bio should be transferred, not copied";
+    EXPECT_FALSE(original.hasBio());
+}
+
+TEST(InlineFancyNameTagTest, SetBioTitleCanMoveBioToHeap) {
+    Bio bio{"Scott", "Professor", "Computer Science", 2010};
+    InlineFancyNameTag tag(1, "Weber State Univ.", bio);
+    tag.setBioTitle("Associate Professor of Computing");
+
+    EXPECT_FALSE(tag.isBioInline());
+    EXPECT_EQ(tag.getBio().title, "Associate Professor of Computing");
+    EXPECT_EQ(tag.getBio().name, "Scott");
+}
+
+TEST(InlineFancyNameTagTest, SetBioTitleThatStillFitsAssignsInPlace) {
+    InlineFancyNameTag tag(1, "Weber State Univ.", Bio{"Scott", "Professor", "Computer Science", 2010});
+    const Bio* before = &tag.getBio();
+
+    // The title fits the string's own buffer, so no Bio is copied and nothing is allocated
+    EXPECT_EQ(allocationsDuring([&] { tag.setBioTitle("Dean"); }), 0u);
+    EXPECT_EQ(&tag.getBio(), before);
+    EXPECT_TRUE(tag.isBioInline());
+    EXPECT_EQ(tag.getBio().title, "Dean");
+}
+
+TEST(InlineFancyNameTagTest, FailedSetBioKeepsTheOldBio) {
+    const Bio longBio{"Scott", "Professor", "School of Computing and Engineering", 2010};
+    InlineFancyNameTag probe(1, "Weber State Univ.", Bio{"Scott", "Professor", "Computer Science", 2010});
+    // The last allocation setBio() makes is the heap Bio itself
+    const std::size_t allocations = allocationsDuring([&] { probe.setBio(longBio); });
+    ASSERT_GT(allocations, 0u);
+
+    InlineFancyNameTag tag(1, "Weber State Univ.", Bio{"Scott", "Professor", "Computer Science", 2010});
+    failAllocationOnThisThread(allocations);
+    EXPECT_THROW(tag.setBio(longBio), std::bad_alloc);
+
+    ASSERT_TRUE(tag.hasBio()) << "the old Bio must survive a failed allocation";
+    EXPECT_TRUE(tag.isBioInline());
+    EXPECT_EQ(tag.getBio().department, "Computer Science");
+}
+
+TEST(InlineFancyNameTagTest, VectorGrowthKeepsBios) {
+    std::vector<InlineFancyNameTag> tags;
+    for (int i = 1; i <= 20; ++i) {
+        tags.emplace_back(i, "Weber State Univ.", Bio{"Scott", "Professor", "Computer Science", 2000 + i});
+    }
+    for (int i = 1; i <= 20; ++i) {
+        EXPECT_EQ(tags[i - 1].getBio().year, 2000 + i);
+        EXPECT_TRUE(tags[i - 1].isBioInline());
+    }
+}
+
+TEST(InlineFancyNameTagTest, ConstructorRejectsInvalidData) {
+    EXPECT_THROW(InlineFancyNameTag(0, "WSU", Bio{"Scott", "Professor", "Computer Science", 2010}),
+                 std::invalid_argument);
+    EXPECT_THROW(InlineFancyNameTag(1, "WSU", Bio{"Scott", "", "Computing", 2010}),
+                 std::invalid_argument);
+}
+
+TEST(InlineFancyNameTagTest, ErrorsNameInlineFancyNameTag) {
+    try {
+        InlineFancyNameTag(0, "WSU", Bio{"Scott", "Professor", "Computer Science", 2010});
+        FAIL() << "expected std::invalid_argument";
+    } catch (const std::invalid_argument& error) {
+        EXPECT_EQ(std::string(error.what()), "InlineFancyNameTag id must be positive");
+    }
+}
@@ -0,0 +1,226 @@
+#include <gtest/gtest.h>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "FancyNameTag.h"
+#include "InlineFancyNameTag.h"
+#include "LifecycleRecorder.h"
+#include "NameTag.h"
+#include "Trace.h"
+
+// ==================== LifecycleRecorder ====================
+
+namespace {
+
+// One file per test, so tests run in parallel don't share a recording
+std::string recordingPath() {
+    return ::testing::TempDir() + "lifecycle_" +
+           ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".bin";
+}
+
+// Records whatever the function does and returns the decoded events
+template <typename Function>
+std::vector<LifecycleRecord> recordEvents(Function function) {
+    const std::string path = recordingPath();
+    {
+        LifecycleRecording recording(path);
+        function();
+    }
+    std::ifstream in(path, std::ios::binary);
+    return readLifecycleRecords(in);
+}
+
+std::size_t countKind(const std::vector<LifecycleRecord>& events, LifecycleKind kind) {
+    std::size_t count = 0;
+    for (const LifecycleRecord& record : events) {
+        if (record.event.kind == kind) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+} // namespace
+
+TEST(LifecycleRecorderTest, RecordsConstructCopyMoveDestroy) {
+    Bio bio{"Scott", "Professor", "Computer Science", 2010};
+    const auto events = recordEvents([&] {
+        FancyNameTag original(1, "Weber State University", bio);
+        FancyNameTag copy(original);
+        FancyNameTag moved(std::move(original));
+    });
+
+    ASSERT_EQ(events.size(), 6u);
+    EXPECT_EQ(countKind(events, LifecycleKind::Construct), 1u);
+    EXPECT_EQ(countKind(events, LifecycleKind::Copy), 1u);
+    EXPECT_EQ(countKind(events, LifecycleKind::Move), 1u);
+    EXPECT_EQ(countKind(events, LifecycleKind::Destroy), 3u);
+    EXPECT_EQ(LifecycleRecorder::writtenEvents(), 6u);
+    EXPECT_EQ(LifecycleRecorder::droppedEvents(), 0u);
+
+    // The move's source is the original and it took the original's Bio
+    const LifecycleEvent& construct = events[0].event;
+    const LifecycleEvent& move = events[2].event;
+    EXPECT_EQ(move.kind, LifecycleKind::Move);
+    EXPECT_EQ(move.source, construct.object);
+    EXPECT_EQ(move.bio, construct.bio);
+
+    // The constructor recorded the company and the Bio
+    EXPECT_EQ(events[0].company, "Weber State University");
+    EXPECT_EQ(events[0].name, "Scott");
+    EXPECT_EQ(events[0].title, "Professor");
+    EXPECT_EQ(events[0].department, "Computer Science");
+    EXPECT_EQ(construct.year, 2010);
+}
+
+TEST(LifecycleRecorderTest, RecordsNameTagConstruction) {
+    const auto events = recordEvents([] {
+        NameTag tag(7, "Waldo", "Weber State University");
+        NameTag copy(tag);
+    });
+
+    // NameTag only logs (and records) its constructor
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0].event.tag, LifecycleTag::NameTag);
+    EXPECT_EQ(events[0].event.id, 7);
+    EXPECT_EQ(events[0].name, "Waldo");
+    EXPECT_EQ(events[0].company, "Weber State University");
+}
+
+TEST(LifecycleRecorderTest, LongTextSpansSeveralRecords) {
+    const std::string department(200, 'd');
+    const auto events = recordEvents([&] {
+        FancyNameTag tag(1, "Weber State University", Bio{"Scott", "Professor", department, 2010});
+    });
+
+    ASSERT_EQ(events.size(), 2u);
+    EXPECT_EQ(events[0].event.kind, LifecycleKind::Construct);
+    EXPECT_EQ(events[0].department, department);
+    EXPECT_EQ(events[1].event.kind, LifecycleKind::Destroy);
+    EXPECT_EQ(events[1].department, department);
+    EXPECT_EQ(LifecycleRecorder::writtenEvents(), 2u);
+}
+
+TEST(LifecycleRecorderTest, TextSurvivesWrappingAroundTheRing) {
+    // Each tag takes 10 records (2 events with 4 text records each), so the
+    // ring wraps around several times and some text is split across its end
+    constexpr int kTags = static_cast<int>(LifecycleRecorder::kRingCapacity);
+    const std::string department(200, 'd');
+    const auto events = recordEvents([&] {
+        for (int i = 1; i <= kTags; ++i) {
+            FancyNameTag tag(i, "Weber State University", Bio{"Scott", "Professor", department, 2010});
+        }
+    });
+
+    // If the drainer fell behind, some events were dropped (never half-written)
+    EXPECT_EQ(events.size() + LifecycleRecorder::droppedEvents(), std::size_t{2 * kTags});
+    for (const LifecycleRecord& record : events) {
+        EXPECT_EQ(record.department, department);
+        EXPECT_EQ(record.event.year, 2010);
+    }
+}
+
+TEST(LifecycleRecorderTest, RecordsWithoutTimestamps) {
+    const std::string path = recordingPath();
+    {
+        LifecycleRecording recording(path, LifecycleTimestamps::Off);
+        FancyNameTag original(1, "Weber State University", Bio{"Scott", "Professor", "Computer Science", 2010});
+        FancyNameTag moved(std::move(original));
+    }
+    std::ifstream in(path, std::ios::binary);
+    const auto events = readLifecycleRecords(in);
+
+    // One thread, so the file order is the order things happened
+    ASSERT_EQ(events.size(), 4u);
+    EXPECT_EQ(events[0].event.kind, LifecycleKind::Construct);
+    EXPECT_EQ(events[1].event.kind, LifecycleKind::Move);
+    EXPECT_EQ(events[2].event.kind, LifecycleKind::Destroy);
+    EXPECT_EQ(events[3].event.kind, LifecycleKind::Destroy);
+    for (const LifecycleRecord& record : events) {
+        EXPECT_EQ(record.event.timestamp, 0u);
+    }
+}
+
+TEST(LifecycleRecorderTest, NothingIsRecordedWhenOff) {
+    EXPECT_FALSE(LifecycleRecorder::isRecording());
+    Bio bio{"Ann", "TA", "CS", 2020};
+    FancyNameTag before(1, "WSU", bio);
+    const auto events = recordEvents([] {});
+    EXPECT_TRUE(events.empty());
+}
+
+TEST(LifecycleRecorderTest, DecodedLinesMatchConsole) {
+    if constexpr (!kTraceEnabled) {
+        GTEST_SKIP() << "console trace is compiled out (NAMETAG_TRACE=NONE)";
+    }
+    const std::string longTitle(40, 't'); // too long for InlineFancyNameTag's buffer
+    std::stringstream console;
+    traceFlush();
+    std::streambuf* oldCout = std::cout.rdbuf(console.rdbuf());
+    const auto events = recordEvents([&] {
+        NameTag nameTag(1, "Waldo", "Weber State University");
+        FancyNameTag original(1, "Weber State University", Bio{"Scott", "Professor", "Computer Science", 2010});
+        FancyNameTag copy(original);
+        FancyNameTag moved(std::move(original));
+        InlineFancyNameTag inlineOriginal(2, "WSU", Bio{"Ann", "TA", "CS", 2020});
+        InlineFancyNameTag inlineCopy(inlineOriginal);
+        InlineFancyNameTag inlineMoved(std::move(inlineOriginal));
+        InlineFancyNameTag onHeap(3, "WSU", Bio{"Bo", longTitle, "CS", 2021});
+        copy = moved;
+        moved = std::move(copy);
+    });
+    traceFlush();
+    std::cout.rdbuf(oldCout);
+
+    std::string decoded;
+    for (const LifecycleRecord& record : events) {
+        appendLifecycleLine(decoded, record);
+    }
+    EXPECT_EQ(decoded, console.str());
+}
+
+TEST(LifecycleRecorderTest, EventsFromManyThreadsAreAllWritten) {
+    constexpr int kThreads = 4;
+    constexpr int kTagsPerThread = 200;
+    const auto events = recordEvents([] {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < kThreads; ++t) {
+            threads.emplace_back([t] {
+                for (int i = 0; i < kTagsPerThread; ++i) {
+                    FancyNameTag tag(t * kTagsPerThread + i + 1, "WSU", Bio{"Ann", "TA", "CS", 2020});
+                }
+            });
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    });
+
+    EXPECT_EQ(LifecycleRecorder::droppedEvents(), 0u);
+    EXPECT_EQ(countKind(events, LifecycleKind::Construct), std::size_t{kThreads * kTagsPerThread});
+    EXPECT_EQ(countKind(events, LifecycleKind::Destroy), std::size_t{kThreads * kTagsPerThread});
+    for (std::size_t i = 1; i < events.size(); ++i) {
+        EXPECT_LE(events[i - 1].event.timestamp, events[i].event.timestamp);
+    }
+}
+
+TEST(LifecycleRecorderTest, StartTwiceThrows) {
+    LifecycleRecording recording(recordingPath());
+    EXPECT_THROW(LifecycleRecorder::start(recordingPath()), std::logic_error);
+}
+
+TEST(LifecycleRecorderTest, UnwritableFileThrows) {
+    EXPECT_THROW(LifecycleRecorder::start(::testing::TempDir() + "no-such-dir/events.bin"),
+                 std::runtime_error);
+    EXPECT_FALSE(LifecycleRecorder::isRecording());
+}
+
+TEST(LifecycleRecorderTest, ReaderRejectsOtherFiles) {
+    std::istringstream notARecording("hello, world");
+    EXPECT_THROW(readLifecycleRecords(notARecording), std::runtime_error);
+}
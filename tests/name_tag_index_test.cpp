@@ -0,0 +1,222 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "NameTag.h"
+#include "NameTagIndex.h"
+
+// ==================== NameTagIndex ====================
+
+TEST(NameTagIndexTest, FindsTagsByIdAndByName) {
+    NameTagIndex index;
+    index.insert(NameTag(1, "Scott", "Weber State University"));
+    index.insert(NameTag(2, "Ann", "Utah Tech"));
+    index.insert(NameTag(3, "Scott", "Utah Tech"));
+
+    ASSERT_TRUE(index.findById(2).has_value());
+    EXPECT_EQ(index.findById(2)->getName(), "Ann");
+    EXPECT_FALSE(index.findById(4).has_value());
+    EXPECT_TRUE(index.contains(3));
+    EXPECT_EQ(index.size(), 3u);
+
+    EXPECT_EQ(index.idsByName("Scott", "Weber State University"), std::vector<int>{1});
+    EXPECT_EQ(index.idsByName("Scott", "Utah Tech"), std::vector<int>{3}) << "the company is part of the key";
+    EXPECT_EQ(index.countByName("Scott", "Nowhere Inc."), 0u) << "a company never interned matches nothing";
+}
+
+TEST(NameTagIndexTest, SharedNamesKeepInsertionOrder) {
+    NameTagIndex index;
+    for (int id : {40, 7, 99, 12}) {
+        index.insert(NameTag(id, "Pat", "WSU"));
+    }
+    EXPECT_EQ(index.idsByName("Pat", "WSU"), (std::vector<int>{40, 7, 99, 12}));
+    EXPECT_EQ(index.countByName("Pat", "WSU"), 4u);
+}
+
+TEST(NameTagIndexTest, DuplicateIdIsRejected) {
+    NameTagIndex index;
+    index.insert(NameTag(1, "Scott", "WSU"));
+    EXPECT_THROW(index.insert(NameTag(1, "Ann", "WSU")), std::invalid_argument);
+    EXPECT_EQ(index.countByName("Ann", "WSU"), 0u) << "the rejected tag left no name entry";
+}
+
+TEST(NameTagIndexTest, EraseRemovesBothKeys) {
+    NameTagIndex index;
+    index.insert(NameTag(1, "Scott", "WSU"));
+    index.insert(NameTag(2, "Scott", "WSU"));
+
+    EXPECT_TRUE(index.erase(1));
+    EXPECT_FALSE(index.erase(1));
+    EXPECT_FALSE(index.contains(1));
+    EXPECT_EQ(index.idsByName("Scott", "WSU"), std::vector<int>{2});
+}
+
+TEST(NameTagIndexTest, VisitByIdDoesNotCopy) {
+    NameTagIndex index;
+    index.insert(NameTag(5, "A name long enough to live on the heap", "WSU"));
+    const InstanceCounts before = InstanceCounter<NameTag>::snapshot();
+    std::size_t length = 0;
+    EXPECT_TRUE(index.visitById(5, [&](const NameTag& tag) { length = tag.getName().size(); }));
+    EXPECT_EQ(length, 38u);
+    EXPECT_EQ((InstanceCounter<NameTag>::snapshot() - before).copies, 0u);
+    EXPECT_FALSE(index.visitById(6, [](const NameTag&) { FAIL() << "no tag with id 6"; }));
+}
+
+// ==================== Mutations keep both keys in step ====================
+
+TEST(NameTagIndexTest, SetNameMovesTheNameKey) {
+    NameTagIndex index;
+    index.insert(NameTag(1, "Scott", "WSU"));
+    index.setName(1, "Scotty");
+
+    EXPECT_EQ(index.countByName("Scott", "WSU"), 0u);
+    EXPECT_EQ(index.idsByName("Scotty", "WSU"), std::vector<int>{1});
+    EXPECT_EQ(index.findById(1)->getName(), "Scotty");
+}
+
+TEST(NameTagIndexTest, SetCompanyMovesTheNameKey) {
+    NameTagIndex index;
+    index.insert(NameTag(1, "Scott", "WSU"));
+    index.setCompany(1, "Utah Tech");
+
+    EXPECT_EQ(index.countByName("Scott", "WSU"), 0u);
+    EXPECT_EQ(index.idsByName("Scott", "Utah Tech"), std::vector<int>{1});
+    EXPECT_EQ(index.findById(1)->getCompany(), "Utah Tech");
+}
+
+TEST(NameTagIndexTest, SetIdMovesTheIdKey) {
+    NameTagIndex index;
+    index.insert(NameTag(1, "Scott", "WSU"));
+    index.insert(NameTag(2, "Ann", "WSU"));
+    index.setId(1, 1000);
+
+    EXPECT_FALSE(index.contains(1));
+    EXPECT_EQ(index.findById(1000)->getName(), "Scott");
+    EXPECT_EQ(index.idsByName("Scott", "WSU"), std::vector<int>{1000});
+    EXPECT_EQ(index.size(), 2u);
+}
+
+namespace {
+
+// Same formula as NameTagIndex::idShardIndex()
+std::size_t idShardOf(int id) {
+    return (static_cast<std::uint32_t>(id) * 0x9E3779B9u) >> 26;
+}
+
+} // namespace
+
+// Every id here lands in one shard, and every setId() re-keys within it.
+// The shard's map grows by one tag per step, so some re-key's emplace is the
+// one that pushes the map past its load factor and rehashes it.
+TEST(NameTagIndexTest, SetIdWithinOneShardSurvivesARehash) {
+    std::vector<int> sameShard;
+    for (int id = 1; sameShard.size() < 402; ++id) {
+        if (idShardOf(id) == idShardOf(1)) {
+            sameShard.push_back(id);
+        }
+    }
+
+    NameTagIndex index;
+    for (std::size_t i = 0; i + 1 < sameShard.size(); i += 2) {
+        index.insert(NameTag(sameShard[i], "Scott", "WSU"));
+        index.setId(sameShard[i], sameShard[i + 1]);
+        ASSERT_FALSE(index.contains(sameShard[i]));
+        ASSERT_EQ(index.findById(sameShard[i + 1])->getId(), sameShard[i + 1]);
+    }
+    EXPECT_EQ(index.size(), sameShard.size() / 2);
+    EXPECT_EQ(index.countByName("Scott", "WSU"), sameShard.size() / 2);
+}
+
+TEST(NameTagIndexTest, FailedMutationsChangeNothing) {
+    NameTagIndex index;
+    index.insert(NameTag(1, "Scott", "WSU"));
+    index.insert(NameTag(2, "Ann", "WSU"));
+
+    EXPECT_THROW(index.setId(1, 2), std::invalid_argument) << "2 is taken";
+    EXPECT_THROW(index.setId(1, -5), std::invalid_argument) << "NameTag's own rule";
+    EXPECT_THROW(index.setName(1, ""), std::invalid_argument);
+    EXPECT_THROW(index.setCompany(1, ""), std::invalid_argument);
+    EXPECT_THROW(index.setName(3, "Nobody"), std::invalid_argument) << "no tag 3";
+
+    EXPECT_EQ(index.findById(1)->getName(), "Scott");
+    EXPECT_EQ(index.idsByName("Scott", "WSU"), std::vector<int>{1});
+    EXPECT_EQ(index.size(), 2u);
+}
+
+// ==================== Concurrency ====================
+
+TEST(NameTagIndexTest, ReadersOnlySeeWholeRenames) {
+    constexpr int kTags = 200;
+    NameTagIndex index;
+    for (int id = 1; id <= kTags; ++id) {
+        index.insert(NameTag(id, "even", "WSU"));
+    }
+
+    std::atomic<bool> done{false};
+    std::atomic<int> mismatches{0};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&] {
+            while (!done.load()) {
+                for (const char* name : {"even", "odd"}) {
+                    // A rename moves an id between lists under both locks,
+                    // so one list never holds an id twice or too many ids
+                    std::vector<int> ids = index.idsByName(name, "WSU");
+                    std::sort(ids.begin(), ids.end());
+                    if (ids.size() > static_cast<std::size_t>(kTags) ||
+                        std::adjacent_find(ids.begin(), ids.end()) != ids.end()) {
+                        mismatches.fetch_add(1);
+                    }
+                }
+                for (int id = 1; id <= kTags; ++id) {
+                    index.visitById(id, [&](const NameTag& tag) {
+                        if (tag.getName() != "even" && tag.getName() != "odd") {
+                            mismatches.fetch_add(1);
+                        }
+                    });
+                }
+            }
+        });
+    }
+
+    for (int round = 0; round < 50; ++round) {
+        for (int id = 1; id <= kTags; ++id) {
+            index.setName(id, round % 2 == 0 ? "odd" : "even");
+        }
+    }
+    done.store(true);
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(mismatches.load(), 0);
+    EXPECT_EQ(index.countByName("even", "WSU") + index.countByName("odd", "WSU"),
+              static_cast<std::size_t>(kTags));
+    EXPECT_EQ(index.countByName("even", "WSU"), static_cast<std::size_t>(kTags)) << "50 rounds end on even";
+}
+
+TEST(NameTagIndexTest, ConcurrentWritersOnDifferentTags) {
+    NameTagIndex index;
+    std::vector<std::thread> writers;
+    for (int w = 0; w < 4; ++w) {
+        writers.emplace_back([&index, w] {
+            for (int i = 1; i <= 500; ++i) {
+                const int id = w * 1000 + i;
+                index.insert(NameTag(id, "Worker " + std::to_string(w), "WSU"));
+                index.setId(id, id + 100000);
+                index.setName(id + 100000, "Renamed");
+            }
+        });
+    }
+    for (std::thread& writer : writers) {
+        writer.join();
+    }
+    EXPECT_EQ(index.size(), 2000u);
+    EXPECT_EQ(index.countByName("Renamed", "WSU"), 2000u);
+    EXPECT_EQ(index.countByName("Worker 0", "WSU"), 0u);
+}
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include <new>
+#include <sstream>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "AllocationCounter.h"
+#include "NameTagRegistry.h"
+
+// ==================== NameTagRegistry ====================
+
+namespace {
+
+NameTagRegistry makeRegistry() {
+    NameTagRegistry registry;
+    registry.add(1, "Waldo", "Weber State Univ.");
+    registry.add(2, "Scott", "The School of Computing");
+    registry.add(3, "Alice", "Weber State Univ.");
+    registry.add(10, "Bob", "Acme");
+    return registry;
+}
+
+} // namespace
+
+TEST(NameTagRegistryTest, AddAndLookup) {
+    NameTagRegistry registry = makeRegistry();
+    ASSERT_EQ(registry.size(), 4u);
+
+    std::optional<NameTagView> found = registry.findById(2);
+    ASSERT_TRUE(found.has_value());
+    EXPECT_EQ(found->getName(), "Scott");
+    EXPECT_EQ(found->getCompany(), "The School of Computing");
+    EXPECT_FALSE(registry.findById(99).has_value());
+}
+
+TEST(NameTagRegistryTest, AddValidatesLikeNameTag) {
+    NameTagRegistry registry;
+    EXPECT_THROW(registry.add(0, "Waldo", "WSU"), std::invalid_argument);
+    EXPECT_THROW(registry.add(1, "", "WSU"), std::invalid_argument);
+    EXPECT_THROW(registry.add(1, "Waldo", ""), std::invalid_argument);
+    EXPECT_TRUE(registry.empty());
+}
+
+TEST(NameTagRegistryTest, AddRejectsMovedFromNameTag) {
+    NameTagRegistry registry;
+    NameTag tag(1, "Waldo", "Weber State Univ.");
+    NameTag taken(std::move(tag));
+    EXPECT_THROW(registry.add(tag), std::invalid_argument);
+    EXPECT_EQ(registry.add(taken), 0u);
+    EXPECT_EQ(registry.size(), 1u);
+}
+
+TEST(NameTagRegistryTest, FailedAddLeavesColumnsInStep) {
+    NameTagRegistry registry = makeRegistry();
+    // Too long for the small-string buffer, so copying it allocates
+    const std::string longName(100, 'n');
+    failAllocationOnThisThread(1);
+    EXPECT_THROW(registry.add(20, longName, "Acme"), std::bad_alloc);
+
+    ASSERT_EQ(registry.size(), 4u);
+    for (const NameTagView row : registry) {
+        EXPECT_FALSE(row.getName().empty());
+    }
+    EXPECT_EQ(registry.add(20, longName, "Acme"), 4u);
+    EXPECT_EQ(registry.at(4).getName(), longName);
+}
+
+TEST(NameTagRegistryTest, RemoveMovesLastRowIntoHole) {
+    NameTagRegistry registry = makeRegistry();
+    EXPECT_TRUE(registry.removeById(1));
+    EXPECT_FALSE(registry.removeById(1));
+
+    ASSERT_EQ(registry.size(), 3u);
+    EXPECT_EQ(registry.at(0).getId(), 10) << "the last row fills the removed row's slot";
+    EXPECT_FALSE(registry.findById(1).has_value());
+}
+
+TEST(NameTagRegistryTest, IteratorVisitsEveryRow) {
+    NameTagRegistry registry = makeRegistry();
+    std::vector<int> ids;
+    for (NameTagView view : registry) {
+        ids.push_back(view.getId());
+    }
+    EXPECT_EQ(ids, (std::vector<int>{1, 2, 3, 10}));
+}
+
+TEST(NameTagRegistryTest, ScansByIdRange) {
+    NameTagRegistry registry = makeRegistry();
+    EXPECT_EQ(registry.countIdInRange(2, 10), 3u);
+    EXPECT_EQ(registry.rowsWithIdInRange(1, 2), (std::vector<std::size_t>{0, 1}));
+}
+
+TEST(NameTagRegistryTest, ScansByCompany) {
+    NameTagRegistry registry = makeRegistry();
+    EXPECT_EQ(registry.countCompany("Weber State Univ."), 2u);
+    EXPECT_EQ(registry.rowsWithCompany("Acme"), (std::vector<std::size_t>{3}));
+    EXPECT_EQ(registry.countCompany("Nobody"), 0u);
+}
+
+TEST(NameTagRegistryTest, ViewConvertsToNameTag) {
+    NameTagRegistry registry = makeRegistry();
+
+    // toNameTag() runs NameTag's constructor, which logs — keep the test output clean
+    std::stringstream buffer;
+    std::streambuf* oldCout = std::cout.rdbuf(buffer.rdbuf());
+    NameTag tag = registry.at(1).toNameTag();
+    std::cout.rdbuf(oldCout);
+
+    EXPECT_EQ(tag.getId(), 2);
+    EXPECT_EQ(tag.getName(), "Scott");
+    EXPECT_EQ(tag.getCompany(), "The School of Computing");
+}
@@ -0,0 +1,222 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "FancyNameTag.h"
+#include "RosterSnapshot.h"
+#include "WorkStealingPool.h"
+
+// ==================== WorkStealingPool ====================
+
+TEST(WorkStealingPoolTest, ParallelForVisitsEveryIndexOnce) {
+    WorkStealingPool pool(4);
+    std::vector<std::atomic<int>> visits(10000);
+    pool.parallelFor(visits.size(), 37, [&](std::size_t begin, std::size_t end) {
+        EXPECT_LE(end - begin, 37u);
+        for (std::size_t i = begin; i < end; ++i) {
+            visits[i].fetch_add(1);
+        }
+    });
+    for (std::size_t i = 0; i < visits.size(); ++i) {
+        ASSERT_EQ(visits[i].load(), 1) << "index " << i;
+    }
+}
+
+TEST(WorkStealingPoolTest, IdleWorkersStealRanges) {
+    WorkStealingPool pool(4);
+    // The whole loop starts on one worker; every other worker only gets
+    // ranges by stealing them
+    pool.parallelFor(64, 1, [](std::size_t, std::size_t) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    });
+    EXPECT_GT(pool.steals(), 0u);
+}
+
+TEST(WorkStealingPoolTest, ParallelForRethrowsFirstException) {
+    WorkStealingPool pool(3);
+    std::atomic<int> ran{0};
+    // 128 halves evenly into 16 ranges of 8
+    EXPECT_THROW(pool.parallelFor(128, 8,
+                                  [&](std::size_t begin, std::size_t) {
+                                      ran.fetch_add(1);
+                                      if (begin == 64) {
+                                          throw std::runtime_error("range 64");
+                                      }
+                                  }),
+                 std::runtime_error);
+    EXPECT_EQ(ran.load(), 16) << "the other ranges still ran";
+}
+
+TEST(WorkStealingPoolTest, NestedParallelForDoesNotDeadlock) {
+    WorkStealingPool pool(2);
+    std::atomic<int> inner{0};
+    pool.parallelFor(8, 1, [&](std::size_t, std::size_t) {
+        pool.parallelFor(100, 10, [&](std::size_t begin, std::size_t end) {
+            inner.fetch_add(static_cast<int>(end - begin));
+        });
+    });
+    EXPECT_EQ(inner.load(), 800);
+}
+
+TEST(WorkStealingPoolTest, DestructorRunsSubmittedTasks) {
+    std::atomic<int> ran{0};
+    {
+        WorkStealingPool pool(2);
+        for (int i = 0; i < 100; ++i) {
+            pool.submit([&] { ran.fetch_add(1); });
+        }
+    }
+    EXPECT_EQ(ran.load(), 100);
+}
+
+TEST(WorkStealingPoolTest, CurrentWorker) {
+    WorkStealingPool pool(2);
+    EXPECT_EQ(pool.currentWorker(), pool.size()) << "the test thread is not a worker";
+    std::atomic<std::size_t> seen{99};
+    pool.parallelFor(1, 1, [&](std::size_t, std::size_t) { seen = pool.currentWorker(); });
+    EXPECT_LT(seen.load(), pool.size());
+}
+
+// ==================== parallelSnapshot ====================
+
+namespace {
+
+std::vector<FancyNameTag> makeRoster(int count, BioAlloc alloc) {
+    std::vector<FancyNameTag> tags;
+    tags.reserve(count);
+    for (int id = 1; id <= count; ++id) {
+        tags.emplace_back(id, "Weber State University",
+                          Bio{"Person " + std::to_string(id), "Professor", "Computer Science", 2000 + id % 20},
+                          alloc);
+    }
+    return tags;
+}
+
+} // namespace
+
+TEST(ParallelSnapshotTest, CopiesEveryTagInOrder) {
+    const std::vector<FancyNameTag> roster = makeRoster(5000, BioAlloc::Heap);
+    WorkStealingPool pool(4);
+    const FancyNameTagSnapshot snapshot = parallelSnapshot(roster, pool);
+
+    ASSERT_EQ(snapshot.size(), roster.size());
+    for (std::size_t i = 0; i < roster.size(); ++i) {
+        ASSERT_EQ(snapshot[i].id, roster[i].getId());
+        ASSERT_EQ(snapshot[i].company, roster[i].getCompanyId());
+        ASSERT_EQ(snapshot[i].getBio().name, roster[i].getBio().name);
+        ASSERT_EQ(snapshot[i].getBio().year, roster[i].getBio().year);
+        ASSERT_NE(snapshot[i].bio, &roster[i].getBio()) << "deep copy, not the same Bio";
+    }
+    EXPECT_EQ(snapshot[0].getCompany(), "Weber State University");
+}
+
+TEST(ParallelSnapshotTest, SnapshotDoesNotChangeWithTheOriginals) {
+    std::vector<FancyNameTag> roster = makeRoster(100, BioAlloc::Shared);
+    WorkStealingPool pool(2);
+    const FancyNameTagSnapshot snapshot = parallelSnapshot(roster, pool);
+
+    EXPECT_EQ(roster[0].getBioUseCount(), 1u) << "the snapshot holds no reference";
+    roster[0].setBioTitle("Dean");
+    roster.clear();
+    EXPECT_EQ(snapshot[0].getBio().title, "Professor");
+}
+
+TEST(ParallelSnapshotTest, EachRangeCopiesIntoOneBlock) {
+    const std::vector<FancyNameTag> roster = makeRoster(64, BioAlloc::Heap);
+    WorkStealingPool pool(2);
+    // 64 halves evenly into 4 ranges of 16
+    const FancyNameTagSnapshot snapshot = parallelSnapshot(roster, pool, 16);
+
+    EXPECT_EQ(snapshot.blockCount(), 4u);
+    for (std::size_t range = 0; range < 4; ++range) {
+        const Bio* first = snapshot[range * 16].bio;
+        for (std::size_t i = 1; i < 16; ++i) {
+            ASSERT_EQ(snapshot[range * 16 + i].bio, first + i) << "Bios of a range sit side by side";
+        }
+    }
+}
+
+TEST(ParallelSnapshotTest, MovedFromTagsHaveNoBio) {
+    std::vector<FancyNameTag> roster = makeRoster(3, BioAlloc::Heap);
+    FancyNameTag taken(std::move(roster[1]));
+    WorkStealingPool pool(1);
+    const FancyNameTagSnapshot snapshot = parallelSnapshot(roster, pool);
+
+    EXPECT_NE(snapshot[0].bio, nullptr);
+    EXPECT_EQ(snapshot[1].bio, nullptr);
+    EXPECT_EQ(snapshot[2].getBio().name, "Person 3");
+}
+
+TEST(ParallelSnapshotTest, MovedFromEntryHasNoBioToRead) {
+    std::vector<FancyNameTag> roster = makeRoster(3, BioAlloc::Heap);
+    FancyNameTag taken(std::move(roster[1]));
+    WorkStealingPool pool(1);
+    const FancyNameTagSnapshot snapshot = parallelSnapshot(roster, pool);
+
+    EXPECT_THROW(snapshot[1].getBio(), std::logic_error);
+}
+
+TEST(ParallelSnapshotTest, MovedFromEntryDoesNotPromote) {
+    std::vector<FancyNameTag> roster = makeRoster(3, BioAlloc::Heap);
+    FancyNameTag taken(std::move(roster[1]));
+    WorkStealingPool pool(1);
+    const FancyNameTagSnapshot snapshot = parallelSnapshot(roster, pool);
+
+    EXPECT_THROW(snapshot[1].toFancyNameTag(), std::logic_error);
+    EXPECT_EQ(snapshot[2].toFancyNameTag().getId(), 3);
+}
+
+TEST(ParallelSnapshotTest, EntriesPromoteToFancyNameTags) {
+    const std::vector<FancyNameTag> roster = makeRoster(10, BioAlloc::Heap);
+    WorkStealingPool pool(2);
+    const FancyNameTagSnapshot snapshot = parallelSnapshot(roster, pool);
+
+    FancyNameTag tag = snapshot[4].toFancyNameTag(BioAlloc::Pool);
+    EXPECT_EQ(tag.getId(), 5);
+    EXPECT_EQ(tag.getBio().name, "Person 5");
+    EXPECT_EQ(tag.getBioAlloc(), BioAlloc::Pool);
+    EXPECT_NE(&tag.getBio(), snapshot[4].bio);
+}
+
+TEST(ParallelSnapshotTest, SnapshotIsMoveOnlyAndOwnsItsBios) {
+    const std::vector<FancyNameTag> roster = makeRoster(10, BioAlloc::Heap);
+    WorkStealingPool pool(2);
+    FancyNameTagSnapshot first = parallelSnapshot(roster, pool);
+    const Bio* bio = first[9].bio;
+    FancyNameTagSnapshot second = std::move(first);
+
+    EXPECT_TRUE(first.empty());
+    EXPECT_EQ(first.blockCount(), 0u);
+    ASSERT_EQ(second.size(), 10u);
+    EXPECT_EQ(second.tags().back().bio, bio) << "moving the snapshot moves no Bio";
+    static_assert(!std::is_copy_constructible_v<FancyNameTagSnapshot>);
+}
+
+TEST(ParallelSnapshotTest, EmptyRoster) {
+    WorkStealingPool pool(2);
+    const FancyNameTagSnapshot snapshot = parallelSnapshot({}, pool);
+    EXPECT_TRUE(snapshot.empty());
+    EXPECT_EQ(snapshot.begin(), snapshot.end());
+}
+
+TEST(ParallelSnapshotTest, SnapshotLeavesNoBiosBehind) {
+    if constexpr (!kCountersEnabled) {
+        GTEST_SKIP() << "counters are compiled out (NAMETAG_COUNTERS=OFF)";
+    }
+    const std::vector<FancyNameTag> roster = makeRoster(1000, BioAlloc::Heap);
+    const InstanceCounts before = InstanceCounter<Bio>::snapshot();
+    {
+        WorkStealingPool pool(3);
+        const FancyNameTagSnapshot snapshot = parallelSnapshot(roster, pool);
+        const InstanceCounts during = InstanceCounter<Bio>::snapshot() - before;
+        EXPECT_EQ(during.copies, 1000u);
+        EXPECT_EQ(during.live, 1000);
+    }
+    const InstanceCounts after = InstanceCounter<Bio>::snapshot() - before;
+    EXPECT_EQ(after.destroyed, 1000u);
+    EXPECT_EQ(after.live, 0);
+}
@@ -0,0 +1,269 @@
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <iostream>
+#include <memory_resource>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Bio.h"
+#include "PmrTags.h"
+
+// ==================== PMR-aware Bio, NameTag and FancyNameTag ====================
+
+namespace {
+
+// Runs a function with std::cout redirected and returns what it printed
+template <typename Function>
+std::string captureCout(Function function) {
+    std::stringstream buffer;
+    std::streambuf* oldCout = std::cout.rdbuf(buffer.rdbuf());
+    function();
+    std::cout.rdbuf(oldCout);
+    return buffer.str();
+}
+
+// A memory_resource that counts what it hands out, on top of new/delete
+class CountingResource : public std::pmr::memory_resource {
+public:
+    std::size_t allocations = 0;
+    std::size_t liveBytes = 0;
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        ++allocations;
+        liveBytes += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+        liveBytes -= bytes;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+// Makes a CountingResource the default resource for one test, so a test can
+// also check that nothing was allocated from the default
+class PmrTagsTest : public ::testing::Test {
+protected:
+    void SetUp() override { previous_ = std::pmr::set_default_resource(&defaultResource); }
+    void TearDown() override { std::pmr::set_default_resource(previous_); }
+
+    CountingResource defaultResource;
+    CountingResource a;
+    CountingResource b;
+
+private:
+    std::pmr::memory_resource* previous_ = nullptr;
+};
+
+// Every string is too long for the small-string buffer, so each one is an allocation
+const Bio kBio{"Scott Hermanson the Third", "Distinguished Professor", "School of Computing Science", 2010};
+const char* const kCompany = "Weber State University";
+const char* const kLongName = "Waldo Wenceslas Whereabouts";
+
+} // namespace
+
+// ----- Where things are allocated -----
+
+TEST_F(PmrTagsTest, BioStringsComeFromTheResource) {
+    const PmrBio bio(kBio, &a);
+    EXPECT_EQ(a.allocations, 3u);
+    EXPECT_EQ(defaultResource.allocations, 0u);
+    EXPECT_EQ(bio.get_allocator().resource(), &a);
+    EXPECT_EQ(bio.toBio(), kBio);
+
+    std::string fromPmr;
+    std::string fromBio;
+    bio.appendTo(fromPmr);
+    kBio.appendTo(fromBio);
+    EXPECT_EQ(fromPmr, fromBio);
+    EXPECT_EQ(captureCout([&] { bio.print(); }), captureCout([&] { kBio.print(); }));
+}
+
+TEST_F(PmrTagsTest, NameTagNameComesFromTheResource) {
+    PmrNameTag tag(1, kLongName, kCompany, &a);
+    EXPECT_EQ(a.allocations, 1u);
+    EXPECT_EQ(defaultResource.allocations, 0u);
+    EXPECT_EQ(tag.getName(), kLongName);
+    EXPECT_EQ(tag.getCompany(), kCompany);
+
+    tag.setName("An even longer replacement name for Waldo");
+    EXPECT_EQ(a.allocations, 2u) << "the setter's new buffer comes from the same resource";
+    EXPECT_EQ(defaultResource.allocations, 0u);
+}
+
+TEST_F(PmrTagsTest, FancyNameTagBioAndItsStringsComeFromTheResource) {
+    {
+        PmrFancyNameTag tag(1, kCompany, kBio, &a);
+        EXPECT_EQ(a.allocations, 4u) << "the Bio itself and its three strings";
+        EXPECT_EQ(defaultResource.allocations, 0u);
+        EXPECT_EQ(tag.getBio().get_allocator().resource(), &a);
+
+        tag.setBioTitle("Distinguished Professor Emeritus");
+        EXPECT_EQ(tag.getBio().title, "Distinguished Professor Emeritus");
+        tag.setBio(Bio{"Ann Lee-Hadzik-Smithson", "Lecturer in Mathematics", "Mathematics Department", 2015});
+        EXPECT_EQ(defaultResource.allocations, 0u);
+    }
+    EXPECT_EQ(a.liveBytes, 0u) << "everything went back to the resource";
+}
+
+TEST_F(PmrTagsTest, ValidationMatchesTheRegularTags) {
+    EXPECT_THROW(PmrNameTag(0, "Waldo", kCompany, &a), std::invalid_argument);
+    EXPECT_THROW(PmrNameTag(1, "", kCompany, &a), std::invalid_argument);
+    EXPECT_THROW(PmrFancyNameTag(1, "", kBio, &a), std::invalid_argument);
+    EXPECT_THROW(PmrFancyNameTag(1, kCompany, Bio{"Scott", "", "CS", 2010}, &a), std::invalid_argument);
+    EXPECT_EQ(a.liveBytes, 0u) << "nothing leaks when a constructor throws";
+
+    EXPECT_THROW(PmrNameTag(0, "Waldo", "Rejected PmrNameTag Co", &a), std::invalid_argument);
+    EXPECT_THROW(PmrFancyNameTag(0, "Rejected PmrFancyNameTag Co", kBio, &a), std::invalid_argument);
+    EXPECT_FALSE(CompanyTable::find("Rejected PmrNameTag Co").has_value()) << "nor in the CompanyTable";
+    EXPECT_FALSE(CompanyTable::find("Rejected PmrFancyNameTag Co").has_value());
+}
+
+TEST_F(PmrTagsTest, PmrVectorPassesItsResourceToElements) {
+    std::pmr::vector<PmrFancyNameTag> tags(&a);
+    tags.emplace_back(1, kCompany, kBio);
+    tags.emplace_back(2, kCompany, kBio);
+    tags.emplace_back(3, kCompany, kBio); // may grow the vector: elements move within a
+    for (const PmrFancyNameTag& tag : tags) {
+        EXPECT_EQ(tag.get_allocator().resource(), &a);
+        EXPECT_EQ(tag.getBio().get_allocator().resource(), &a);
+    }
+    EXPECT_EQ(defaultResource.allocations, 0u);
+
+    std::pmr::vector<PmrNameTag> names(&b);
+    names.emplace_back(1, kLongName, kCompany);
+    EXPECT_EQ(names.front().get_allocator().resource(), &b);
+}
+
+// ----- Copies -----
+
+TEST_F(PmrTagsTest, CopyGoesToTheDefaultResourceUnlessOneIsGiven) {
+    const PmrFancyNameTag original(1, kCompany, kBio, &a);
+
+    const PmrFancyNameTag copy(original);
+    EXPECT_EQ(copy.get_allocator().resource(), &defaultResource)
+        << "a copy may outlive the source's resource, so it doesn't inherit it";
+    EXPECT_EQ(copy.getBio(), original.getBio());
+
+    const PmrFancyNameTag copyInB(original, &b);
+    EXPECT_EQ(copyInB.get_allocator().resource(), &b);
+    EXPECT_EQ(copyInB.getBio().get_allocator().resource(), &b);
+    EXPECT_EQ(b.allocations, 4u);
+
+    const PmrNameTag name(1, kLongName, kCompany, &a);
+    EXPECT_EQ(PmrNameTag(name).get_allocator().resource(), &defaultResource);
+    EXPECT_EQ(PmrNameTag(name, &b).get_allocator().resource(), &b);
+}
+
+TEST_F(PmrTagsTest, CopyAssignmentKeepsTheTargetsResource) {
+    const PmrFancyNameTag source(1, kCompany, kBio, &a);
+    PmrFancyNameTag target(2, kCompany, Bio{"Ann", "Lecturer", "Math", 2015}, &b);
+    const std::size_t before = a.allocations;
+
+    target = source;
+    EXPECT_EQ(target.get_allocator().resource(), &b);
+    EXPECT_EQ(target.getBio().get_allocator().resource(), &b);
+    EXPECT_EQ(target.getId(), 1);
+    EXPECT_EQ(target.getBio(), source.getBio());
+    EXPECT_EQ(a.allocations, before);
+}
+
+// ----- Moves within one resource -----
+
+TEST_F(PmrTagsTest, MoveTakesTheBioOverAndKeepsTheResource) {
+    PmrFancyNameTag source(1, kCompany, kBio, &a);
+    const PmrBio* bio = &source.getBio();
+    const std::size_t before = a.allocations;
+
+    PmrFancyNameTag moved(std::move(source));
+    EXPECT_EQ(&moved.getBio(), bio);
+    EXPECT_EQ(moved.get_allocator().resource(), &a);
+    EXPECT_FALSE(source.hasBio());
+    EXPECT_THROW(source.getBio(), std::logic_error);
+
+    PmrFancyNameTag sameResource(std::move(moved), &a);
+    EXPECT_EQ(&sameResource.getBio(), bio) << "equal resources: still just a pointer handoff";
+    EXPECT_EQ(a.allocations, before);
+}
+
+TEST_F(PmrTagsTest, MoveAssignmentWithinOneResourceTakesThePointer) {
+    PmrFancyNameTag source(1, kCompany, kBio, &a);
+    PmrFancyNameTag target(2, kCompany, Bio{"Ann", "Lecturer", "Math", 2015}, &a);
+    const PmrBio* bio = &source.getBio();
+    const std::size_t before = a.allocations;
+
+    target = std::move(source);
+    EXPECT_EQ(&target.getBio(), bio);
+    EXPECT_FALSE(source.hasBio());
+    EXPECT_EQ(a.allocations, before);
+}
+
+// ----- Moves between different resources -----
+
+TEST_F(PmrTagsTest, MoveIntoAnotherResourceCopies) {
+    PmrFancyNameTag source(1, kCompany, kBio, &a);
+    const PmrBio* bio = &source.getBio();
+
+    PmrFancyNameTag moved(std::move(source), &b);
+    EXPECT_EQ(moved.get_allocator().resource(), &b);
+    EXPECT_NE(&moved.getBio(), bio) << "a's Bio can't be freed to b, so b gets its own";
+    EXPECT_EQ(moved.getBio().get_allocator().resource(), &b);
+    EXPECT_EQ(moved.getBio().toBio(), kBio);
+    EXPECT_EQ(b.allocations, 4u);
+    ASSERT_TRUE(source.hasBio()) << "nothing was taken from the source";
+    EXPECT_EQ(source.getBio().toBio(), kBio);
+}
+
+TEST_F(PmrTagsTest, MoveAssignmentBetweenResourcesCopiesIntoTheTarget) {
+    PmrFancyNameTag source(1, kCompany, kBio, &a);
+    PmrFancyNameTag target(2, kCompany, Bio{"Ann", "Lecturer", "Math", 2015}, &b);
+
+    target = std::move(source);
+    EXPECT_EQ(target.get_allocator().resource(), &b);
+    EXPECT_EQ(target.getBio().get_allocator().resource(), &b);
+    EXPECT_EQ(target.getBio().toBio(), kBio);
+    EXPECT_TRUE(source.hasBio());
+}
+
+TEST_F(PmrTagsTest, NameTagAndBioMovesBetweenResources) {
+    PmrNameTag name(1, kLongName, kCompany, &a);
+    const char* chars = name.getName().data();
+    PmrNameTag sameResource(std::move(name), &a);
+    EXPECT_EQ(sameResource.getName().data(), chars);
+
+    PmrNameTag otherResource(std::move(sameResource), &b);
+    EXPECT_NE(otherResource.getName().data(), chars);
+    EXPECT_EQ(otherResource.getName(), kLongName);
+    EXPECT_EQ(otherResource.get_allocator().resource(), &b);
+
+    PmrNameTag target(2, "Someone Else Entirely Long", kCompany, &b);
+    target = otherResource;
+    EXPECT_EQ(target.get_allocator().resource(), &b);
+    EXPECT_EQ(target.getName(), kLongName);
+
+    PmrBio bio(kBio, &a);
+    PmrBio bioInB(std::move(bio), &b);
+    EXPECT_EQ(bioInB.get_allocator().resource(), &b);
+    EXPECT_EQ(bioInB.toBio(), kBio);
+}
+
+// ----- The request-handler pattern -----
+
+// Everything a request builds comes from one monotonic arena, which takes
+// memory from upstream in a few big blocks and gives it all back at once
+TEST_F(PmrTagsTest, MonotonicArenaReleasesEverythingAtOnce) {
+    CountingResource upstream;
+    {
+        std::pmr::monotonic_buffer_resource arena(&upstream);
+        std::pmr::vector<PmrFancyNameTag> tags(&arena);
+        for (int id = 1; id <= 1000; ++id) {
+            tags.emplace_back(id, kCompany, kBio);
+        }
+        EXPECT_LT(upstream.allocations, 50u) << "5000 objects, a handful of upstream blocks";
+        EXPECT_EQ(defaultResource.allocations, 0u);
+    }
+    EXPECT_EQ(upstream.liveBytes, 0u);
+}
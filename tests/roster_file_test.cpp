@@ -0,0 +1,233 @@
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "FancyNameTag.h"
+#include "InstanceCounters.h"
+#include "NameTag.h"
+#include "RosterFile.h"
+
+// ==================== RosterFile ====================
+
+namespace {
+
+// One file per test, so tests run in parallel don't share a roster
+std::string rosterPath() {
+    return ::testing::TempDir() + "roster_" +
+           ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".bin";
+}
+
+std::vector<FancyNameTag> sampleFancyTags() {
+    std::vector<FancyNameTag> tags;
+    tags.emplace_back(1, "Weber State University", Bio{"Scott", "Professor", "Computer Science", 2010});
+    tags.emplace_back(2, "Weber State University", Bio{"Ann", "Professor", "Computer Science", 2015});
+    tags.emplace_back(3, "Utah Tech", Bio{"Bo", "Lecturer", "Mathematics", 2020});
+    return tags;
+}
+
+std::vector<NameTag> sampleNameTags() {
+    return {NameTag(10, "Waldo", "Weber State University"), NameTag(11, "Wenda", "Utah Tech")};
+}
+
+// Reads a whole file into a byte vector
+std::vector<char> readBytes(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+void writeBytes(const std::string& path, const std::vector<char>& bytes) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+} // namespace
+
+TEST(RosterFileTest, RoundTripsNameTagsAndFancyNameTags) {
+    const std::string path = rosterPath();
+    const auto fancy = sampleFancyTags();
+    const auto plain = sampleNameTags();
+    writeRoster(path, plain, fancy);
+
+    const RosterFile roster(path);
+
+    ASSERT_EQ(roster.nameTagCount(), 2u);
+    ASSERT_EQ(roster.fancyCount(), 3u);
+    EXPECT_EQ(roster.nameTag(1).id, 11);
+    EXPECT_EQ(roster.nameTag(1).name, "Wenda");
+    EXPECT_EQ(roster.nameTag(1).company, "Utah Tech");
+    for (std::size_t i = 0; i < fancy.size(); ++i) {
+        const FancyNameTagView view = roster.fancyNameTag(i);
+        EXPECT_EQ(view.id, fancy[i].getId());
+        EXPECT_EQ(view.company, fancy[i].getCompany());
+        EXPECT_EQ(view.name, fancy[i].getBio().name);
+        EXPECT_EQ(view.title, fancy[i].getBio().title);
+        EXPECT_EQ(view.department, fancy[i].getBio().department);
+        EXPECT_EQ(view.year, fancy[i].getBio().year);
+    }
+}
+
+TEST(RosterFileTest, ViewsPointIntoTheMapping) {
+    const std::string path = rosterPath();
+    writeRoster(path, {}, sampleFancyTags());
+    const RosterFile roster(path);
+
+    // Same company in two records -> the very same bytes (stored once)
+    EXPECT_EQ(roster.fancyNameTag(0).company.data(), roster.fancyNameTag(1).company.data());
+    EXPECT_EQ(roster.fancyNameTag(0).department.data(), roster.fancyNameTag(1).department.data());
+    EXPECT_NE(roster.fancyNameTag(0).name.data(), roster.fancyNameTag(1).name.data());
+}
+
+TEST(RosterFileTest, RepeatedStringsAreStoredOnce) {
+    const std::string path = rosterPath();
+    RosterWriter writer;
+    for (int id = 1; id <= 1000; ++id) {
+        writer.add(FancyNameTagView{id, "Weber State University", "Scott", "Professor", "Computer Science", 2010});
+    }
+    writer.write(path);
+
+    // 1000 records of 24 bytes + one copy of each repeated string + 1000 names
+    EXPECT_LT(readBytes(path).size(), 1000u * 24 + 1000u * (4 + 5) + 200);
+}
+
+TEST(RosterFileTest, PromotesViewsToOwningTags) {
+    const std::string path = rosterPath();
+    writeRoster(path, sampleNameTags(), sampleFancyTags());
+    const RosterFile roster(path);
+
+    const FancyNameTag fancy = roster.fancyNameTag(2).toFancyNameTag(BioAlloc::Pool);
+    EXPECT_EQ(fancy.getId(), 3);
+    EXPECT_EQ(fancy.getBio().department, "Mathematics");
+    EXPECT_EQ(fancy.getBioAlloc(), BioAlloc::Pool);
+
+    const NameTag plain = roster.nameTag(0).toNameTag();
+    EXPECT_EQ(plain.getName(), "Waldo");
+}
+
+TEST(RosterFileTest, EmptyRoster) {
+    const std::string path = rosterPath();
+    writeRoster(path, {}, {});
+    const RosterFile roster(path);
+    EXPECT_EQ(roster.nameTagCount(), 0u);
+    EXPECT_EQ(roster.fancyCount(), 0u);
+}
+
+TEST(RosterFileTest, MovedRosterKeepsItsViews) {
+    const std::string path = rosterPath();
+    writeRoster(path, {}, sampleFancyTags());
+    RosterFile first(path);
+    const std::string_view name = first.fancyNameTag(0).name;
+
+    RosterFile second(std::move(first));
+
+    EXPECT_EQ(first.fancyCount(), 0u);
+    EXPECT_EQ(second.fancyNameTag(0).name.data(), name.data());
+}
+
+// ==================== Bad files ====================
+
+TEST(RosterFileTest, MissingFileThrows) {
+    EXPECT_THROW(RosterFile{rosterPath()}, std::runtime_error);
+}
+
+TEST(RosterFileTest, WrongMagicThrows) {
+    const std::string path = rosterPath();
+    writeRoster(path, {}, sampleFancyTags());
+    auto bytes = readBytes(path);
+    bytes[0] = 'X';
+    writeBytes(path, bytes);
+    EXPECT_THROW(RosterFile{path}, std::runtime_error);
+}
+
+TEST(RosterFileTest, OtherVersionThrows) {
+    const std::string path = rosterPath();
+    writeRoster(path, {}, sampleFancyTags());
+    auto bytes = readBytes(path);
+    const std::uint32_t version = kRosterVersion + 1;
+    std::memcpy(bytes.data() + offsetof(RosterHeader, version), &version, sizeof(version));
+    writeBytes(path, bytes);
+    EXPECT_THROW(RosterFile{path}, std::runtime_error);
+}
+
+TEST(RosterFileTest, TruncatedFileThrows) {
+    const std::string path = rosterPath();
+    writeRoster(path, {}, sampleFancyTags());
+    auto bytes = readBytes(path);
+    bytes.resize(bytes.size() - 10);
+    writeBytes(path, bytes);
+    EXPECT_THROW(RosterFile{path}, std::runtime_error);
+}
+
+TEST(RosterFileTest, CorruptStringReferenceThrowsOnRead) {
+    const std::string path = rosterPath();
+    writeRoster(path, {}, sampleFancyTags());
+    auto bytes = readBytes(path);
+    // Point the first record's name far past the string table
+    const std::uint32_t bad = 0x7fffffff;
+    std::memcpy(bytes.data() + sizeof(RosterHeader) + offsetof(FancyNameTagRecord, name), &bad, sizeof(bad));
+    writeBytes(path, bytes);
+
+    const RosterFile roster(path);
+    EXPECT_THROW(roster.fancyNameTag(0), std::runtime_error);
+    EXPECT_EQ(roster.fancyNameTag(1).name, "Ann");
+}
+
+// ==================== Lazy tags ====================
+
+TEST(LazyFancyNameTagTest, ReadsFromTheViewUntilChanged) {
+    const std::string path = rosterPath();
+    writeRoster(path, {}, sampleFancyTags());
+    const RosterFile roster(path);
+    const InstanceCounts before = InstanceCounter<FancyNameTag>::snapshot();
+
+    LazyFancyNameTag tag(roster.fancyNameTag(0));
+    EXPECT_EQ(tag.getName(), "Scott");
+    EXPECT_EQ(tag.getYear(), 2010);
+
+    EXPECT_FALSE(tag.isPromoted());
+    EXPECT_EQ((InstanceCounter<FancyNameTag>::snapshot() - before).created, 0u)
+        << "reading must not build a FancyNameTag";
+}
+
+TEST(LazyFancyNameTagTest, FirstChangePromotes) {
+    const std::string path = rosterPath();
+    writeRoster(path, {}, sampleFancyTags());
+    const RosterFile roster(path);
+
+    LazyFancyNameTag tag(roster.fancyNameTag(0));
+    tag.setBioTitle("Dean");
+
+    EXPECT_TRUE(tag.isPromoted());
+    EXPECT_EQ(tag.getTitle(), "Dean");
+    EXPECT_EQ(tag.getName(), "Scott") << "the rest is copied from the view";
+    EXPECT_EQ(roster.fancyNameTag(0).title, "Professor") << "the file is never written";
+}
+
+TEST(LazyFancyNameTagTest, PromotedTagEnforcesInvariants) {
+    const std::string path = rosterPath();
+    writeRoster(path, {}, sampleFancyTags());
+    const RosterFile roster(path);
+
+    LazyFancyNameTag tag(roster.fancyNameTag(1));
+    EXPECT_THROW(tag.setId(0), std::invalid_argument);
+    EXPECT_EQ(tag.getId(), 2);
+}
+
+TEST(LazyNameTagTest, PromotesOnSetName) {
+    const std::string path = rosterPath();
+    writeRoster(path, sampleNameTags(), {});
+    const RosterFile roster(path);
+
+    LazyNameTag tag(roster.nameTag(0));
+    EXPECT_EQ(tag.getName(), "Waldo");
+    EXPECT_FALSE(tag.isPromoted());
+
+    tag.setName("Odlaw");
+    EXPECT_TRUE(tag.isPromoted());
+    EXPECT_EQ(tag.getName(), "Odlaw");
+    EXPECT_EQ(tag.getCompany(), "Weber State University");
+}
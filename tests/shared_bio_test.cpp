@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include "FancyNameTag.h"
+
+// ==================== BioAlloc::Shared (copy-on-write) ====================
+
+TEST(SharedBioTest, CopySharesBio) {
+    Bio bio{"Scott", "Professor", "Computer Science", 2010};
+    FancyNameTag original(1, "Weber State Univ.", bio, BioAlloc::Shared);
+    FancyNameTag copied(original);
+
+    EXPECT_EQ(&original.getBio(), &copied.getBio())
+        << "Shared copies should refer to the same Bio";
+    EXPECT_EQ(original.getBioUseCount(), 2u);
+}
+
+TEST(SharedBioTest, MutatorClonesSharedBio) {
+    Bio bio{"Scott", "Professor", "Computer Science", 2010};
+    FancyNameTag original(1, "Weber State Univ.", bio, BioAlloc::Shared);
+    FancyNameTag copied(original);
+
+    copied.setBioTitle("Dean");
+
+    EXPECT_NE(&original.getBio(), &copied.getBio());
+    EXPECT_EQ(original.getBio().title, "Professor")
+        << "Modifying a copy must not change the original's Bio";
+    EXPECT_EQ(copied.getBio().title, "Dean");
+    EXPECT_EQ(original.getBioUseCount(), 1u);
+    EXPECT_EQ(copied.getBioUseCount(), 1u);
+}
+
+TEST(SharedBioTest, UniqueBioIsModifiedInPlace) {
+    Bio bio{"Scott", "Professor", "Computer Science", 2010};
+    FancyNameTag tag(1, "Weber State Univ.", bio, BioAlloc::Shared);
+    const Bio* before = &tag.getBio();
+
+    tag.setBioTitle("Dean");
+
+    EXPECT_EQ(&tag.getBio(), before) << "No clone is needed when nobody shares the Bio";
+}
+
+TEST(SharedBioTest, DestroyingCopyDropsReference) {
+    Bio bio{"Scott", "Professor", "Computer Science", 2010};
+    FancyNameTag original(1, "Weber State Univ.", bio, BioAlloc::Shared);
+    {
+        FancyNameTag copied(original);
+        EXPECT_EQ(original.getBioUseCount(), 2u);
+    }
+    EXPECT_EQ(original.getBioUseCount(), 1u);
+    EXPECT_EQ(original.getBio().name, "Scott");
+}
+
+TEST(SharedBioTest, MoveKeepsReferenceCount) {
+    Bio bio{"Scott", "Professor", "Computer Science", 2010};
+    FancyNameTag original(1, "Weber State Univ.", bio, BioAlloc::Shared);
+    FancyNameTag copied(original);
+    FancyNameTag moved(std::move(copied));
+
+    EXPECT_EQ(original.getBioUseCount(), 2u) << "A move transfers a reference, it doesn't add one";
+    EXPECT_EQ(copied.getBioUseCount(), 0u);
+}
+
+TEST(SharedBioTest, CopiesAcrossThreads) {
+    Bio bio{"Scott", "Professor", "Computer Science", 2010};
+    FancyNameTag original(1, "Weber State Univ.", bio, BioAlloc::Shared);
+
+    // Each thread repeatedly copies and destroys — the count must end where it started
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&original] {
+            for (int i = 0; i < 1000; ++i) {
+                FancyNameTag copied(original);
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(original.getBioUseCount(), 1u);
+}
+
+TEST(SharedBioTest, SetBioRejectsInvalidBio) {
+    Bio bio{"Scott", "Professor", "Computer Science", 2010};
+    FancyNameTag tag(1, "Weber State Univ.", bio, BioAlloc::Shared);
+    EXPECT_THROW(tag.setBio({"", "Professor", "Computer Science", 2010}), std::invalid_argument);
+    EXPECT_THROW(tag.setBioTitle(""), std::invalid_argument);
+    EXPECT_EQ(tag.getBio().title, "Professor");
+}
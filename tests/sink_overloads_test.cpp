@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <utility>
+#include "AllocationCounter.h"
+#include "Bio.h"
+#include "CompanyTable.h"
+#include "FancyNameTag.h"
+#include "NameTag.h"
+
+// ==================== Allocation counting ====================
+// allocationsDuring() (AllocationCounter.h) counts the global operator new
+// calls made on this thread while a lambda runs.
+//
+// All strings below are longer than std::string's small buffer (15
+// characters with libstdc++/MSVC, 22 with libc++), so each one that gets
+// created costs exactly one allocation.
+
+namespace {
+
+const std::string kLongName = "Scott Hermanson the Third";
+const std::string kLongTitle = "Distinguished Professor";
+const std::string kLongDepartment = "School of Computing Science";
+const std::string kCompany = "Weber State University";
+
+} // namespace
+
+class SinkOverloadsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // Intern the company up front (the first intern stores the name once)
+        // and warm up anything the trace or counters set up on first use
+        CompanyTable::intern(kCompany);
+        FancyNameTag warmUp(1, kCompany, Bio{kLongName, kLongTitle, kLongDepartment, 2010});
+        NameTag warmUpTag(1, kLongName, kCompany);
+    }
+};
+
+// ==================== NameTag ====================
+
+TEST_F(SinkOverloadsTest, TemporaryNameIsAllocatedOnce) {
+    const std::size_t allocations = allocationsDuring([] {
+        NameTag tag(1, std::string(kLongName), kCompany);
+        EXPECT_EQ(tag.getName(), kLongName);
+    });
+    EXPECT_EQ(allocations, 1u) << "the temporary's buffer should be moved into name_";
+}
+
+TEST_F(SinkOverloadsTest, StringLiteralCompanyAllocatesNothing) {
+    const std::size_t allocations = allocationsDuring([] {
+        NameTag tag(1, "Waldo", "Weber State University");
+        EXPECT_EQ(tag.getCompany(), kCompany);
+    });
+    EXPECT_EQ(allocations, 0u) << "an already interned company needs no std::string";
+}
+
+TEST_F(SinkOverloadsTest, LvalueNameIsCopiedOnce) {
+    const std::size_t allocations = allocationsDuring([] {
+        NameTag tag(1, kLongName, kCompany);
+    });
+    EXPECT_EQ(allocations, 1u);
+}
+
+TEST_F(SinkOverloadsTest, SetNameFromTemporaryStealsTheBuffer) {
+    NameTag tag(1, "Waldo", kCompany);
+    std::string name = kLongName;
+    const char* buffer = name.data();
+
+    const std::size_t allocations = allocationsDuring([&] { tag.setName(std::move(name)); });
+
+    EXPECT_EQ(allocations, 0u);
+    EXPECT_EQ(tag.getName().data(), buffer);
+}
+
+TEST_F(SinkOverloadsTest, SetNameFromLvalueReusesCapacity) {
+    NameTag tag(1, kLongName, kCompany);
+    const std::string shorter = "Scott Hermanson the 3rd";
+
+    const std::size_t allocations = allocationsDuring([&] { tag.setName(shorter); });
+
+    EXPECT_EQ(allocations, 0u) << "name_ already has room, so the copy allocates nothing";
+    EXPECT_EQ(tag.getName(), shorter);
+}
+
+TEST_F(SinkOverloadsTest, RejectedTemporaryNameLeavesTagUnchanged) {
+    NameTag tag(1, kLongName, kCompany);
+    EXPECT_THROW(tag.setName(std::string()), std::invalid_argument);
+    EXPECT_EQ(tag.getName(), kLongName);
+}
+
+// ==================== FancyNameTag ====================
+
+TEST_F(SinkOverloadsTest, TemporaryBioStringsAreAllocatedOnce) {
+    const std::size_t allocations = allocationsDuring([] {
+        FancyNameTag tag(1, "Weber State University",
+                         {kLongName, kLongTitle, kLongDepartment, 2010}, BioAlloc::Heap);
+        EXPECT_EQ(tag.getBio().department, kLongDepartment);
+    });
+    // 3 strings built once in the temporary Bio + the heap Bio itself.
+    // Copying the temporary would add 3 more string allocations.
+    EXPECT_EQ(allocations, 4u);
+}
+
+TEST_F(SinkOverloadsTest, MovedBioIsStolen) {
+    Bio bio{kLongName, kLongTitle, kLongDepartment, 2010};
+    const char* nameBuffer = bio.name.data();
+
+    FancyNameTag tag(1, kCompany, std::move(bio), BioAlloc::Heap);
+
+    EXPECT_EQ(tag.getBio().name.data(), nameBuffer);
+}
+
+TEST_F(SinkOverloadsTest, LvalueBioIsStillCopied) {
+    const Bio bio{kLongName, kLongTitle, kLongDepartment, 2010};
+
+    const std::size_t allocations = allocationsDuring([&] {
+        FancyNameTag tag(1, kCompany, bio, BioAlloc::Heap);
+    });
+
+    EXPECT_EQ(allocations, 4u) << "3 copied strings + the heap Bio";
+    EXPECT_EQ(bio.name, kLongName) << "the caller's Bio is untouched";
+}
+
+TEST_F(SinkOverloadsTest, MovedBioIsValidatedLikeACopy) {
+    EXPECT_THROW(FancyNameTag(1, kCompany, Bio{"", kLongTitle, kLongDepartment, 2010}),
+                 std::invalid_argument);
+    EXPECT_THROW(FancyNameTag(1, kCompany, Bio{kLongName, kLongTitle, kLongDepartment, 0}),
+                 std::invalid_argument);
+}
+
+TEST_F(SinkOverloadsTest, SetBioFromTemporaryAllocatesOnlyTheBio) {
+    FancyNameTag tag(1, kCompany, Bio{"Ann", "TA", "CS", 2020}, BioAlloc::Heap);
+    Bio replacement{kLongName, kLongTitle, kLongDepartment, 2010};
+
+    const std::size_t allocations = allocationsDuring([&] { tag.setBio(std::move(replacement)); });
+
+    EXPECT_EQ(allocations, 1u);
+    EXPECT_EQ(tag.getBio().title, kLongTitle);
+}
+
+TEST_F(SinkOverloadsTest, SetBioTitleFromTemporaryStealsTheBuffer) {
+    FancyNameTag tag(1, kCompany, Bio{kLongName, "TA", kLongDepartment, 2010}, BioAlloc::Heap);
+    std::string title = kLongTitle;
+    const char* buffer = title.data();
+
+    const std::size_t allocations = allocationsDuring([&] { tag.setBioTitle(std::move(title)); });
+
+    EXPECT_EQ(allocations, 0u);
+    EXPECT_EQ(tag.getBio().title.data(), buffer);
+}
+
+TEST_F(SinkOverloadsTest, SetBioTitleStillClonesASharedBio) {
+    const FancyNameTag original(1, kCompany, Bio{kLongName, "TA", kLongDepartment, 2010}, BioAlloc::Shared);
+    FancyNameTag copy = original;
+
+    copy.setBioTitle(std::string(kLongTitle));
+
+    EXPECT_EQ(copy.getBio().title, kLongTitle);
+    EXPECT_EQ(original.getBio().title, "TA");
+}
@@ -0,0 +1,218 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "FancyNameTag.h"
+#include "InstanceCounters.h"
+#include "NameTag.h"
+#include "TagBuffer.h"
+
+// ==================== TagBuffer ====================
+
+namespace {
+
+// True if view lies entirely inside buffer
+bool inside(std::string_view view, const std::vector<char>& buffer) {
+    return view.empty() ||
+           (view.data() >= buffer.data() && view.data() + view.size() <= buffer.data() + buffer.size());
+}
+
+} // namespace
+
+TEST(TagBufferTest, RoundTripsEachKind) {
+    const Bio bio{"Scott", "Professor", "Computer Science", 2010};
+    const NameTag tag(7, "Waldo", "Weber State University");
+    const FancyNameTag fancy(9, "Utah Tech", Bio{"Ann", "Lecturer", "Mathematics", 2015});
+
+    std::vector<char> buffer;
+    serialize(bio, buffer);
+    serialize(tag, buffer);
+    serialize(fancy, buffer);
+    EXPECT_EQ(buffer.size(), serializedSize(bio) + serializedSize(tag) + serializedSize(fancy));
+    EXPECT_EQ(buffer.size() % 4, 0u);
+
+    TagBufferReader reader(buffer);
+    EXPECT_EQ(reader.nextKind(), TagRecordKind::Bio);
+    EXPECT_EQ(reader.readBio().toBio(), bio);
+    EXPECT_EQ(reader.nextKind(), TagRecordKind::NameTag);
+    EXPECT_EQ(reader.readNameTag().toNameTag(), tag);
+    EXPECT_EQ(reader.nextKind(), TagRecordKind::FancyNameTag);
+    EXPECT_EQ(reader.readFancyNameTag().toFancyNameTag(), fancy);
+    EXPECT_TRUE(reader.atEnd());
+    EXPECT_THROW(reader.nextKind(), std::runtime_error);
+}
+
+TEST(TagBufferTest, ViewsPointIntoTheBuffer) {
+    std::vector<char> buffer;
+    serialize(FancyNameTag(1, "WSU", Bio{"Scott", "Professor", "CS", 2010}), buffer);
+
+    const FancyNameTagView view = deserializeFancyNameTag(buffer);
+    EXPECT_EQ(view.name, "Scott");
+    EXPECT_EQ(view.company, "WSU");
+    for (std::string_view s : {view.company, view.name, view.title, view.department}) {
+        EXPECT_TRUE(inside(s, buffer)) << "\"" << s << "\" was copied out of the buffer";
+    }
+}
+
+// The buffer has no pointers in it: a copy at another address (another
+// process's mapping) reads the same
+TEST(TagBufferTest, BufferIsPositionIndependent) {
+    std::vector<char> buffer;
+    serialize(NameTag(3, "Waldo", "WSU"), buffer);
+
+    std::vector<char> elsewhere(buffer.size() + 1);
+    std::memcpy(elsewhere.data() + 1, buffer.data(), buffer.size()); // deliberately misaligned
+    const NameTagView view = deserializeNameTag(std::span<const char>(elsewhere).subspan(1));
+    EXPECT_EQ(view.id, 3);
+    EXPECT_EQ(view.name, "Waldo");
+    EXPECT_EQ(view.company, "WSU");
+}
+
+TEST(TagBufferTest, MaterializingMovesTheBioIntoTheTag) {
+    if constexpr (!kCountersEnabled) GTEST_SKIP() << "counters are compiled out (NAMETAG_COUNTERS=OFF)";
+    std::vector<char> buffer;
+    serialize(FancyNameTag(1, "WSU", Bio{"Scott Hadzik, Professor Emeritus", "Professor", "CS", 2010}), buffer);
+    const FancyNameTagView view = deserializeFancyNameTag(buffer);
+
+    const InstanceCounts before = InstanceCounter<Bio>::snapshot();
+    const FancyNameTag tag = view.toFancyNameTag();
+    const InstanceCounts delta = InstanceCounter<Bio>::snapshot() - before;
+    EXPECT_EQ(delta.copies, 0u) << "the strings are copied once, out of the buffer; the Bio is never copied";
+    EXPECT_EQ(tag.getBio().name, "Scott Hadzik, Professor Emeritus");
+}
+
+TEST(TagBufferTest, MovedFromFancyNameTagCantBeSerialized) {
+    FancyNameTag tag(1, "WSU", Bio{"Scott", "Professor", "CS", 2010});
+    FancyNameTag taken(std::move(tag));
+    std::vector<char> buffer;
+    EXPECT_THROW(serialize(tag, buffer), std::invalid_argument);
+    EXPECT_TRUE(buffer.empty());
+}
+
+TEST(TagBufferTest, WrongKindThrowsAndReaderStaysPut) {
+    std::vector<char> buffer;
+    serialize(NameTag(1, "Waldo", "WSU"), buffer);
+    TagBufferReader reader(buffer);
+    EXPECT_THROW(reader.readBio(), std::runtime_error);
+    EXPECT_THROW(reader.readFancyNameTag(), std::runtime_error);
+    EXPECT_EQ(reader.position(), 0u);
+    EXPECT_EQ(reader.readNameTag().name, "Waldo");
+}
+
+TEST(TagBufferTest, SkipsRecords) {
+    std::vector<char> buffer;
+    serialize(Bio{"A", "B", "C", 1}, buffer);
+    serialize(NameTag(2, "Waldo", "WSU"), buffer);
+    TagBufferReader reader(buffer);
+    reader.skip();
+    EXPECT_EQ(reader.readNameTag().id, 2);
+    EXPECT_TRUE(reader.atEnd());
+}
+
+// Random records of every kind, with strings from empty to several hundred
+// bytes (including '\0' and non-ASCII bytes), all in one buffer
+TEST(TagBufferTest, RandomRoundTrips) {
+    std::mt19937 random(23);
+    auto randomText = [&](std::size_t minLength, std::size_t maxLength) {
+        std::string text(std::uniform_int_distribution<std::size_t>(minLength, maxLength)(random), ' ');
+        for (char& c : text) {
+            c = static_cast<char>(std::uniform_int_distribution<int>(0, 255)(random));
+        }
+        return text;
+    };
+    auto randomInt = [&] { return std::uniform_int_distribution<int>(1, 1 << 30)(random); };
+
+    std::vector<Bio> bios;
+    std::vector<NameTag> tags;
+    std::vector<FancyNameTag> fancy;
+    std::vector<TagRecordKind> order;
+    std::vector<char> buffer;
+    for (int i = 0; i < 2000; ++i) {
+        switch (i % 3) {
+            case 0:
+                bios.push_back(Bio{randomText(0, 300), randomText(0, 20), randomText(0, 5), randomInt() - (1 << 29)});
+                serialize(bios.back(), buffer);
+                order.push_back(TagRecordKind::Bio);
+                break;
+            case 1:
+                tags.emplace_back(randomInt(), randomText(1, 40), randomText(1, 30));
+                serialize(tags.back(), buffer);
+                order.push_back(TagRecordKind::NameTag);
+                break;
+            default:
+                fancy.emplace_back(randomInt(), randomText(1, 30),
+                                   Bio{randomText(1, 40), randomText(1, 20), randomText(0, 20), randomInt()});
+                serialize(fancy.back(), buffer);
+                order.push_back(TagRecordKind::FancyNameTag);
+                break;
+        }
+    }
+
+    TagBufferReader reader(buffer);
+    std::size_t bio = 0, tag = 0, fancyTag = 0;
+    for (TagRecordKind kind : order) {
+        ASSERT_EQ(reader.nextKind(), kind);
+        switch (kind) {
+            case TagRecordKind::Bio:
+                ASSERT_EQ(reader.readBio().toBio(), bios[bio++]);
+                break;
+            case TagRecordKind::NameTag:
+                ASSERT_EQ(reader.readNameTag().toNameTag(), tags[tag++]);
+                break;
+            case TagRecordKind::FancyNameTag:
+                ASSERT_EQ(reader.readFancyNameTag().toFancyNameTag(), fancy[fancyTag++]);
+                break;
+        }
+    }
+    EXPECT_TRUE(reader.atEnd());
+}
+
+// Truncated and randomly damaged buffers: every read either throws
+// std::runtime_error or returns views that stay inside the buffer
+TEST(TagBufferTest, DamagedBuffersNeverReadOutside) {
+    std::vector<char> original;
+    for (int id = 1; id <= 20; ++id) {
+        serialize(FancyNameTag(id, "Company " + std::to_string(id), Bio{"Person", "Title", "Dept", 2000}), original);
+        serialize(Bio{"Name " + std::to_string(id), "T", "", id}, original);
+    }
+
+    auto readAll = [](const std::vector<char>& buffer) {
+        TagBufferReader reader(buffer);
+        try {
+            while (!reader.atEnd()) {
+                if (reader.nextKind() == TagRecordKind::FancyNameTag) {
+                    const FancyNameTagView view = reader.readFancyNameTag();
+                    for (std::string_view s : {view.company, view.name, view.title, view.department}) {
+                        ASSERT_TRUE(inside(s, buffer));
+                    }
+                } else {
+                    const BioView view = reader.readBio();
+                    for (std::string_view s : {view.name, view.title, view.department}) {
+                        ASSERT_TRUE(inside(s, buffer));
+                    }
+                }
+            }
+        } catch (const std::runtime_error&) {
+            // rejected: fine
+        }
+    };
+
+    for (std::size_t size = 0; size < original.size(); ++size) {
+        const std::vector<char> truncated(original.begin(), original.begin() + static_cast<std::ptrdiff_t>(size));
+        readAll(truncated);
+    }
+
+    std::mt19937 random(2025);
+    for (int trial = 0; trial < 5000; ++trial) {
+        std::vector<char> damaged = original;
+        for (int flips = 0; flips < 3; ++flips) {
+            const std::size_t at = std::uniform_int_distribution<std::size_t>(0, damaged.size() - 1)(random);
+            damaged[at] = static_cast<char>(std::uniform_int_distribution<int>(0, 255)(random));
+        }
+        readAll(damaged);
+    }
+}
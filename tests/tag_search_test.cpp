@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include <cctype>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "FancyNameTag.h"
+#include "NameTag.h"
+#include "TagSearch.h"
+
+// ==================== TagSearch ====================
+
+namespace {
+
+// What TagSearch must agree with: lower-case both strings, then find()
+bool containsIgnoringCase(std::string_view haystack, std::string_view needle) {
+    auto lower = [](std::string_view text) {
+        std::string folded(text);
+        for (char& c : folded) {
+            if (c >= 'A' && c <= 'Z') {
+                c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            }
+        }
+        return folded;
+    };
+    return lower(haystack).find(lower(needle)) != std::string::npos;
+}
+
+std::vector<std::size_t> referenceFind(const std::vector<NameTag>& tags, std::string_view needle, SearchField field) {
+    std::vector<std::size_t> found;
+    for (std::size_t i = 0; i < tags.size(); ++i) {
+        const bool name = field != SearchField::Company && containsIgnoringCase(tags[i].getName(), needle);
+        const bool company = field != SearchField::Name && containsIgnoringCase(tags[i].getCompany(), needle);
+        if (name || company) {
+            found.push_back(i);
+        }
+    }
+    return found;
+}
+
+std::vector<SearchKernel> supportedKernels() {
+    std::vector<SearchKernel> kernels;
+    for (SearchKernel kernel : {SearchKernel::Scalar, SearchKernel::Sse2, SearchKernel::Avx2}) {
+        if (TagSearch::isSupported(kernel)) {
+            kernels.push_back(kernel);
+        }
+    }
+    return kernels;
+}
+
+std::vector<NameTag> sampleTags() {
+    return {
+        NameTag(1, "Ann Lee", "Weber State University"),
+        NameTag(2, "Bob Stone", "Utah State University"),
+        NameTag(3, "ANNETTE", "Acme Corp"),
+        NameTag(4, "Carol", "weber state university"),
+    };
+}
+
+} // namespace
+
+TEST(TagSearchTest, ScalarIsAlwaysSupportedAndBestKernelIsUsable) {
+    EXPECT_TRUE(TagSearch::isSupported(SearchKernel::Scalar));
+    EXPECT_TRUE(TagSearch::isSupported(TagSearch::bestKernel()));
+    const std::vector<NameTag> tags = sampleTags();
+    EXPECT_EQ(TagSearch(tags).kernel(), TagSearch::bestKernel());
+}
+
+TEST(TagSearchTest, MatchesIgnoringCase) {
+    const std::vector<NameTag> tags = sampleTags();
+    for (SearchKernel kernel : supportedKernels()) {
+        TagSearch search(tags);
+        search.setKernel(kernel);
+        EXPECT_EQ(search.find("ann", SearchField::Name), (std::vector<std::size_t>{0, 2}));
+        EXPECT_EQ(search.find("WEBER", SearchField::Company), (std::vector<std::size_t>{0, 3}))
+            << "differently cased companies are different interned names, but both match";
+        EXPECT_EQ(search.find("state"), (std::vector<std::size_t>{0, 1, 3}));
+        EXPECT_EQ(search.count("e"), 4u);
+        EXPECT_EQ(search.count("nobody here"), 0u);
+    }
+}
+
+TEST(TagSearchTest, MatchNeverSpansTwoTags) {
+    const std::vector<NameTag> tags = {NameTag(1, "Ann", "WSU"), NameTag(2, "Bob", "WSU")};
+    for (SearchKernel kernel : supportedKernels()) {
+        TagSearch search(tags);
+        search.setKernel(kernel);
+        EXPECT_TRUE(search.find("nbo", SearchField::Name).empty());
+        EXPECT_TRUE(search.find("nnbob", SearchField::Name).empty());
+    }
+}
+
+TEST(TagSearchTest, EmptyTextMatchesEveryTag) {
+    const std::vector<NameTag> tags = sampleTags();
+    TagSearch search(tags);
+    EXPECT_EQ(search.count(""), tags.size());
+    EXPECT_EQ(search.count("", SearchField::Company), tags.size());
+}
+
+TEST(TagSearchTest, FancyNameTagsSearchTheBioName) {
+    std::vector<FancyNameTag> tags;
+    tags.emplace_back(1, "Weber State University", Bio{"Scott Hadzik", "Professor", "Computing", 2010});
+    tags.emplace_back(2, "Acme", Bio{"Alice", "Engineer", "R&D", 2015});
+    tags.emplace_back(3, "Acme", Bio{"Scottie", "Intern", "R&D", 2022});
+    FancyNameTag taken(std::move(tags[2]));
+
+    TagSearch search(tags);
+    EXPECT_EQ(search.find("scott", SearchField::Name), (std::vector<std::size_t>{0}))
+        << "a moved-from tag has no name to match";
+    EXPECT_EQ(search.find("acme"), (std::vector<std::size_t>{1, 2}))
+        << "but it still has its company";
+}
+
+// Random tags and search texts, every kernel against the reference. Names are
+// long enough to fill several SIMD blocks and short enough to end mid-block,
+// and the texts include ones longer than a block.
+TEST(TagSearchTest, AllKernelsMatchTheReference) {
+    std::mt19937 random(2024);
+    const std::string letters = "abcdeABCDE \xC3\xA9";
+    auto randomText = [&](std::size_t minLength, std::size_t maxLength) {
+        std::string text(std::uniform_int_distribution<std::size_t>(minLength, maxLength)(random), 'a');
+        for (char& c : text) {
+            c = letters[std::uniform_int_distribution<std::size_t>(0, letters.size() - 1)(random)];
+        }
+        return text;
+    };
+
+    std::vector<NameTag> tags;
+    for (int id = 1; id <= 500; ++id) {
+        tags.emplace_back(id, randomText(1, 80), "Company " + randomText(1, 6));
+    }
+    std::vector<std::string> needles;
+    for (int i = 0; i < 200; ++i) {
+        needles.push_back(randomText(1, i % 10 == 0 ? 40 : 4));
+    }
+    for (int i = 0; i < 50; ++i) {
+        // Pieces of real names, so long needles match too
+        const std::string& name = tags[static_cast<std::size_t>(i) * 7].getName();
+        needles.push_back(name.substr(name.size() / 3));
+    }
+
+    for (SearchKernel kernel : supportedKernels()) {
+        TagSearch search(tags);
+        search.setKernel(kernel);
+        for (const std::string& needle : needles) {
+            for (SearchField field : {SearchField::Name, SearchField::Company, SearchField::Either}) {
+                ASSERT_EQ(search.find(needle, field), referenceFind(tags, needle, field))
+                    << "kernel " << static_cast<int>(kernel) << ", text \"" << needle << "\"";
+            }
+        }
+    }
+}
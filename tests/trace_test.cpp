@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include "AddrUtil.h"
+#include "Bio.h"
+#include "FancyNameTag.h"
+#include "InlineFancyNameTag.h"
+#include "NameTag.h"
+#include "Trace.h"
+
+// ==================== Compile-time lifecycle tracing ====================
+
+namespace {
+
+// Runs a function with std::cout redirected and returns what it printed.
+// Buffered traces are flushed on the way in and out, so the capture holds
+// exactly the lines written by the function.
+template <typename Function>
+std::string captureCout(Function function) {
+    traceFlush();
+    std::stringstream buffer;
+    std::streambuf* oldCout = std::cout.rdbuf(buffer.rdbuf());
+    function();
+    traceFlush();
+    std::cout.rdbuf(oldCout);
+    return buffer.str();
+}
+
+// A sink that keeps every line it is given, so a test can inspect them
+struct RecordingSink {
+    static std::string lines;
+    static void emit(std::string_view line) { lines.append(line); }
+};
+
+std::string RecordingSink::lines;
+
+} // namespace
+
+TEST(TraceTest, LevelMatchesCompileDefinition) {
+    EXPECT_EQ(static_cast<int>(kTraceLevel), NAMETAG_TRACE_LEVEL);
+    EXPECT_EQ(kTraceEnabled, kTraceLevel != TraceLevel::None);
+}
+
+TEST(TraceTest, NonePolicyIsDisabled) {
+    static_assert(!Tracer<TraceLevel::None>::enabled);
+    static_assert(Tracer<TraceLevel::Buffered>::enabled);
+    static_assert(Tracer<TraceLevel::Verbose>::enabled);
+}
+
+TEST(TraceTest, TraceLineFormatsLikeCout) {
+    Bio bio{"Scott", "Professor", "Computer Science", 2010};
+    int local = 0;
+
+    RecordingSink::lines.clear();
+    BasicTraceLine<RecordingSink>() << "id=" << -42 << ", c=" << 'x'
+                                    << ", at " << shortAddr(&local)
+                                    << ", bio={" << bio << "}\n";
+
+    std::ostringstream expected;
+    expected << "id=" << -42 << ", c=" << 'x'
+             << ", at " << shortAddr(&local) << ", bio={";
+    std::streambuf* oldCout = std::cout.rdbuf(expected.rdbuf());
+    bio.print();
+    std::cout.rdbuf(oldCout);
+    expected << "}\n";
+
+    EXPECT_EQ(RecordingSink::lines, expected.str());
+}
+
+TEST(TraceTest, EachTraceLineStartsEmpty) {
+    RecordingSink::lines.clear();
+    BasicTraceLine<RecordingSink>() << "first\n";
+    BasicTraceLine<RecordingSink>() << "second\n";
+    EXPECT_EQ(RecordingSink::lines, "first\nsecond\n");
+}
+
+TEST(TraceTest, NameTagConstructorLine) {
+    const std::string output = captureCout([] {
+        NameTag tag(1, "Waldo", "Weber State University");
+    });
+    if constexpr (kTraceEnabled) {
+        EXPECT_EQ(output, "Constructor: id=1, name=\"Waldo\", company=\"Weber State University\"\n");
+    } else {
+        EXPECT_EQ(output, "");
+    }
+}
+
+TEST(TraceTest, FancyNameTagLifecycleLines) {
+    Bio bio{"Scott", "Professor", "Computer Science", 2010};
+    std::string expected;
+    const std::string output = captureCout([&] {
+        FancyNameTag original(1, "Weber State University", bio);
+        const std::string bioAddr = shortAddr(&original.getBio()).str();
+        FancyNameTag moved(std::move(original));
+
+        expected = "Constructor (STACK " + shortAddr(&original).str()
+                 + "): id=1, company=\"Weber State University\", bio={";
+        bio.appendTo(expected);
+        expected += "} (HEAP " + bioAddr + ")\n";
+        expected += "Move Constructor (STACK " + shortAddr(&moved).str()
+                  + "): id=1, took ownership of bio at HEAP " + bioAddr + "\n";
+        // Destroyed in reverse order: moved first, then the empty original
+        expected += "Destructor (STACK " + shortAddr(&moved).str() + "): id=1, bio={";
+        bio.appendTo(expected);
+        expected += "} (HEAP " + bioAddr + ")\n";
+        expected += "Destructor (STACK " + shortAddr(&original).str() + "): id=1, bio=(moved)\n";
+    });
+    if constexpr (kTraceEnabled) {
+        EXPECT_EQ(output, expected);
+    } else {
+        EXPECT_EQ(output, "");
+    }
+}
+
+TEST(TraceTest, InlineFancyNameTagCopyLine) {
+    Bio bio{"Ann", "TA", "CS", 2020};
+    std::string expected;
+    const std::string output = captureCout([&] {
+        InlineFancyNameTag original(3, "WSU", bio);
+        const std::string lines = captureCout([&] {
+            InlineFancyNameTag copy(original);
+            expected = "Copy Constructor (STACK " + shortAddr(&copy).str()
+                     + "): id=3, copied bio from INLINE " + shortAddr(&original.getBio()).str()
+                     + " to INLINE " + shortAddr(&copy.getBio()).str() + "\n";
+        });
+        if constexpr (kTraceEnabled) {
+            // The copy's destructor line follows the copy constructor line
+            EXPECT_EQ(lines.substr(0, expected.size()), expected);
+        } else {
+            EXPECT_EQ(lines, "");
+        }
+    });
+    (void)output;
+}
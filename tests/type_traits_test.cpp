@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "Bio.h"
+#include "BioPool.h"
+#include "FancyNameTag.h"
+#include "InstanceCounters.h"
+#include "NameTag.h"
+
+// ==================== Move/copy type traits ====================
+// Checked at compile time: if someone adds a member whose move can throw,
+// or drops a noexcept, the test file stops compiling.
+
+static_assert(std::is_nothrow_move_constructible_v<NameTag>);
+static_assert(std::is_nothrow_move_assignable_v<NameTag>);
+static_assert(std::is_copy_constructible_v<NameTag>);
+static_assert(std::is_copy_assignable_v<NameTag>);
+
+static_assert(std::is_nothrow_move_constructible_v<FancyNameTag>);
+static_assert(std::is_nothrow_move_assignable_v<FancyNameTag>);
+static_assert(std::is_copy_constructible_v<FancyNameTag>);
+static_assert(std::is_copy_assignable_v<FancyNameTag>);
+static_assert(std::is_nothrow_destructible_v<FancyNameTag>);
+
+// std::swap (used by std::sort) is noexcept exactly when both moves are
+static_assert(std::is_nothrow_swappable_v<NameTag>);
+static_assert(std::is_nothrow_swappable_v<FancyNameTag>);
+
+namespace {
+
+const Bio kBio{"Scott", "Professor", "Computer Science", 2010};
+
+} // namespace
+
+// ==================== FancyNameTag copy assignment ====================
+
+TEST(FancyNameTagAssignmentTest, CopyAssignmentDeepCopiesBio) {
+    FancyNameTag source(1, "Weber State Univ.", kBio);
+    FancyNameTag target(2, "Other", Bio{"Ann", "TA", "CS", 2020});
+
+    target = source;
+
+    EXPECT_EQ(target.getId(), 1);
+    EXPECT_EQ(target.getCompany(), "Weber State Univ.");
+    EXPECT_EQ(target.getBio().name, "Scott");
+    EXPECT_NE(&target.getBio(), &source.getBio()) << "copy assignment must deep copy the Bio";
+}
+
+TEST(FancyNameTagAssignmentTest, CopyAssignmentIsIndependent) {
+    FancyNameTag source(1, "Weber State Univ.", kBio);
+    FancyNameTag target(2, "Other", kBio);
+    target = source;
+
+    source.setBioTitle("Dean");
+    EXPECT_EQ(target.getBio().title, "Professor");
+}
+
+TEST(FancyNameTagAssignmentTest, SelfCopyAssignmentKeepsBio) {
+    FancyNameTag tag(1, "Weber State Univ.", kBio);
+    const Bio* before = &tag.getBio();
+    FancyNameTag& self = tag;
+
+    tag = self;
+
+    EXPECT_EQ(&tag.getBio(), before);
+    EXPECT_EQ(tag.getBio().name, "Scott");
+}
+
+TEST(FancyNameTagAssignmentTest, CopyAssignmentTakesSourceStrategy) {
+    FancyNameTag source(1, "Weber State Univ.", kBio, BioAlloc::Shared);
+    FancyNameTag target(2, "Other", kBio, BioAlloc::Heap);
+
+    target = source;
+
+    EXPECT_EQ(target.getBioAlloc(), BioAlloc::Shared);
+    EXPECT_EQ(source.getBioUseCount(), 2u) << "a Shared Bio is shared, not copied";
+}
+
+// ==================== FancyNameTag move assignment ====================
+
+TEST(FancyNameTagAssignmentTest, MoveAssignmentStealsBio) {
+    FancyNameTag source(1, "Weber State Univ.", kBio);
+    FancyNameTag target(2, "Other", Bio{"Ann", "TA", "CS", 2020});
+    const Bio* sourceBio = &source.getBio();
+
+    target = std::move(source);
+
+    EXPECT_EQ(target.getId(), 1);
+    EXPECT_EQ(&target.getBio(), sourceBio) << "move assignment should take the same Bio";
+    EXPECT_EQ(source.getBioUseCount(), 0u) << "the source is left without a Bio";
+}
+
+TEST(FancyNameTagAssignmentTest, MoveAssignmentMakesNoCopies) {
+    if constexpr (!kCountersEnabled) {
+        GTEST_SKIP() << "counters are compiled out (NAMETAG_COUNTERS=OFF)";
+    }
+    FancyNameTag source(1, "Weber State Univ.", kBio);
+    FancyNameTag target(2, "Other", kBio);
+    const InstanceCounts tagsBefore = InstanceCounter<FancyNameTag>::snapshot();
+    const InstanceCounts biosBefore = InstanceCounter<Bio>::snapshot();
+
+    target = std::move(source);
+
+    const InstanceCounts tags = InstanceCounter<FancyNameTag>::snapshot() - tagsBefore;
+    const InstanceCounts bios = InstanceCounter<Bio>::snapshot() - biosBefore;
+    EXPECT_EQ(tags.moves, 1u);
+    EXPECT_EQ(tags.copies, 0u);
+    EXPECT_EQ(tags.heapBytes, 0u);
+    EXPECT_EQ(bios.copies, 0u);
+    EXPECT_EQ(bios.live, -1) << "target's old Bio is freed";
+}
+
+TEST(FancyNameTagAssignmentTest, AssignFromMovedFromTagLeavesNoBio) {
+    FancyNameTag source(1, "Weber State Univ.", kBio);
+    FancyNameTag other(std::move(source));
+    FancyNameTag target(2, "Other", kBio);
+
+    target = source;
+    EXPECT_EQ(target.getBioUseCount(), 0u);
+}
+
+// ==================== Algorithms that need assignment ====================
+
+TEST(FancyNameTagAssignmentTest, SortAndEraseMoveInsteadOfCopying) {
+    std::vector<FancyNameTag> tags;
+    tags.reserve(50);
+    for (int id = 50; id >= 1; --id) {
+        tags.emplace_back(id, "Weber State Univ.", kBio);
+    }
+    const InstanceCounts before = InstanceCounter<FancyNameTag>::snapshot();
+
+    std::sort(tags.begin(), tags.end(), [](const FancyNameTag& a, const FancyNameTag& b) {
+        return a.getId() < b.getId();
+    });
+    tags.erase(tags.begin(), tags.begin() + 10);
+    tags.insert(tags.begin(), FancyNameTag(100, "Weber State Univ.", kBio));
+
+    ASSERT_EQ(tags.size(), 41u);
+    EXPECT_EQ(tags[0].getId(), 100);
+    EXPECT_EQ(tags[1].getId(), 11);
+    EXPECT_EQ(tags.back().getId(), 50);
+    if constexpr (kCountersEnabled) {
+        EXPECT_EQ((InstanceCounter<FancyNameTag>::snapshot() - before).copies, 0u);
+    }
+}
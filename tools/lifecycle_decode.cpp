@@ -0,0 +1,96 @@
+// Include the event format and the line formatter
+#include "LifecycleRecorder.h"
+
+// cstdint for fixed-width counters
+#include <cstdint>
+// exception to report a bad file
+#include <exception>
+// fstream to open the recording
+#include <fstream>
+// iostream for std::cout and std::cerr
+#include <iostream>
+// iterator for std::size
+#include <iterator>
+// string for the output buffer and arguments
+#include <string>
+// vector for the decoded events
+#include <vector>
+
+// Turns a binary lifecycle recording back into the console trace.
+//
+// Usage: lifecycle_decode [--timestamps] [--summary] events.bin
+//   --timestamps  prefix each line with the time since the first event
+//   --summary     end with how many constructions, copies, moves,
+//                 assignments and destructions the recording holds
+//
+// Record one with: CopyAndMoveConstructor --record events.bin
+int main(int argc, char* argv[]) {
+    bool timestamps = false;
+    bool summary = false;
+    std::string path;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--timestamps") {
+            timestamps = true;
+        } else if (arg == "--summary") {
+            summary = true;
+        } else if (path.empty()) {
+            path = arg;
+        } else {
+            path.clear();
+            break;
+        }
+    }
+    if (path.empty()) {
+        std::cerr << "usage: lifecycle_decode [--timestamps] [--summary] events.bin\n";
+        return 2;
+    }
+
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        std::cerr << "lifecycle_decode: cannot open " << path << "\n";
+        return 1;
+    }
+
+    std::vector<LifecycleRecord> records;
+    try {
+        records = readLifecycleRecords(in);
+    } catch (const std::exception& e) {
+        std::cerr << "lifecycle_decode: " << path << ": " << e.what() << "\n";
+        return 1;
+    }
+
+    // Counts indexed by LifecycleKind
+    std::uint64_t counts[6] = {};
+    const std::uint64_t firstNs = records.empty() ? 0 : records.front().event.timestamp;
+    std::string line;
+    for (const LifecycleRecord& record : records) {
+        const LifecycleEvent& event = record.event;
+        line.clear();
+        if (timestamps) {
+            // Microseconds with 3 decimals, e.g. "[+12.345 us] "
+            const std::uint64_t ns = event.timestamp - firstNs;
+            line += "[+" + std::to_string(ns / 1000) + ".";
+            const std::string fraction = std::to_string(ns % 1000);
+            line.append(3 - fraction.size(), '0');
+            line += fraction + " us] ";
+        }
+        appendLifecycleLine(line, record);
+        std::cout << line;
+        const auto kind = static_cast<std::size_t>(event.kind);
+        if (kind < std::size(counts)) {
+            ++counts[kind];
+        }
+    }
+
+    if (summary) {
+        std::cout << "\n--- Summary ---\n"
+                  << "constructed: " << counts[static_cast<int>(LifecycleKind::Construct)] << "\n"
+                  << "copied:      " << counts[static_cast<int>(LifecycleKind::Copy)] << "\n"
+                  << "moved:       " << counts[static_cast<int>(LifecycleKind::Move)] << "\n"
+                  << "copy-assigned: " << counts[static_cast<int>(LifecycleKind::CopyAssign)] << "\n"
+                  << "move-assigned: " << counts[static_cast<int>(LifecycleKind::MoveAssign)] << "\n"
+                  << "destroyed:   " << counts[static_cast<int>(LifecycleKind::Destroy)] << "\n";
+    }
+    return 0;
+}